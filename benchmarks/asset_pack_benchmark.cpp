@@ -0,0 +1,233 @@
+#include "asset_pack.h"
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+/*
+	[에셋 팩 벤치마크]
+	같은 에셋을 개별 파일로 읽을 때와 단일 에셋 팩으로 읽을 때의 시작 I/O 시간을 비교한다.
+	1. 팩의 에셋을 렌더러와 같은 방식으로 개별 파일로 풀어서 기록 (메시 / 텍스처는 매핑, 셰이더는 ifstream)
+	2. 각 방식마다 페이지 캐시를 비운 cold 측정과 바로 다시 읽는 warm 측정 (모든 페이지를 1 번씩 접근)
+	(페이지 캐시 비우기는 posix_fadvise 를 쓰므로 Windows 에서는 warm 만 의미 있음)
+	팩 파일이 없으면 크기가 다양한 합성 에셋으로 팩을 만들어서 측정
+	사용법: asset_pack_benchmark [팩 경로]
+*/
+namespace {
+
+const char* const SYNTHETIC_PACK_PATH = "asset_pack_benchmark_synthetic.pack";
+const char* const LOOSE_DIRECTORY = "asset_pack_benchmark_loose";
+const uint32_t SYNTHETIC_ASSET_COUNT = 48;
+const int RUN_COUNT = 5;
+
+struct LooseAsset {
+	std::string path;
+	AssetType type;
+	size_t size;
+};
+
+float elapsedMilliseconds(std::chrono::high_resolution_clock::time_point startTime) {
+	auto endTime = std::chrono::high_resolution_clock::now();
+	return std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+}
+
+// 파일을 디스크에 기록한 뒤 페이지 캐시에서 제거 (지원하지 않으면 false)
+bool dropPageCache(const std::string& path) {
+#ifdef _WIN32
+	return false;
+#else
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+	fdatasync(fd);
+	bool dropped = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+	::close(fd);
+	return dropped;
+#endif
+}
+
+// 모든 페이지를 1 번씩 읽어서 실제 I/O 가 끝나도록 함
+uint64_t touchPages(const uint8_t* data, size_t size) {
+	uint64_t sum = 0;
+	for (size_t offset = 0; offset < size; offset += 4096) {
+		sum += data[offset];
+	}
+	return sum;
+}
+
+// 크기가 다양한 합성 에셋 (셰이더 수 KB ~ 텍스처 / 메시 수 MB)
+void writeSyntheticPack(const std::string& path) {
+	std::mt19937 rng(7);
+	std::vector<AssetPackInput> inputs(SYNTHETIC_ASSET_COUNT);
+	for (uint32_t i = 0; i < SYNTHETIC_ASSET_COUNT; i++) {
+		AssetPackInput& input = inputs[i];
+		input.type = static_cast<AssetType>(i % 3);
+		input.name = "synthetic/" + std::to_string(i);
+		size_t size = input.type == ASSET_TYPE_SHADER ? 4096 + rng() % (16 * 1024) : 256 * 1024 + rng() % (4 * 1024 * 1024);
+		input.data.resize(size & ~size_t(3));
+		for (uint8_t& value : input.data) {
+			value = static_cast<uint8_t>(rng());
+		}
+	}
+	if (!AssetPack::write(path, inputs)) {
+		throw std::runtime_error("failed to write synthetic asset pack!");
+	}
+}
+
+// 팩의 에셋을 개별 파일로 기록
+std::vector<LooseAsset> writeLooseFiles(const AssetPack& pack, const std::vector<std::string>& names) {
+	std::filesystem::create_directories(LOOSE_DIRECTORY);
+	std::vector<LooseAsset> assets;
+	for (size_t i = 0; i < names.size(); i++) {
+		for (uint32_t type = ASSET_TYPE_MESH; type <= ASSET_TYPE_SHADER; type++) {
+			AssetBlob blob;
+			if (!pack.find(names[i], static_cast<AssetType>(type), blob)) {
+				continue;
+			}
+			LooseAsset asset;
+			asset.path = std::string(LOOSE_DIRECTORY) + "/" + std::to_string(i) + ".bin";
+			asset.type = static_cast<AssetType>(type);
+			asset.size = blob.size;
+			std::ofstream out(asset.path, std::ios::binary | std::ios::trunc);
+			out.write(reinterpret_cast<const char*>(blob.data), blob.size);
+			assets.push_back(asset);
+		}
+	}
+	return assets;
+}
+
+// 개별 파일 로드 (렌더러와 같은 방식: 메시 캐시 / KTX2 는 매핑, 셰이더는 ifstream 으로 읽기)
+uint64_t loadLoose(const std::vector<LooseAsset>& assets) {
+	uint64_t sum = 0;
+	for (const LooseAsset& asset : assets) {
+		if (asset.type == ASSET_TYPE_SHADER) {
+			std::ifstream file(asset.path, std::ios::ate | std::ios::binary);
+			std::vector<char> buffer(static_cast<size_t>(file.tellg()));
+			file.seekg(0);
+			file.read(buffer.data(), buffer.size());
+			sum += touchPages(reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size());
+		} else {
+			MappedFile file;
+			if (!file.open(asset.path)) {
+				throw std::runtime_error("failed to open loose asset!");
+			}
+			sum += touchPages(file.data(), file.size());
+		}
+	}
+	return sum;
+}
+
+// 팩 로드 (매핑 1 번 + 전체 미리 읽기 후 에셋 구간 접근)
+uint64_t loadPack(const std::string& path, const std::vector<std::string>& names) {
+	AssetPack pack;
+	if (!pack.open(path)) {
+		throw std::runtime_error("failed to open asset pack!");
+	}
+	uint64_t sum = 0;
+	for (const std::string& name : names) {
+		for (uint32_t type = ASSET_TYPE_MESH; type <= ASSET_TYPE_SHADER; type++) {
+			AssetBlob blob;
+			if (pack.find(name, static_cast<AssetType>(type), blob)) {
+				sum += touchPages(blob.data, blob.size);
+			}
+		}
+	}
+	return sum;
+}
+
+// 팩 인덱스의 이름 목록 (AssetPack 은 이름 목록을 공개하지 않으므로 합성 팩은 규칙으로, 실제 팩은 렌더러 에셋 경로로)
+std::vector<std::string> assetNames(bool synthetic) {
+	std::vector<std::string> names;
+	if (synthetic) {
+		for (uint32_t i = 0; i < SYNTHETIC_ASSET_COUNT; i++) {
+			names.push_back("synthetic/" + std::to_string(i));
+		}
+	} else {
+		names = {"models/viking_room.obj", "textures/viking_room.ktx2", "shaders/vert.spv", "shaders/frag.spv"};
+	}
+	return names;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	std::string packPath = argc > 1 ? argv[1] : "assets.pack";
+	bool synthetic = !std::filesystem::exists(packPath);
+	if (synthetic) {
+		packPath = SYNTHETIC_PACK_PATH;
+		writeSyntheticPack(packPath);
+	}
+	std::vector<std::string> names = assetNames(synthetic);
+
+	std::vector<LooseAsset> assets;
+	size_t totalSize = 0;
+	{
+		AssetPack pack;
+		pack.open(packPath);
+		assets = writeLooseFiles(pack, names);
+		for (const LooseAsset& asset : assets) {
+			totalSize += asset.size;
+		}
+	}
+	if (assets.empty()) {
+		std::cerr << "no assets found in " << packPath << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	bool canDrop = dropPageCache(packPath);
+	std::cout << packPath << (synthetic ? " (synthetic)" : "") << ": " << assets.size() << " assets, " << totalSize / 1024 << " KB"
+			  << (canDrop ? "" : " (page cache drop unsupported, cold == warm)") << std::endl;
+
+	// 각 방식의 cold / warm 최소 시간
+	float looseCold = 1e30f, looseWarm = 1e30f, packCold = 1e30f, packWarm = 1e30f;
+	uint64_t looseSum = 0, packSum = 0;
+	for (int run = 0; run < RUN_COUNT; run++) {
+		for (const LooseAsset& asset : assets) {
+			dropPageCache(asset.path);
+		}
+		auto startTime = std::chrono::high_resolution_clock::now();
+		looseSum = loadLoose(assets);
+		looseCold = std::min(looseCold, elapsedMilliseconds(startTime));
+		startTime = std::chrono::high_resolution_clock::now();
+		loadLoose(assets);
+		looseWarm = std::min(looseWarm, elapsedMilliseconds(startTime));
+
+		dropPageCache(packPath);
+		startTime = std::chrono::high_resolution_clock::now();
+		packSum = loadPack(packPath, names);
+		packCold = std::min(packCold, elapsedMilliseconds(startTime));
+		startTime = std::chrono::high_resolution_clock::now();
+		loadPack(packPath, names);
+		packWarm = std::min(packWarm, elapsedMilliseconds(startTime));
+	}
+
+	float megabytes = totalSize / (1024.0f * 1024.0f);
+	auto report = [&](const char* name, float cold, float warm) {
+		std::printf("  %-6s cold %8.2f ms (%7.1f MB/s)   warm %8.2f ms\n", name, cold, megabytes / (cold / 1000.0f), warm);
+	};
+	report("loose", looseCold, looseWarm);
+	report("pack", packCold, packWarm);
+	std::printf("  cold speedup %.2fx, data %s\n", looseCold / packCold, looseSum == packSum ? "identical" : "MISMATCH");
+
+	std::error_code ec;
+	std::filesystem::remove_all(LOOSE_DIRECTORY, ec);
+	if (synthetic) {
+		std::filesystem::remove(SYNTHETIC_PACK_PATH, ec);
+	}
+	return looseSum == packSum ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,274 @@
+#include "deletion_queue.h"
+#include "mock_device.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+/*
+	[지연 삭제 큐 벤치마크]
+	가짜 장치 위에서 MAX_FRAMES_IN_FLIGHT 개의 프레임을 돌리면서 GPU 객체를 무작위로 만들고, 커맨드 버퍼에 기록하고, 해제한다.
+	1. GPU 는 프레임 펜스를 기다릴 때 그 프레임 제출이 끝난 것으로 처리
+	2. 가짜 vkDestroy* 는 객체를 마지막으로 기록한 프레임이 아직 끝나지 않았거나 두 번 파괴하면 오류
+	3. 창 크기 조절 (스왑 체인 + 이미지 뷰 + 프레임 버퍼 + attachment 재생성) 마다 vkDeviceWaitIdle 대신 삭제 큐로 해제
+	   표시 요청은 프레임 펜스가 덮지 않으므로 스왑 체인은 제출 후 FRAME_COUNT + 1 개 제출이 끝나야 다 쓴 것으로 보고,
+	   이전 스왑 체인은 SWAPCHAIN_RETIRE_DELAY_FRAMES 만큼 늦게 파괴 (present 펜스가 없는 경로)
+	해제 / 파괴 비용과 대기 중인 객체 수, 해제하지 않은 핸들 보고를 함께 검사
+	사용법: deletion_queue_benchmark [프레임 수]
+*/
+namespace {
+
+const uint32_t FRAME_COUNT = 2;						// MAX_FRAMES_IN_FLIGHT
+const uint32_t DEFAULT_SIMULATED_FRAMES = 200000;
+const uint32_t SWAPCHAIN_IMAGE_COUNT = 3;
+const uint32_t RESIZE_INTERVAL = 4;					// 창을 끄는 동안 몇 프레임마다 재생성되는지
+const uint32_t MAX_LIVE_OBJECTS = 256;
+const uint32_t SWAPCHAIN_RETIRE_DELAY_FRAMES = FRAME_COUNT;	// main.cpp 와 같은 값
+
+// 가짜 장치: 객체 id → 마지막으로 기록한 제출 번호
+struct MockDevice {
+	std::unordered_map<uint64_t, uint64_t> lastUse;
+	uint64_t completed = 0;
+	uint64_t nextId = 1;
+	uint64_t destroyed = 0;
+	uint32_t errors = 0;
+};
+
+MockDevice mockDevice;
+
+void mockDestroy(uint64_t handle) {
+	auto it = mockDevice.lastUse.find(handle);
+	if (it == mockDevice.lastUse.end()) {
+		mockDevice.errors++;		// 두 번 파괴 / 만들지 않은 객체
+		return;
+	}
+	if (it->second > mockDevice.completed) {
+		mockDevice.errors++;		// 실행 중인 프레임이 쓰는 객체
+	}
+	mockDevice.lastUse.erase(it);
+	mockDevice.destroyed++;
+}
+
+VKAPI_ATTR void VKAPI_CALL mockDestroyBuffer(VkDevice, VkBuffer buffer, const VkAllocationCallbacks*) { mockDestroy((uint64_t)buffer); }
+VKAPI_ATTR void VKAPI_CALL mockDestroyImage(VkDevice, VkImage image, const VkAllocationCallbacks*) { mockDestroy((uint64_t)image); }
+VKAPI_ATTR void VKAPI_CALL mockDestroyImageView(VkDevice, VkImageView view, const VkAllocationCallbacks*) { mockDestroy((uint64_t)view); }
+VKAPI_ATTR void VKAPI_CALL mockDestroySampler(VkDevice, VkSampler sampler, const VkAllocationCallbacks*) { mockDestroy((uint64_t)sampler); }
+VKAPI_ATTR void VKAPI_CALL mockDestroyFramebuffer(VkDevice, VkFramebuffer framebuffer, const VkAllocationCallbacks*) { mockDestroy((uint64_t)framebuffer); }
+VKAPI_ATTR void VKAPI_CALL mockDestroyPipeline(VkDevice, VkPipeline pipeline, const VkAllocationCallbacks*) { mockDestroy((uint64_t)pipeline); }
+VKAPI_ATTR void VKAPI_CALL mockDestroySwapchain(VkDevice, VkSwapchainKHR swapchain, const VkAllocationCallbacks*) { mockDestroy((uint64_t)swapchain); }
+
+DeletionQueueFunctions mockFunctions() {
+	DeletionQueueFunctions functions{};
+	functions.destroyBuffer = mockDestroyBuffer;
+	functions.destroyImage = mockDestroyImage;
+	functions.destroyImageView = mockDestroyImageView;
+	functions.destroySampler = mockDestroySampler;
+	functions.destroyFramebuffer = mockDestroyFramebuffer;
+	functions.destroyPipeline = mockDestroyPipeline;
+	functions.destroySwapchain = mockDestroySwapchain;
+	return functions;
+}
+
+// 가짜 핸들 생성 (vkCreate*)
+template <GpuObjectType Type>
+GpuHandle<Type> createObject(DeletionQueue& queue) {
+	uint64_t id = mockDevice.nextId++;
+	mockDevice.lastUse[id] = 0;
+	return GpuHandle<Type>(queue, (typename GpuHandle<Type>::Handle)id);
+}
+
+// 가짜 GPU: 프레임별 펜스가 가리키는 제출 번호
+struct MockGpu {
+	uint64_t submitted = 0;
+	uint64_t frameSerials[FRAME_COUNT] = {};
+
+	// 커맨드 버퍼에 객체 기록 (다음 제출에서 사용)
+	template <typename Handle>
+	void use(const Handle& handle) {
+		mockDevice.lastUse[(uint64_t)handle.get()] = submitted + 1;
+	}
+	// vkQueuePresentKHR (방금 제출한 프레임 이후 FRAME_COUNT 개 제출이 더 끝나야 표시가 끝났다고 봄)
+	void present(const GpuSwapchain& swapchain) {
+		mockDevice.lastUse[(uint64_t)swapchain.get()] = submitted + 1 + FRAME_COUNT;
+	}
+	// vkWaitForFences
+	void waitFence(DeletionQueue& queue, uint32_t frame) {
+		mockDevice.completed = std::max(mockDevice.completed, frameSerials[frame]);
+		queue.frameCompleted(frame);
+	}
+	// vkQueueSubmit
+	void submit(DeletionQueue& queue, uint32_t frame) {
+		frameSerials[frame] = ++submitted;
+		queue.frameSubmitted(frame);
+	}
+};
+
+// 스왑 체인에 딸린 객체 (main.cpp 의 재생성 대상과 같은 구성)
+struct SwapchainObjects {
+	GpuSwapchain swapchain;
+	std::vector<GpuImageView> views;
+	std::vector<GpuFramebuffer> framebuffers;
+	GpuImage colorImage;
+	GpuImageView colorView;
+	GpuImage depthImage;
+	GpuImageView depthView;
+};
+
+void createSwapchain(DeletionQueue& queue, SwapchainObjects& objects) {
+	objects.views.clear();
+	objects.framebuffers.clear();
+	objects.swapchain.reset(SWAPCHAIN_RETIRE_DELAY_FRAMES);
+	objects.swapchain = createObject<GPU_OBJECT_SWAPCHAIN>(queue);
+	for (uint32_t i = 0; i < SWAPCHAIN_IMAGE_COUNT; i++) {
+		objects.views.push_back(createObject<GPU_OBJECT_IMAGE_VIEW>(queue));
+		objects.framebuffers.push_back(createObject<GPU_OBJECT_FRAMEBUFFER>(queue));
+	}
+	objects.colorImage = createObject<GPU_OBJECT_IMAGE>(queue);
+	objects.colorView = createObject<GPU_OBJECT_IMAGE_VIEW>(queue);
+	objects.depthImage = createObject<GPU_OBJECT_IMAGE>(queue);
+	objects.depthView = createObject<GPU_OBJECT_IMAGE_VIEW>(queue);
+}
+
+struct RunResult {
+	uint64_t resizes = 0;
+	uint32_t peakPending = 0;		// 프레임 진행 중 최대 (종료시 해제 제외)
+	DeletionQueueStats stats;
+	double seconds = 0.0;
+};
+
+/*
+	프레임마다: 펜스 대기 → 무작위 객체 생성 / 기록 / 해제 (기록한 뒤 같은 프레임에 해제하는 경우 포함) → 제출
+	resize 이면 RESIZE_INTERVAL 프레임마다 스왑 체인 객체 재생성 (장치 대기 없음)
+*/
+RunResult runFrames(uint32_t frames, bool resize, GpuAllocator& allocator) {
+	DeletionQueue queue;
+	queue.init(VK_NULL_HANDLE, allocator, true, mockFunctions());
+	MockGpu gpu;
+	mockDevice.completed = 0;		// 제출 번호는 큐마다 새로 시작
+	std::mt19937 rng(5);
+	RunResult result;
+
+	std::vector<GpuBuffer> buffers;
+	std::vector<GpuMemory> memories;
+	SwapchainObjects swapchain;
+	GpuPipeline pipeline = createObject<GPU_OBJECT_PIPELINE>(queue);
+	createSwapchain(queue, swapchain);
+	VkMemoryRequirements requirements{4096, 256, 1};
+
+	auto startTime = std::chrono::high_resolution_clock::now();
+	for (uint32_t frame = 0; frame < frames; frame++) {
+		uint32_t frameIndex = frame % FRAME_COUNT;
+		gpu.waitFence(queue, frameIndex);
+
+		// 리소스 교체 (기록 전 / 후 해제)
+		for (uint32_t i = 0; i < 4; i++) {
+			if (buffers.size() < MAX_LIVE_OBJECTS || rng() % 2 == 0) {
+				buffers.push_back(createObject<GPU_OBJECT_BUFFER>(queue));
+				memories.emplace_back(queue, allocator.allocate(requirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, GPU_RESOURCE_LINEAR, GPU_MEMORY_PERSISTENT));
+			}
+		}
+		for (uint32_t i = 0; i < 8 && !buffers.empty(); i++) {
+			gpu.use(buffers[rng() % buffers.size()]);
+		}
+		gpu.use(pipeline);
+		for (uint32_t i = 0; i < 4 && buffers.size() > MAX_LIVE_OBJECTS / 2; i++) {
+			size_t index = rng() % buffers.size();
+			std::swap(buffers[index], buffers.back());
+			std::swap(memories[index], memories.back());
+			buffers.pop_back();			// 버퍼를 메모리보다 먼저 해제
+			memories.pop_back();
+		}
+		if (frame % 64 == 0) {
+			pipeline = createObject<GPU_OBJECT_PIPELINE>(queue);	// 파이프라인 교체 (이번 프레임은 새 파이프라인 사용)
+			gpu.use(pipeline);
+		}
+
+		// 창 크기 변경 (acquire 가 OUT_OF_DATE 를 반환했다고 보고 이번 프레임은 제출 없이 넘어가는 경우 포함)
+		if (resize && frame % RESIZE_INTERVAL == 0) {
+			createSwapchain(queue, swapchain);
+			result.resizes++;
+			if (frame % (RESIZE_INTERVAL * 2) == 0) {
+				continue;
+			}
+		}
+		gpu.use(swapchain.framebuffers[frame % SWAPCHAIN_IMAGE_COUNT]);
+		gpu.use(swapchain.colorView);
+		gpu.use(swapchain.depthView);
+		gpu.submit(queue, frameIndex);
+		gpu.present(swapchain.swapchain);
+	}
+	result.seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+	result.peakPending = queue.stats().peakPending;
+
+	// 종료: 장치 idle (표시 요청 포함) → 남은 핸들 해제 → 파괴
+	mockDevice.completed = gpu.submitted + 1 + FRAME_COUNT;
+	buffers.clear();
+	memories.clear();
+	swapchain = SwapchainObjects();
+	pipeline.reset();
+	queue.destroy();
+	result.stats = queue.stats();
+	return result;
+}
+
+// 해제하지 않은 핸들은 destroy 할 때 보고하고, 이후의 해제 요청은 무시
+void validateLeakReport(GpuAllocator& allocator) {
+	DeletionQueue queue;
+	queue.init(VK_NULL_HANDLE, allocator, true, mockFunctions());
+	GpuBuffer released = createObject<GPU_OBJECT_BUFFER>(queue);
+	GpuImage leaked = createObject<GPU_OBJECT_IMAGE>(queue);
+	released.reset();
+	uint64_t destroyedBefore = mockDevice.destroyed;
+
+	std::cout << "expected leak report: ";
+	queue.destroy();
+	check(queue.stats().leaked == 1 && mockDevice.destroyed == destroyedBefore + 1, "leaked handle was not reported");
+	leaked.reset();
+	check(mockDevice.destroyed == destroyedBefore + 1, "release after destroy was not ignored");
+	mockDevice.lastUse.clear();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	uint32_t frames = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : DEFAULT_SIMULATED_FRAMES;
+
+	setupMockHostMemory();
+	GpuAllocator allocator;
+	allocator.init(VK_NULL_HANDLE, mockMemory.properties, 1, mockAllocatorFunctions());
+
+	RunResult steady, resizing;
+	try {
+		validateLeakReport(allocator);
+		steady = runFrames(frames, false, allocator);
+		resizing = runFrames(frames, true, allocator);
+		check(mockDevice.errors == 0, "object was destroyed while a frame in flight used it");
+		check(mockDevice.lastUse.empty(), "object was never destroyed");
+		check(steady.stats.leaked == 0 && resizing.stats.leaked == 0, "handles leaked");
+		check(steady.stats.released == steady.stats.destroyed && resizing.stats.released == resizing.stats.destroyed, "released objects were not all destroyed");
+		check(allocator.stats().allocationCount == 0, "released memory was not returned to the allocator");
+		check(mockMemory.errors == 0, "mock device reported invalid memory calls");
+	} catch (const std::exception& e) {
+		std::cerr << "FAILED: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	allocator.destroy();
+	std::cout << "deletion queue validation passed" << std::endl;
+
+	std::cout << frames << " frames, " << FRAME_COUNT << " in flight" << std::endl;
+	for (const RunResult* result : {&steady, &resizing}) {
+		std::cout << "  " << (result == &steady ? "steady   " : "resizing ") << result->stats.released << " objects released, peak "
+				  << result->peakPending << " pending, " << result->seconds * 1e9 / frames << " ns per frame";
+		if (result->resizes > 0) {
+			std::cout << ", " << result->resizes << " swapchain rebuilds without vkDeviceWaitIdle";
+		}
+		std::cout << std::endl;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,289 @@
+#include "gpu_allocator.h"
+#include "mock_device.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+	[GPU 메모리 할당기 스트레스 테스트]
+	가짜 장치 (vkAllocateMemory / vkMapMemory 를 호스트 메모리로 흉내) 위에서 GpuAllocator 에 무작위 할당 / 해제를 반복한다.
+	1. 매 할당마다 검사: alignment, 블록 범위, 같은 메모리의 살아있는 구간과 겹침,
+	   선형 리소스와 optimal 이미지가 같은 bufferImageGranularity 페이지를 공유하는지
+	2. 매핑 주소에 구간별 값을 기록해두고 해제할 때 그대로인지 확인 (겹쳐 쓰기 검출)
+	3. 가짜 장치는 같은 메모리를 두 번 매핑하거나 힙 크기를 넘으면 실패를 반환
+	주기적으로 블록 수 / 사용량 / 단편화를 출력하고, 리소스마다 vkAllocateMemory 를 부를 때와 호출 수를 비교
+	마지막으로 창 크기 조절 중 멀티샘플링 attachment 재생성을 흉내내서 구간 재사용 (canReuse + 여유 할당) 여부별 호출 수를 비교
+	사용법: gpu_allocator_benchmark [연산 수]
+*/
+namespace {
+
+const uint32_t DEFAULT_OPERATION_COUNT = 400000;
+const uint32_t MAX_LIVE_ALLOCATIONS = 3000;
+const uint32_t MAX_TRANSIENT_ALLOCATIONS = 16;
+const uint32_t REPORT_COUNT = 8;
+const VkDeviceSize MOCK_GRANULARITY = 1024;
+
+// 외장 GPU 와 비슷한 구성 (VRAM / 시스템 메모리 / 작은 BAR 영역)
+void setupMockDevice() {
+	VkPhysicalDeviceMemoryProperties& properties = mockMemory.properties;
+	properties.memoryHeapCount = 3;
+	properties.memoryHeaps[0] = {8ull * 1024 * 1024 * 1024, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT};
+	properties.memoryHeaps[1] = {16ull * 1024 * 1024 * 1024, 0};
+	properties.memoryHeaps[2] = {256ull * 1024 * 1024, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT};
+	properties.memoryTypeCount = 3;
+	properties.memoryTypes[0] = {VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0};
+	properties.memoryTypes[1] = {VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 1};
+	properties.memoryTypes[2] = {VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 2};
+}
+
+// 살아있는 할당 (검사용 기록 포함)
+struct LiveAllocation {
+	GpuAllocation allocation;
+	GpuResourceKind kind;
+	uint64_t tag;
+};
+
+// 메모리별 살아있는 구간 (offset → 끝, 종류)
+struct LiveRange {
+	VkDeviceSize end;
+	GpuResourceKind kind;
+};
+
+std::map<VkDeviceMemory, std::map<VkDeviceSize, LiveRange>> liveRanges;
+
+// 두 구간이 다른 종류이면 같은 granularity 페이지에 있으면 안 됨
+bool sharesPage(VkDeviceSize firstEnd, VkDeviceSize secondOffset) {
+	return (firstEnd - 1) / MOCK_GRANULARITY == secondOffset / MOCK_GRANULARITY;
+}
+
+void addRange(const LiveAllocation& live) {
+	const GpuAllocation& allocation = live.allocation;
+	auto memory = mockMemory.memories.find(allocation.memory);
+	check(memory != mockMemory.memories.end(), "allocation has unknown memory");
+	check(allocation.offset + allocation.size <= memory->second.size, "allocation exceeds block");
+
+	std::map<VkDeviceSize, LiveRange>& ranges = liveRanges[allocation.memory];
+	VkDeviceSize end = allocation.offset + allocation.size;
+	auto next = ranges.lower_bound(allocation.offset);
+	if (next != ranges.end()) {
+		check(next->first >= end, "allocation overlaps next range");
+		check(next->second.kind == live.kind || !sharesPage(end, next->first), "granularity conflict with next range");
+	}
+	if (next != ranges.begin()) {
+		auto prev = std::prev(next);
+		check(prev->second.end <= allocation.offset, "allocation overlaps previous range");
+		check(prev->second.kind == live.kind || !sharesPage(prev->second.end, allocation.offset), "granularity conflict with previous range");
+	}
+	ranges[allocation.offset] = {end, live.kind};
+}
+
+void removeRange(const LiveAllocation& live) {
+	auto ranges = liveRanges.find(live.allocation.memory);
+	check(ranges != liveRanges.end() && ranges->second.erase(live.allocation.offset) == 1, "freed range was not live");
+	if (ranges->second.empty()) {
+		liveRanges.erase(ranges);
+	}
+}
+
+// 매핑 주소의 앞 / 뒤에 tag 기록 및 확인
+void writeTag(const LiveAllocation& live) {
+	uint8_t* mapped = static_cast<uint8_t*>(live.allocation.mapped);
+	size_t size = std::min<size_t>(sizeof(live.tag), live.allocation.size);
+	memcpy(mapped, &live.tag, size);
+	memcpy(mapped + live.allocation.size - size, &live.tag, size);
+}
+
+void verifyTag(const LiveAllocation& live) {
+	const uint8_t* mapped = static_cast<const uint8_t*>(live.allocation.mapped);
+	size_t size = std::min<size_t>(sizeof(live.tag), live.allocation.size);
+	check(memcmp(mapped, &live.tag, size) == 0 && memcmp(mapped + live.allocation.size - size, &live.tag, size) == 0, "mapped data was overwritten");
+}
+
+// 로그 분포 크기 (대부분 수 KB ~ 수 MB, 가끔 전용 블록 크기)
+/*
+	창을 끌어서 키웠다 줄였다 할 때 매 크기마다 8x 멀티샘플링 color (RGBA8) + depth (D32) attachment 재생성
+	reuse 면 렌더러와 같이 들어가는 동안 기존 구간 재사용, 아니면 매번 해제 후 할당
+	반환값은 vkAllocateMemory 호출 수
+*/
+uint64_t simulateResizes(GpuAllocator& allocator, bool reuse) {
+	const uint32_t samples = 8;
+	const uint32_t bytesPerSample[2] = {4, 4};
+	const float growth = 0.25f;		// ATTACHMENT_GROWTH
+	GpuAllocation allocations[2];
+	uint64_t before = allocator.stats().deviceAllocations;
+
+	// mock 장치에는 LAZILY_ALLOCATED 유형이 없으므로 DEVICE_LOCAL 로 대체
+	VkMemoryPropertyFlags properties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+	if (!allocator.hasMemoryType(0x5, properties)) {
+		properties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+	}
+	check(properties == VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, "mock device reported a lazily allocated memory type");
+
+	for (uint32_t step = 0; step < 400; step++) {
+		// 1280x720 → 2560x1440 → 1280x720 를 두 번 왕복
+		float t = std::fabs(std::fmod(step / 100.0f, 2.0f) - 1.0f);
+		uint32_t width = 2560 - static_cast<uint32_t>(1280 * t);
+		uint32_t height = 1440 - static_cast<uint32_t>(720 * t);
+		for (uint32_t i = 0; i < 2; i++) {
+			VkMemoryRequirements requirements;
+			requirements.size = VkDeviceSize(width) * height * samples * bytesPerSample[i];
+			requirements.alignment = 64 * 1024;
+			requirements.memoryTypeBits = 0x5;
+			if (!reuse || !allocator.canReuse(allocations[i], requirements, properties)) {
+				allocator.free(allocations[i]);
+				if (reuse) {
+					requirements.size += static_cast<VkDeviceSize>(requirements.size * growth);
+				}
+				allocations[i] = allocator.allocate(requirements, properties, GPU_RESOURCE_OPTIMAL, GPU_MEMORY_PERSISTENT);
+			}
+			check(allocations[i].size >= VkDeviceSize(width) * height * samples * bytesPerSample[i], "reused attachment allocation is too small");
+		}
+	}
+	allocator.free(allocations[0]);
+	allocator.free(allocations[1]);
+	return allocator.stats().deviceAllocations - before;
+}
+
+VkDeviceSize randomSize(std::mt19937& rng) {
+	std::uniform_real_distribution<double> exponent(8.0, 23.0);
+	VkDeviceSize size = static_cast<VkDeviceSize>(std::pow(2.0, exponent(rng)));
+	if (rng() % 500 == 0) {
+		size = 48ull * 1024 * 1024;
+	}
+	return size;
+}
+
+void printStats(const char* label, const GpuAllocatorStats& stats) {
+	std::cout << "  " << label << ": " << stats.blockCount << " blocks, "
+			  << stats.blockBytes / (1024 * 1024) << " MB reserved, "
+			  << stats.usedBytes / (1024 * 1024) << " MB in use, "
+			  << stats.allocationCount << " allocations, "
+			  << "largest free " << stats.largestFreeRange / 1024 << " KB, "
+			  << "fragmentation " << stats.fragmentation * 100.0f << "%" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	uint32_t operationCount = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : DEFAULT_OPERATION_COUNT;
+	setupMockDevice();
+
+	GpuAllocator allocator;
+	allocator.init(VK_NULL_HANDLE, mockMemory.properties, MOCK_GRANULARITY, mockAllocatorFunctions());
+
+	std::mt19937 rng(1234);
+	std::vector<LiveAllocation> live;
+	std::deque<LiveAllocation> transient;
+	uint64_t nextTag = 1;
+	double allocatorSeconds = 0.0;
+	uint64_t allocatorCalls = 0;
+
+	auto release = [&](LiveAllocation& allocation) {
+		if (allocation.allocation.mapped) {
+			verifyTag(allocation);
+		}
+		removeRange(allocation);
+		auto startTime = std::chrono::high_resolution_clock::now();
+		allocator.free(allocation.allocation);
+		allocatorSeconds += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+		allocatorCalls++;
+		check(allocation.allocation.memory == VK_NULL_HANDLE, "free did not reset allocation");
+	};
+
+	try {
+		std::cout << "gpu allocator stress test (mock device, granularity " << MOCK_GRANULARITY << ", " << operationCount << " operations)" << std::endl;
+		for (uint32_t operation = 0; operation < operationCount; operation++) {
+			// 살아있는 할당 수가 목표 근처에서 오르내리도록 할당 / 해제 확률 조절
+			bool allocate = live.empty() || rng() % MAX_LIVE_ALLOCATIONS >= live.size();
+			if (allocate) {
+				LiveAllocation allocation;
+				allocation.kind = static_cast<GpuResourceKind>(rng() % 2);
+				allocation.tag = nextTag++;
+				GpuMemoryLifetime lifetime = rng() % 3 == 0 ? GPU_MEMORY_TRANSIENT : GPU_MEMORY_PERSISTENT;
+
+				VkMemoryRequirements requirements;
+				requirements.size = lifetime == GPU_MEMORY_TRANSIENT ? randomSize(rng) / 4 + 1 : randomSize(rng) + rng() % 4096;
+				requirements.alignment = VkDeviceSize(1) << (2 + rng() % 15);
+				// optimal 이미지는 VRAM 만, 버퍼는 모든 유형 가능 (업로드 / 유니폼은 HOST_VISIBLE)
+				bool hostVisible = allocation.kind == GPU_RESOURCE_LINEAR && rng() % 2 == 0;
+				requirements.memoryTypeBits = allocation.kind == GPU_RESOURCE_OPTIMAL ? 0x5 : 0x7;
+				VkMemoryPropertyFlags properties = hostVisible
+					? VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+					: VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+
+				auto startTime = std::chrono::high_resolution_clock::now();
+				allocation.allocation = allocator.allocate(requirements, properties, allocation.kind, lifetime);
+				allocatorSeconds += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+				allocatorCalls++;
+
+				check(allocation.allocation.offset % requirements.alignment == 0, "allocation is misaligned");
+				check(allocation.allocation.size >= requirements.size, "allocation is too small");
+				check(!hostVisible || allocation.allocation.mapped != nullptr, "host visible allocation is not mapped");
+				addRange(allocation);
+				if (allocation.allocation.mapped) {
+					writeTag(allocation);
+				}
+
+				// 임시 할당은 잠깐 뒤에 해제 (스테이징 버퍼처럼)
+				if (lifetime == GPU_MEMORY_TRANSIENT) {
+					transient.push_back(allocation);
+					if (transient.size() > MAX_TRANSIENT_ALLOCATIONS) {
+						release(transient.front());
+						transient.pop_front();
+					}
+				} else {
+					live.push_back(allocation);
+				}
+			} else {
+				size_t index = rng() % live.size();
+				release(live[index]);
+				live[index] = live.back();
+				live.pop_back();
+			}
+
+			if ((operation + 1) % (operationCount / REPORT_COUNT + 1) == 0) {
+				printStats(("op " + std::to_string(operation + 1)).c_str(), allocator.stats());
+			}
+		}
+
+		printStats("peak set", allocator.stats());
+		for (LiveAllocation& allocation : live) {
+			release(allocation);
+		}
+		for (LiveAllocation& allocation : transient) {
+			release(allocation);
+		}
+		GpuAllocatorStats stats = allocator.stats();
+		printStats("all freed", stats);
+		check(stats.allocationCount == 0 && stats.usedBytes == 0, "allocator still reports live allocations");
+		check(stats.fragmentation == 0.0f, "free space is fragmented after freeing everything");
+		check(mockMemory.errors == 0, "mock device reported invalid calls");
+
+		uint64_t resizeAllocations = simulateResizes(allocator, false);
+		uint64_t reuseAllocations = simulateResizes(allocator, true);
+		check(mockMemory.errors == 0, "mock device reported invalid calls");
+
+		allocator.destroy();
+		check(mockMemory.memories.empty(), "allocator leaked device memory");
+
+		std::cout << "  vkAllocateMemory calls: " << stats.deviceAllocations << " (per-resource allocation would need " << stats.totalAllocations << ")" << std::endl;
+		std::cout << "  allocator: " << allocatorSeconds * 1e9 / allocatorCalls << " ns per allocate / free" << std::endl;
+		std::cout << "  400 resizes (8x MSAA color + depth): " << resizeAllocations << " vkAllocateMemory calls, "
+				  << reuseAllocations << " with attachment reuse" << std::endl;
+	} catch (const std::exception& e) {
+		std::cerr << "FAILED: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	std::cout << "PASSED" << std::endl;
+	return EXIT_SUCCESS;
+}
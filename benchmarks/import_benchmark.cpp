@@ -0,0 +1,57 @@
+#include "model_loader.h"
+#include "thread_pool.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+/*
+	[모델 변환 벤치마크]
+	Assimp 파싱은 한 번만 하고 aiScene → MeshData 변환만 스레드 수 1..N 으로 반복 측정한다.
+	사용법: import_benchmark [모델 경로] [반복 횟수]
+*/
+int main(int argc, char** argv) {
+	std::string modelPath = argc > 1 ? argv[1] : "models/viking_room.obj";
+	int iterations = argc > 2 ? std::atoi(argv[2]) : 20;
+
+	Assimp::Importer importer;
+	const aiScene* scene = importer.ReadFile(modelPath, aiProcess_Triangulate | aiProcess_FlipUVs);
+	if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
+		std::cerr << "failed to load " << modelPath << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	uint32_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+	std::cout << modelPath << " (" << scene->mNumMeshes << " meshes), " << iterations << " iterations" << std::endl;
+	std::cout << "threads\tms/iter\tMvertices/s\tspeedup" << std::endl;
+
+	double baseline = 0.0;
+	for (uint32_t threads = 1; threads <= maxThreads; threads++) {
+		ThreadPool pool(threads - 1);
+		MeshData meshData;
+
+		// 워밍업 (첫 할당 / 페이지 폴트 제외)
+		buildMeshData(scene, meshData, &pool);
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			buildMeshData(scene, meshData, &pool);
+		}
+		auto endTime = std::chrono::high_resolution_clock::now();
+
+		double seconds = std::chrono::duration<double>(endTime - startTime).count() / iterations;
+		double verticesPerSecond = meshData.vertices.size() / seconds;
+		if (threads == 1) {
+			baseline = seconds;
+		}
+		std::cout << threads << "\t" << seconds * 1000.0 << "\t" << verticesPerSecond / 1e6 << "\t" << baseline / seconds << "x" << std::endl;
+	}
+	return EXIT_SUCCESS;
+}
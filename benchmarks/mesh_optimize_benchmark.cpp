@@ -0,0 +1,59 @@
+#include "mesh_optimize.h"
+#include "mesh_weld.h"
+#include "model_loader.h"
+#include "thread_pool.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+
+/*
+	[인덱스 최적화 벤치마크]
+	GPU 없이 FIFO 캐시 시뮬레이션만으로 단계별 ACMR / ATVR 와 처리 시간을 출력한다. (CI 회귀 추적용)
+	사용법: mesh_optimize_benchmark [모델 경로]
+*/
+namespace {
+
+void runStage(const char* name, MeshData& meshData, const std::function<void()>& stage) {
+	auto startTime = std::chrono::high_resolution_clock::now();
+	stage();
+	auto endTime = std::chrono::high_resolution_clock::now();
+
+	VertexCacheStats stats = analyzeVertexCache(meshData);
+	std::cout << name << "\t" << stats.acmr << "\t" << stats.atvr << "\t"
+			  << std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count() << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	std::string modelPath = argc > 1 ? argv[1] : "models/viking_room.obj";
+
+	Assimp::Importer importer;
+	const aiScene* scene = importer.ReadFile(modelPath, aiProcess_Triangulate | aiProcess_FlipUVs);
+	if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
+		std::cerr << "failed to load " << modelPath << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	ThreadPool pool;
+	MeshData meshData;
+	buildMeshData(scene, meshData, &pool);
+	weldVertices(meshData, 0.0f, &pool);
+
+	std::cout << modelPath << " (" << meshData.vertices.size() << " vertices, " << meshData.indices.size() / 3
+			  << " triangles, cache " << VERTEX_CACHE_SIZE << ")" << std::endl;
+	std::cout << "stage\tACMR\tATVR\tms" << std::endl;
+
+	runStage("original", meshData, []() {});
+	runStage("tipsify", meshData, [&]() { optimizeVertexCache(meshData, &pool); });
+	runStage("overdraw", meshData, [&]() { optimizeOverdraw(meshData, 1.05f, &pool); });
+	runStage("fetch", meshData, [&]() { optimizeVertexFetch(meshData, &pool); });
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,142 @@
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "mesh_meshlet.h"
+#include "model_loader.h"
+#include "thread_pool.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+/*
+	[메시렛 컬링 벤치마크]
+	1. 메시렛 생성 전후로 서브 메시별 삼각형 집합이 같은지 확인 (모든 삼각형이 정확히 한 메시렛에 들어갔는지)
+	2. 모델 주위를 도는 카메라로 프레임마다 컬링해서 frustum / backface 로 제외된 삼각형 수와 컬링 시간 출력
+	사용법: meshlet_cull_benchmark [모델 경로]
+*/
+namespace {
+
+const uint32_t ORBIT_FRAMES = 360;
+
+typedef std::array<uint32_t, 3> Triangle;
+
+// 서브 메시 삼각형 목록 (정점 순서를 회전해서 가장 작은 인덱스가 앞에 오도록 맞춘 뒤 정렬)
+std::vector<Triangle> collectTriangles(const MeshData& meshData, const SubMesh& subMesh) {
+	std::vector<Triangle> triangles;
+	for (uint32_t i = 0; i < subMesh.indexCount; i += 3) {
+		Triangle triangle;
+		for (uint32_t k = 0; k < 3; k++) {
+			uint32_t index = subMesh.firstIndex + i + k;
+			triangle[k] = subMesh.indexType == VK_INDEX_TYPE_UINT16 ? meshData.gpuIndices16[index] : meshData.gpuIndices32[index];
+		}
+		std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+		triangles.push_back(triangle);
+	}
+	std::sort(triangles.begin(), triangles.end());
+	return triangles;
+}
+
+// 카메라 궤도 1 바퀴 컬링 결과 출력
+void runOrbit(const char* name, const MeshData& meshData, const glm::vec3& target, float distance, float height) {
+	glm::mat4 model(1.0f);
+	glm::mat4 proj = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, distance * 4.0f);
+	proj[1][1] *= -1;
+
+	std::vector<MeshletDraw> draws;
+	uint64_t triangles = 0;
+	uint64_t frustumCulled = 0;
+	uint64_t backfaceCulled = 0;
+	uint64_t drawCount = 0;
+	float cullTime = 0.0f;
+	for (uint32_t frame = 0; frame < ORBIT_FRAMES; frame++) {
+		float angle = glm::radians(360.0f * frame / ORBIT_FRAMES);
+		glm::vec3 eye = target + glm::vec3(std::cos(angle) * distance, std::sin(angle) * distance, height);
+		glm::mat4 view = glm::lookAt(eye, target, glm::vec3(0.0f, 0.0f, 1.0f));
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		MeshletCullParams params = makeMeshletCullParams(model, view, proj);
+		MeshletCullStats stats = cullMeshlets(meshData.subMeshes.data(), static_cast<uint32_t>(meshData.subMeshes.size()),
+											  meshData.meshlets.data(), params, draws);
+		auto endTime = std::chrono::high_resolution_clock::now();
+
+		cullTime += std::chrono::duration<float, std::chrono::microseconds::period>(endTime - startTime).count();
+		triangles += stats.triangleCount;
+		frustumCulled += stats.frustumCulledTriangles;
+		backfaceCulled += stats.backfaceCulledTriangles;
+		drawCount += stats.drawCount;
+	}
+
+	float culled = triangles > 0 ? 100.0f * (frustumCulled + backfaceCulled) / triangles : 0.0f;
+	std::cout << name << "\t" << triangles / ORBIT_FRAMES << "\t" << frustumCulled / ORBIT_FRAMES << "\t" << backfaceCulled / ORBIT_FRAMES
+			  << "\t" << culled << "\t" << static_cast<float>(drawCount) / ORBIT_FRAMES << "\t" << cullTime / ORBIT_FRAMES << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	std::string modelPath = argc > 1 ? argv[1] : "models/viking_room.obj";
+
+	Assimp::Importer importer;
+	const aiScene* scene = importer.ReadFile(modelPath, aiProcess_Triangulate | aiProcess_FlipUVs);
+	if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
+		std::cerr << "failed to load " << modelPath << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// 메시렛 전 단계까지 후처리
+	ThreadPool pool;
+	MeshData meshData;
+	MeshProcessOptions options;
+	options.flags = MESH_PROCESS_WELD_VERTICES | MESH_PROCESS_VERTEX_CACHE | MESH_PROCESS_OVERDRAW | MESH_PROCESS_VERTEX_FETCH;
+	buildMeshData(scene, meshData, &pool);
+	processMeshData(meshData, options, &pool);
+
+	std::vector<std::vector<Triangle>> reference;
+	for (const SubMesh& subMesh : meshData.subMeshes) {
+		reference.push_back(collectTriangles(meshData, subMesh));
+	}
+
+	auto startTime = std::chrono::high_resolution_clock::now();
+	MeshletStats stats = buildMeshlets(meshData, &pool);
+	auto endTime = std::chrono::high_resolution_clock::now();
+
+	// 1. 메시렛 검사 (구간 / 제한 / 바운딩 구 + 삼각형 집합 보존)
+	bool covered = validateMeshlets(meshData);
+	for (size_t i = 0; covered && i < meshData.subMeshes.size(); i++) {
+		covered = collectTriangles(meshData, meshData.subMeshes[i]) == reference[i];
+	}
+	std::cout << modelPath << " (" << stats.meshletCount << " meshlets, average " << stats.averageVertices << " vertices / "
+			  << stats.averageTriangles << " triangles, " << stats.coneMeshletCount << " with cone, build "
+			  << std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count() << " ms)" << std::endl;
+	std::cout << "coverage: " << (covered ? "ok" : "FAILED") << std::endl;
+	if (!covered) {
+		return EXIT_FAILURE;
+	}
+
+	// 2. 모델 바운딩 박스 중심을 도는 카메라 (먼 궤도: 모델 전체가 보임 / 가까운 궤도: 일부가 frustum 밖)
+	glm::vec3 minPos(std::numeric_limits<float>::max());
+	glm::vec3 maxPos(-std::numeric_limits<float>::max());
+	for (const Vertex& vertex : meshData.vertices) {
+		minPos = glm::min(minPos, vertex.pos);
+		maxPos = glm::max(maxPos, vertex.pos);
+	}
+	glm::vec3 center = (minPos + maxPos) * 0.5f;
+	float radius = glm::length(maxPos - minPos) * 0.5f;
+
+	std::cout << "orbit\ttriangles\tfrustum\tbackface\tculled %\tdraws\tus/frame" << std::endl;
+	runOrbit("far", meshData, center, radius * 3.0f, radius);
+	runOrbit("near", meshData, center, radius * 0.6f, radius * 0.3f);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,142 @@
+#include "texture_mip.h"
+#include "thread_pool.h"
+
+#include <stb/stb_image.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+	[밉맵 생성 벤치마크]
+	CPU 밉 체인 생성 시간 (box / Kaiser, 1 스레드 / 전체 스레드) 을 측정하고
+	레벨별 품질을 double 정밀도 선형 공간 면적 평균 기준 영상과의 PSNR 로 비교한다.
+	비교용으로 sRGB 값을 그대로 평균내는 기존 blit 방식 (감마 무시) 의 PSNR 도 함께 출력
+	1 스레드 / 전체 스레드 결과가 비트 단위로 같지 않으면 실패
+	사용법: mip_benchmark [텍스처 경로] [반복 횟수]
+*/
+namespace {
+
+float elapsedMilliseconds(std::chrono::high_resolution_clock::time_point startTime) {
+	auto endTime = std::chrono::high_resolution_clock::now();
+	return std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+}
+
+double srgbToLinear(double value) {
+	return value <= 0.04045 ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4);
+}
+
+double linearToSrgb(double value) {
+	value = std::min(std::max(value, 0.0), 1.0);
+	return value <= 0.0031308 ? value * 12.92 : 1.055 * std::pow(value, 1.0 / 2.4) - 0.055;
+}
+
+// 레벨 0 에서 바로 면적 평균한 기준 밉 레벨 (linear 가 false 면 sRGB 값을 그대로 평균)
+std::vector<uint8_t> referenceLevel(const uint8_t* pixels, uint32_t width, uint32_t height, const MipLevel& level, bool linear) {
+	std::vector<uint8_t> result(level.size);
+	double scaleX = static_cast<double>(width) / level.width;
+	double scaleY = static_cast<double>(height) / level.height;
+	for (uint32_t y = 0; y < level.height; y++) {
+		for (uint32_t x = 0; x < level.width; x++) {
+			double x0 = x * scaleX, x1 = std::min(x0 + scaleX, static_cast<double>(width));
+			double y0 = y * scaleY, y1 = std::min(y0 + scaleY, static_cast<double>(height));
+			double sum[4] = {};
+			for (uint32_t sy = static_cast<uint32_t>(y0); sy < std::ceil(y1); sy++) {
+				double wy = std::min(sy + 1.0, y1) - std::max(static_cast<double>(sy), y0);
+				for (uint32_t sx = static_cast<uint32_t>(x0); sx < std::ceil(x1); sx++) {
+					double w = wy * (std::min(sx + 1.0, x1) - std::max(static_cast<double>(sx), x0));
+					const uint8_t* p = pixels + (size_t(sy) * width + sx) * 4;
+					for (uint32_t c = 0; c < 4; c++) {
+						double value = p[c] / 255.0;
+						sum[c] += w * (linear && c < 3 ? srgbToLinear(value) : value);
+					}
+				}
+			}
+			uint8_t* out = result.data() + (size_t(y) * level.width + x) * 4;
+			for (uint32_t c = 0; c < 4; c++) {
+				double value = sum[c] / ((x1 - x0) * (y1 - y0));
+				out[c] = static_cast<uint8_t>(std::lround((linear && c < 3 ? linearToSrgb(value) : value) * 255.0));
+			}
+		}
+	}
+	return result;
+}
+
+// 8bit 영상 PSNR (dB, 같으면 99)
+double psnr(const uint8_t* a, const uint8_t* b, size_t size) {
+	double error = 0.0;
+	for (size_t i = 0; i < size; i++) {
+		double d = static_cast<double>(a[i]) - b[i];
+		error += d * d;
+	}
+	if (error == 0.0) {
+		return 99.0;
+	}
+	return 10.0 * std::log10(255.0 * 255.0 * size / error);
+}
+
+// 필터 1 개 시간 측정 (최소 시간) + 1 스레드 / 전체 스레드 결과 비교
+bool runFilter(const char* name, MipFilter filter, const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t iterations, ThreadPool& pool, MipChain& chain) {
+	float serialTime = 1e30f;
+	float parallelTime = 1e30f;
+	MipChain serial;
+	for (uint32_t i = 0; i < iterations; i++) {
+		auto startTime = std::chrono::high_resolution_clock::now();
+		buildMipChain(pixels, width, height, filter, serial, nullptr);
+		serialTime = std::min(serialTime, elapsedMilliseconds(startTime));
+
+		startTime = std::chrono::high_resolution_clock::now();
+		buildMipChain(pixels, width, height, filter, chain, &pool);
+		parallelTime = std::min(parallelTime, elapsedMilliseconds(startTime));
+	}
+
+	bool match = serial.pixels == chain.pixels;
+	std::cout << "  " << name << " 1 thread   " << serialTime << " ms" << std::endl;
+	std::cout << "  " << name << " " << pool.threadCount() << " threads  " << parallelTime << " ms (" << serialTime / parallelTime << "x)" << std::endl;
+	std::cout << "  " << name << " match: " << (match ? "ok" : "FAILED") << std::endl;
+	return match;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	std::string texturePath = argc > 1 ? argv[1] : "textures/viking_room.png";
+	uint32_t iterations = argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 5;
+
+	int texWidth, texHeight, texChannels;
+	stbi_uc* pixels = stbi_load(texturePath.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+	if (!pixels) {
+		std::cerr << "failed to load " << texturePath << std::endl;
+		return EXIT_FAILURE;
+	}
+	uint32_t width = static_cast<uint32_t>(texWidth);
+	uint32_t height = static_cast<uint32_t>(texHeight);
+	std::cout << texturePath << " (" << width << "x" << height << ", " << mipLevelCount(width, height) << " levels)" << std::endl;
+
+	ThreadPool pool;
+	MipChain box;
+	MipChain kaiser;
+	bool ok = runFilter("box   ", MIP_FILTER_BOX, pixels, width, height, iterations, pool, box);
+	ok = runFilter("kaiser", MIP_FILTER_KAISER, pixels, width, height, iterations, pool, kaiser) && ok;
+
+	// 레벨별 PSNR (기준: 선형 공간 면적 평균)
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "  level  size        box     kaiser  srgb-average (dB)" << std::endl;
+	for (uint32_t i = 1; i < box.levels.size(); i++) {
+		const MipLevel& level = box.levels[i];
+		std::vector<uint8_t> reference = referenceLevel(pixels, width, height, level, true);
+		std::vector<uint8_t> naive = referenceLevel(pixels, width, height, level, false);
+		std::cout << "  " << std::setw(5) << i << "  " << std::setw(4) << level.width << "x" << std::setw(4) << std::left << level.height << std::right
+				  << "  " << std::setw(6) << psnr(reference.data(), box.pixels.data() + level.offset, level.size)
+				  << "  " << std::setw(6) << psnr(reference.data(), kaiser.pixels.data() + level.offset, level.size)
+				  << "  " << std::setw(6) << psnr(reference.data(), naive.data(), level.size) << std::endl;
+	}
+
+	stbi_image_free(pixels);
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
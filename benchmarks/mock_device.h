@@ -0,0 +1,105 @@
+#pragma once
+
+#include "gpu_allocator.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <unordered_map>
+
+/*
+	[벤치마크 공용 가짜 장치 메모리]
+	vkAllocateMemory / vkMapMemory 를 호스트 메모리로 흉내내서 GpuAllocator 를 GPU 없이 돌린다.
+	1. mockMemory.properties 의 힙 크기를 넘으면 VK_ERROR_OUT_OF_DEVICE_MEMORY 반환
+	2. 같은 메모리를 두 번 매핑 / 모르는 메모리 해제 / 매핑하지 않은 메모리 해제 요청은 errors 로 집계
+	벤치마크는 mockMemory.properties 를 채운 뒤 mockAllocatorFunctions() 로 GpuAllocator 를 초기화
+*/
+
+// 가짜 장치 메모리 1 개
+struct MockMemory {
+	uint8_t* data;
+	VkDeviceSize size;
+	uint32_t heap;
+	bool mapped;
+};
+
+struct MockMemoryDevice {
+	VkPhysicalDeviceMemoryProperties properties{};
+	std::unordered_map<VkDeviceMemory, MockMemory> memories;
+	VkDeviceSize heapUsage[VK_MAX_MEMORY_HEAPS] = {};
+	uint32_t errors = 0;
+};
+
+inline MockMemoryDevice mockMemory;
+
+inline VKAPI_ATTR VkResult VKAPI_CALL mockAllocateMemory(VkDevice, const VkMemoryAllocateInfo* allocInfo, const VkAllocationCallbacks*, VkDeviceMemory* memory) {
+	uint32_t heap = mockMemory.properties.memoryTypes[allocInfo->memoryTypeIndex].heapIndex;
+	if (mockMemory.heapUsage[heap] + allocInfo->allocationSize > mockMemory.properties.memoryHeaps[heap].size) {
+		return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+	}
+	// 실제로 쓰는 페이지만 잡히도록 malloc (calloc 은 0 채우기 비용)
+	uint8_t* data = static_cast<uint8_t*>(malloc(allocInfo->allocationSize));
+	if (!data) {
+		return VK_ERROR_OUT_OF_HOST_MEMORY;
+	}
+	*memory = reinterpret_cast<VkDeviceMemory>(data);
+	mockMemory.memories[*memory] = {data, allocInfo->allocationSize, heap, false};
+	mockMemory.heapUsage[heap] += allocInfo->allocationSize;
+	return VK_SUCCESS;
+}
+
+inline VKAPI_ATTR void VKAPI_CALL mockFreeMemory(VkDevice, VkDeviceMemory memory, const VkAllocationCallbacks*) {
+	auto it = mockMemory.memories.find(memory);
+	if (it == mockMemory.memories.end()) {
+		mockMemory.errors++;
+		return;
+	}
+	mockMemory.heapUsage[it->second.heap] -= it->second.size;
+	free(it->second.data);
+	mockMemory.memories.erase(it);
+}
+
+inline VKAPI_ATTR VkResult VKAPI_CALL mockMapMemory(VkDevice, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize, VkMemoryMapFlags, void** data) {
+	auto it = mockMemory.memories.find(memory);
+	if (it == mockMemory.memories.end() || it->second.mapped) {
+		mockMemory.errors++;
+		return VK_ERROR_MEMORY_MAP_FAILED;
+	}
+	it->second.mapped = true;
+	*data = it->second.data + offset;
+	return VK_SUCCESS;
+}
+
+inline VKAPI_ATTR void VKAPI_CALL mockUnmapMemory(VkDevice, VkDeviceMemory memory) {
+	auto it = mockMemory.memories.find(memory);
+	if (it == mockMemory.memories.end() || !it->second.mapped) {
+		mockMemory.errors++;
+		return;
+	}
+	it->second.mapped = false;
+}
+
+inline GpuAllocatorFunctions mockAllocatorFunctions() {
+	GpuAllocatorFunctions functions;
+	functions.allocateMemory = mockAllocateMemory;
+	functions.freeMemory = mockFreeMemory;
+	functions.mapMemory = mockMapMemory;
+	functions.unmapMemory = mockUnmapMemory;
+	return functions;
+}
+
+// 힙 / 메모리 타입 1 개 (host visible + coherent) 인 장치
+inline void setupMockHostMemory() {
+	VkPhysicalDeviceMemoryProperties& properties = mockMemory.properties;
+	properties.memoryHeapCount = 1;
+	properties.memoryHeaps[0] = {16ull * 1024 * 1024 * 1024, 0};
+	properties.memoryTypeCount = 1;
+	properties.memoryTypes[0] = {VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 0};
+}
+
+// 검사 실패시 예외 (벤치마크 main 에서 잡아서 EXIT_FAILURE)
+inline void check(bool condition, const char* message) {
+	if (!condition) {
+		throw std::runtime_error(message);
+	}
+}
@@ -0,0 +1,146 @@
+#include "model_loader.h"
+#include "obj_loader.h"
+#include "thread_pool.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+	[OBJ 임포트 벤치마크]
+	Assimp (ReadFile + buildMeshData) 와 네이티브 OBJ 로더 (1 스레드 / 전체 스레드) 시간을 비교하고
+	두 결과의 정점 / 인덱스 / 서브 메시가 비트 단위로 같은지 확인한다.
+	모델 파일과 지정한 삼각형 수의 합성 격자 OBJ 두 가지로 측정
+	사용법: obj_import_benchmark [모델 경로] [합성 삼각형 수]
+*/
+namespace {
+
+const char* const SYNTHETIC_PATH = "obj_import_benchmark_synthetic.obj";
+
+float elapsedMilliseconds(std::chrono::high_resolution_clock::time_point startTime) {
+	auto endTime = std::chrono::high_resolution_clock::now();
+	return std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+}
+
+// 정사각형 격자 OBJ 생성 (v / vt / f v/vt 형식, 삼각형 수는 triangleCount 이상)
+void writeSyntheticObj(const std::string& path, uint64_t triangleCount) {
+	uint32_t side = static_cast<uint32_t>(std::ceil(std::sqrt(triangleCount / 2.0)));
+	std::ofstream out(path, std::ios::binary);
+	std::vector<char> buffer(1 << 20);
+	size_t used = 0;
+	auto flush = [&]() {
+		out.write(buffer.data(), used);
+		used = 0;
+	};
+	auto append = [&](const char* format, auto... args) {
+		if (used + 128 > buffer.size()) {
+			flush();
+		}
+		used += std::snprintf(buffer.data() + used, buffer.size() - used, format, args...);
+	};
+
+	append("mtllib synthetic.mtl\no grid\nusemtl grid\n");
+	for (uint32_t y = 0; y <= side; y++) {
+		for (uint32_t x = 0; x <= side; x++) {
+			float u = static_cast<float>(x) / side;
+			float v = static_cast<float>(y) / side;
+			append("v %.6f %.6f %.6f\n", u * 2.0f - 1.0f, v * 2.0f - 1.0f, 0.1f * std::sin(u * 20.0f) * std::cos(v * 20.0f));
+		}
+	}
+	for (uint32_t y = 0; y <= side; y++) {
+		for (uint32_t x = 0; x <= side; x++) {
+			append("vt %.6f %.6f\n", static_cast<float>(x) / side, static_cast<float>(y) / side);
+		}
+	}
+	for (uint32_t y = 0; y < side; y++) {
+		for (uint32_t x = 0; x < side; x++) {
+			uint32_t i0 = y * (side + 1) + x + 1;
+			uint32_t i1 = i0 + 1;
+			uint32_t i2 = i0 + side + 1;
+			uint32_t i3 = i2 + 1;
+			append("f %u/%u %u/%u %u/%u\n", i0, i0, i1, i1, i3, i3);
+			append("f %u/%u %u/%u %u/%u\n", i0, i0, i3, i3, i2, i2);
+		}
+	}
+	flush();
+}
+
+// 두 MeshData 의 정점 / 인덱스 / 서브 메시 구간이 같은지
+bool sameMeshData(const MeshData& a, const MeshData& b) {
+	if (a.vertices.size() != b.vertices.size() || a.indices != b.indices || a.subMeshes.size() != b.subMeshes.size()) {
+		return false;
+	}
+	if (!a.vertices.empty() && memcmp(a.vertices.data(), b.vertices.data(), a.vertices.size() * sizeof(Vertex)) != 0) {
+		return false;
+	}
+	for (size_t i = 0; i < a.subMeshes.size(); i++) {
+		const SubMesh& sa = a.subMeshes[i];
+		const SubMesh& sb = b.subMeshes[i];
+		if (sa.baseVertex != sb.baseVertex || sa.vertexCount != sb.vertexCount || sa.firstIndex != sb.firstIndex
+			|| sa.indexCount != sb.indexCount || sa.materialIndex != sb.materialIndex) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// 파일 1 개에 대해 Assimp / 네이티브 시간 측정 + 결과 비교
+bool runBenchmark(const std::string& path) {
+	auto startTime = std::chrono::high_resolution_clock::now();
+	MeshData reference;
+	{
+		Assimp::Importer importer;
+		const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs);
+		if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
+			std::cerr << "failed to load " << path << std::endl;
+			return false;
+		}
+		ThreadPool pool;
+		buildMeshData(scene, reference, &pool);
+	}
+	float assimpTime = elapsedMilliseconds(startTime);
+
+	MeshData serial;
+	startTime = std::chrono::high_resolution_clock::now();
+	loadObj(path, serial, nullptr);
+	float serialTime = elapsedMilliseconds(startTime);
+
+	ThreadPool pool;
+	MeshData parallel;
+	startTime = std::chrono::high_resolution_clock::now();
+	loadObj(path, parallel, &pool);
+	float parallelTime = elapsedMilliseconds(startTime);
+
+	bool match = sameMeshData(reference, serial) && sameMeshData(reference, parallel);
+	std::cout << path << " (" << reference.indices.size() / 3 << " triangles, " << reference.subMeshes.size() << " meshes)" << std::endl;
+	std::cout << "  assimp            " << assimpTime << " ms" << std::endl;
+	std::cout << "  native 1 thread   " << serialTime << " ms (" << assimpTime / serialTime << "x)" << std::endl;
+	std::cout << "  native " << pool.threadCount() << " threads  " << parallelTime << " ms (" << assimpTime / parallelTime << "x)" << std::endl;
+	std::cout << "  match: " << (match ? "ok" : "FAILED") << std::endl;
+	return match;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	std::string modelPath = argc > 1 ? argv[1] : "models/viking_room.obj";
+	uint64_t syntheticTriangles = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10000000;
+
+	bool ok = runBenchmark(modelPath);
+	if (syntheticTriangles > 0) {
+		writeSyntheticObj(SYNTHETIC_PATH, syntheticTriangles);
+		ok = runBenchmark(SYNTHETIC_PATH) && ok;
+		std::remove(SYNTHETIC_PATH);
+	}
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,185 @@
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "mesh_meshlet.h"
+#include "scene_bvh.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/*
+	[장면 BVH 컬링 벤치마크]
+	정육면체 공간에 무작위로 흩어진 물체 AABB 위에 BVH 를 만들고 장면 가운데를 도는 카메라로 컬링
+	1. 물체마다 평면을 검사하는 전수 컬링과 결과 비교 (평면 경계의 부동소수점 차이만 허용)
+	2. 물체 1 개당 컬링 시간 (BVH / 전수) 과 보이는 비율 출력
+	3. 프레임마다 물체 1 % 를 옮기고 refit 한 뒤 트리 검사 + 다시 비교 (옮긴 물체 1 개당 refit 시간)
+	사용법: scene_cull_benchmark [물체 수 ...] (기본 10000 100000 1000000)
+*/
+namespace {
+
+const uint32_t ORBIT_FRAMES = 32;
+const float OBJECT_SPACING = 4.0f;				// 물체 1 개가 차지하는 평균 공간 (한 변)
+const float MOVE_FRACTION = 0.01f;				// refit 프레임마다 옮기는 물체 비율
+const float PLANE_TOLERANCE = 1e-4f;			// 전수 컬링과 비교할 때 허용하는 평면 거리
+
+// 평면 6 개 중 AABB 의 가장 먼 꼭짓점까지 거리의 최솟값 (음수면 바깥)
+float frustumDistance(const glm::vec4 frustumPlanes[6], const SceneAabb& box) {
+	float distance = INFINITY;
+	for (int p = 0; p < 6; p++) {
+		const glm::vec4& plane = frustumPlanes[p];
+		glm::vec3 farCorner(plane.x >= 0.0f ? box.max.x : box.min.x, plane.y >= 0.0f ? box.max.y : box.min.y, plane.z >= 0.0f ? box.max.z : box.min.z);
+		distance = std::min(distance, glm::dot(glm::vec3(plane), farCorner) + plane.w);
+	}
+	return distance;
+}
+
+// BVH 결과가 전수 판정과 같은지 (경계 부근 물체는 어느 쪽이든 허용, 중복 없음)
+bool matchesReference(const glm::vec4 frustumPlanes[6], const std::vector<SceneAabb>& boxes, std::vector<uint32_t> visible) {
+	std::sort(visible.begin(), visible.end());
+	if (std::adjacent_find(visible.begin(), visible.end()) != visible.end()) {
+		return false;
+	}
+	size_t next = 0;
+	for (uint32_t i = 0; i < boxes.size(); i++) {
+		bool found = next < visible.size() && visible[next] == i;
+		next += found ? 1 : 0;
+		float distance = frustumDistance(frustumPlanes, boxes[i]);
+		if ((distance > PLANE_TOLERANCE && !found) || (distance < -PLANE_TOLERANCE && found)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+SceneAabb randomBox(std::mt19937& rng, float extent) {
+	std::uniform_real_distribution<float> position(-extent, extent);
+	std::uniform_real_distribution<float> size(0.25f, 1.5f);
+	glm::vec3 center(position(rng), position(rng), position(rng));
+	glm::vec3 half(size(rng), size(rng), size(rng));
+	return {center - half, center + half};
+}
+
+// 장면 가운데를 도는 카메라의 frame 번째 frustum 평면
+MeshletCullParams orbitCamera(uint32_t frame, float extent) {
+	float angle = glm::radians(360.0f * frame / ORBIT_FRAMES);
+	glm::vec3 eye(std::cos(angle) * extent * 0.5f, std::sin(angle) * extent * 0.5f, extent * 0.25f);
+	glm::mat4 view = glm::lookAt(eye, glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+	glm::mat4 proj = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, extent * 2.0f);
+	proj[1][1] *= -1;
+	return makeMeshletCullParams(glm::mat4(1.0f), view, proj);
+}
+
+bool runScene(uint32_t objectCount) {
+	std::mt19937 rng(objectCount);
+	float extent = 0.5f * OBJECT_SPACING * std::cbrt(static_cast<float>(objectCount));
+	std::vector<SceneAabb> boxes(objectCount);
+	for (SceneAabb& box : boxes) {
+		box = randomBox(rng, extent);
+	}
+
+	SceneBvh bvh;
+	auto startTime = std::chrono::high_resolution_clock::now();
+	bvh.build(boxes.data(), objectCount);
+	float buildMs = std::chrono::duration<float, std::chrono::milliseconds::period>(std::chrono::high_resolution_clock::now() - startTime).count();
+	if (!bvh.validate()) {
+		std::cerr << "FAILED: invalid tree after build" << std::endl;
+		return false;
+	}
+
+	// 컬링: BVH / 전수 (같은 평면 판정)
+	std::vector<uint32_t> visible;
+	std::vector<uint32_t> bruteVisible;
+	double bvhSeconds = 0.0;
+	double bruteSeconds = 0.0;
+	uint64_t visibleTotal = 0;
+	uint64_t nodesVisited = 0;
+	for (uint32_t frame = 0; frame < ORBIT_FRAMES; frame++) {
+		MeshletCullParams camera = orbitCamera(frame, extent);
+
+		startTime = std::chrono::high_resolution_clock::now();
+		SceneCullStats stats = bvh.cull(camera.frustumPlanes, visible);
+		bvhSeconds += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+		startTime = std::chrono::high_resolution_clock::now();
+		bruteVisible.clear();
+		for (uint32_t i = 0; i < objectCount; i++) {
+			if (sceneAabbInFrustum(camera.frustumPlanes, boxes[i])) {
+				bruteVisible.push_back(i);
+			}
+		}
+		bruteSeconds += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+		if (!matchesReference(camera.frustumPlanes, boxes, visible)) {
+			std::cerr << "FAILED: BVH culling differs from brute force (frame " << frame << ")" << std::endl;
+			return false;
+		}
+		visibleTotal += stats.visibleObjects;
+		nodesVisited += stats.nodesVisited;
+	}
+
+	// refit: 프레임마다 물체 일부를 옮기고 바뀐 경로만 다시 계산
+	uint32_t moveCount = std::max(1u, static_cast<uint32_t>(objectCount * MOVE_FRACTION));
+	std::uniform_int_distribution<uint32_t> pick(0, objectCount - 1);
+	std::uniform_real_distribution<float> offset(-OBJECT_SPACING, OBJECT_SPACING);
+	double refitSeconds = 0.0;
+	uint64_t refitNodes = 0;
+	for (uint32_t frame = 0; frame < ORBIT_FRAMES; frame++) {
+		startTime = std::chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < moveCount; i++) {
+			uint32_t object = pick(rng);
+			glm::vec3 move(offset(rng), offset(rng), offset(rng));
+			boxes[object] = {boxes[object].min + move, boxes[object].max + move};
+			bvh.updateObject(object, boxes[object]);
+		}
+		refitNodes += bvh.refit();
+		refitSeconds += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+	}
+	MeshletCullParams camera = orbitCamera(0, extent);
+	bvh.cull(camera.frustumPlanes, visible);
+	if (!bvh.validate() || !matchesReference(camera.frustumPlanes, boxes, visible)) {
+		std::cerr << "FAILED: BVH culling is wrong after refit" << std::endl;
+		return false;
+	}
+
+	double culls = static_cast<double>(objectCount) * ORBIT_FRAMES;
+	std::cout << objectCount << "\t" << bvh.nodeCount() << "\t" << buildMs << "\t"
+			  << 100.0 * visibleTotal / culls << "\t" << static_cast<double>(nodesVisited) / ORBIT_FRAMES << "\t"
+			  << bvhSeconds * 1e9 / culls << "\t" << bruteSeconds * 1e9 / culls << "\t"
+			  << refitSeconds * 1e9 / (static_cast<double>(moveCount) * ORBIT_FRAMES) << "\t" << static_cast<double>(refitNodes) / ORBIT_FRAMES << std::endl;
+	return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	std::vector<uint32_t> objectCounts;
+	for (int i = 1; i < argc; i++) {
+		objectCounts.push_back(static_cast<uint32_t>(std::strtoul(argv[i], nullptr, 10)));
+	}
+	if (objectCounts.empty()) {
+		objectCounts = {10000, 100000, 1000000};
+	}
+
+#if defined(__AVX__)
+	const char* simd = "AVX";
+#elif defined(_M_X64) || defined(__SSE2__)
+	const char* simd = "SSE";
+#else
+	const char* simd = "scalar";
+#endif
+	std::cout << "BVH width " << SCENE_BVH_WIDTH << " (" << simd << "), " << ORBIT_FRAMES << " frames, " << MOVE_FRACTION * 100.0f << " % moved per refit" << std::endl;
+	std::cout << "objects\tnodes\tbuild ms\tvisible %\tnodes/frame\tBVH ns/object\tbrute ns/object\trefit ns/moved\trefit nodes/frame" << std::endl;
+	for (uint32_t objectCount : objectCounts) {
+		if (objectCount == 0 || !runScene(objectCount)) {
+			return EXIT_FAILURE;
+		}
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,139 @@
+#include "model_loader.h"
+#include "texture_loader.h"
+#include "thread_pool.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+
+#include <stb/stb_image.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+	[텍스처 디코딩 벤치마크]
+	재질 텍스처가 많은 장면을 가정하고 이미지 디코딩 처리량 (RGBA8 출력 MB/s) 을 스레드 수별로 측정한다.
+	1. 기준: 기존 방식 (호출 스레드에서 stbi_load 후 스테이징 영역으로 memcpy)
+	2. decodeTextureImages 를 1, 2, 4 ... 스레드로 실행 (이미지마다 스테이징 위치에 바로 디코딩)
+	모든 결과가 기준과 비트 단위로 같지 않으면 실패
+	입력이 모델 파일이면 재질의 diffuse 텍스처를, 이미지면 그 목록을 SCENE_TEXTURE_COUNT 개가 될 때까지 반복해서 사용
+	사용법: texture_decode_benchmark [모델 또는 이미지 경로...]
+*/
+namespace {
+
+const uint32_t SCENE_TEXTURE_COUNT = 32;
+const int RUN_COUNT = 3;
+
+float elapsedMilliseconds(std::chrono::high_resolution_clock::time_point startTime) {
+	auto endTime = std::chrono::high_resolution_clock::now();
+	return std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+}
+
+bool isImagePath(const std::string& path) {
+	int width, height, channels;
+	return stbi_info(path.c_str(), &width, &height, &channels) != 0;
+}
+
+// 입력 경로에서 디코딩할 이미지 목록 (모델은 재질 텍스처)
+std::vector<std::string> collectImages(const std::vector<std::string>& inputs) {
+	std::vector<std::string> images;
+	for (const std::string& input : inputs) {
+		if (isImagePath(input)) {
+			images.push_back(input);
+			continue;
+		}
+		Assimp::Importer importer;
+		const aiScene* scene = importer.ReadFile(input, 0);
+		if (!scene) {
+			std::cerr << "failed to load " << input << std::endl;
+			continue;
+		}
+		std::vector<std::string> textures;
+		collectMaterialTextures(scene, input, textures);
+		for (const std::string& texture : textures) {
+			if (isImagePath(texture)) {
+				images.push_back(texture);
+			}
+		}
+	}
+	return images;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	std::vector<std::string> inputs(argv + 1, argv + argc);
+	if (inputs.empty()) {
+		inputs = {"textures/viking_room.png", "textures/texture.png"};
+	}
+	std::vector<std::string> sources = collectImages(inputs);
+	if (sources.empty()) {
+		std::cerr << "no images to decode" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// 장면 텍스처 목록 (원본 이미지를 반복)
+	std::vector<TextureImage> images(std::max<size_t>(SCENE_TEXTURE_COUNT, sources.size()));
+	for (size_t i = 0; i < images.size(); i++) {
+		images[i].path = sources[i % sources.size()];
+	}
+	size_t stagingSize = probeTextureImages(images, nullptr);
+	float megabytes = stagingSize / (1024.0f * 1024.0f);
+	std::printf("%zu images (%zu unique), %.1f MB RGBA8\n", images.size(), sources.size(), megabytes);
+
+	// [기준] 호출 스레드에서 stbi_load + memcpy
+	std::vector<uint8_t> reference(stagingSize);
+	float baseTime = 1e30f;
+	for (int run = 0; run < RUN_COUNT; run++) {
+		auto startTime = std::chrono::high_resolution_clock::now();
+		for (const TextureImage& image : images) {
+			int width, height, channels;
+			stbi_uc* pixels = stbi_load(image.path.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+			if (!pixels) {
+				std::cerr << "failed to load " << image.path << std::endl;
+				return EXIT_FAILURE;
+			}
+			memcpy(reference.data() + image.offset, pixels, image.size);
+			stbi_image_free(pixels);
+		}
+		baseTime = std::min(baseTime, elapsedMilliseconds(startTime));
+	}
+	std::printf("  %-22s %8.1f ms %8.1f MB/s\n", "stbi_load + memcpy", baseTime, megabytes / (baseTime / 1000.0f));
+
+	// [병렬] 스레드 수별 (워커 + 호출 스레드)
+	uint32_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+	std::vector<uint32_t> threadCounts;
+	for (uint32_t threads = 1; threads < maxThreads; threads *= 2) {
+		threadCounts.push_back(threads);
+	}
+	threadCounts.push_back(maxThreads);
+
+	bool identical = true;
+	std::vector<uint8_t> staging(stagingSize);
+	for (uint32_t threads : threadCounts) {
+		ThreadPool pool(threads - 1);
+		float bestTime = 1e30f;
+		uint32_t inPlace = 0;
+		for (int run = 0; run < RUN_COUNT; run++) {
+			memset(staging.data(), 0, staging.size());
+			auto startTime = std::chrono::high_resolution_clock::now();
+			inPlace = decodeTextureImages(images, staging.data(), &pool);
+			bestTime = std::min(bestTime, elapsedMilliseconds(startTime));
+			identical = identical && memcmp(staging.data(), reference.data(), stagingSize) == 0;
+		}
+		char name[32];
+		std::snprintf(name, sizeof(name), "decode %u threads", threads);
+		std::printf("  %-22s %8.1f ms %8.1f MB/s (%.2fx, %u / %zu in place)\n", name, bestTime, megabytes / (bestTime / 1000.0f),
+					baseTime / bestTime, inPlace, images.size());
+	}
+
+	std::printf("  output %s\n", identical ? "identical" : "MISMATCH");
+	return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,250 @@
+#include "mock_device.h"
+#include "staging_ring.h"
+#include "upload_queue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+/*
+	[업로드 배치 벤치마크]
+	메시 / 텍스처가 많은 장면의 시작 업로드를 UploadQueue 와 같은 규칙으로 StagingRing 에 배치하고
+	리소스마다 제출 + vkQueueWaitIdle 하던 방식과 GPU 왕복 수를 비교한다. (GPU 는 흉내만 냄)
+	1. 배치는 UPLOAD_BATCH_COUNT 개까지 제출 상태로 둠, GPU 는 제출 후 GPU_LAG 번 더 제출하면 끝난 것으로 처리
+	2. 링이 가득 차면 기록 중인 배치 제출 → 끝난 배치 회수 → 그래도 없으면 가장 오래된 배치 대기 (CPU 대기)
+	3. 링보다 큰 업로드는 임시 스테이징 버퍼 (링을 쓰지 않음)
+	제출 중인 구간끼리 겹치지 않는지 / offset 정렬 / 회수 전 데이터가 그대로인지를 함께 검사
+	사용법: upload_batch_benchmark
+*/
+namespace {
+
+const size_t RING_SIZE = 16 * 1024 * 1024;		// UPLOAD_STAGING_SIZE
+const size_t COPY_ALIGNMENT = 16;				// BC 블록 크기
+const uint32_t GPU_LAG = 2;
+const uint32_t MESH_COUNT = 2000;
+const uint32_t TEXTURE_COUNT = 500;
+const int RUN_COUNT = 5;
+
+struct Upload {
+	size_t size;
+	bool image;
+};
+
+// 링 구간 1 개 (검사용)
+struct LiveSpan {
+	uint64_t batch;
+	size_t offset;
+	size_t size;
+	uint8_t tag;
+};
+
+struct BatchResult {
+	uint64_t batches = 0;
+	uint64_t waits = 0;
+	uint64_t tempBuffers = 0;
+	size_t peakUsed = 0;
+};
+
+// 메시 (정점 + 인덱스 버퍼 2 개) 4 KB ~ 2 MB, 텍스처 64 KB ~ 8 MB (일부는 링보다 큼)
+std::vector<Upload> makeScene() {
+	std::mt19937 rng(11);
+	std::vector<Upload> uploads;
+	for (uint32_t i = 0; i < MESH_COUNT; i++) {
+		size_t vertexSize = 4096 + rng() % (2 * 1024 * 1024);
+		uploads.push_back({vertexSize, false});
+		uploads.push_back({vertexSize / 3, false});
+	}
+	for (uint32_t i = 0; i < TEXTURE_COUNT; i++) {
+		size_t size = 64 * 1024 + rng() % (8 * 1024 * 1024);
+		if (i % 50 == 0) {
+			size = RING_SIZE + 1024 * 1024;
+		}
+		uploads.push_back({size, true});
+	}
+	std::shuffle(uploads.begin(), uploads.end(), rng);
+	return uploads;
+}
+
+// 리소스마다 제출 + 대기 (버퍼 복사 1 번, 이미지는 전환 / 복사 / 전환 3 번)
+uint64_t perResourceRoundTrips(const std::vector<Upload>& uploads) {
+	uint64_t roundTrips = 0;
+	for (const Upload& upload : uploads) {
+		roundTrips += upload.image ? 3 : 1;
+	}
+	return roundTrips;
+}
+
+/*
+	UploadQueue::stage / beginBatch / reclaim 과 같은 순서로 링 할당
+	memory 가 있으면 구간마다 tag 로 채우고 회수할 때 덮어쓰이지 않았는지 검사
+*/
+BatchResult runBatched(const std::vector<Upload>& uploads, uint8_t* memory) {
+	StagingRing ring;
+	ring.init(RING_SIZE, COPY_ALIGNMENT);
+
+	BatchResult result;
+	std::deque<uint64_t> submitted;		// 제출한 배치 (오래된 순)
+	std::deque<LiveSpan> live;
+	uint64_t nextBatch = 1;
+	uint64_t completed = 0;
+	bool recording = false;
+	uint8_t tag = 0;
+
+	auto flush = [&]() {
+		if (recording) {
+			submitted.push_back(nextBatch - 1);
+			recording = false;
+			result.batches++;
+		}
+	};
+	auto retire = [&](uint64_t batch) {
+		completed = batch;
+		while (!live.empty() && live.front().batch <= completed) {
+			const LiveSpan& span = live.front();
+			if (memory) {
+				for (size_t i = 0; i < span.size; i += 4096) {
+					check(memory[span.offset + i] == span.tag, "staging span was overwritten before its batch completed");
+				}
+			}
+			live.pop_front();
+		}
+		ring.retire(completed);
+	};
+	// GPU_LAG 번 뒤에 제출한 배치가 있으면 끝난 것, wait 이면 가장 오래된 배치 하나는 기다림
+	auto reclaim = [&](bool wait) {
+		while (!submitted.empty()) {
+			bool done = submitted.size() > GPU_LAG;
+			if (!done && !wait) {
+				break;
+			}
+			if (!done) {
+				result.waits++;
+			}
+			retire(submitted.front());
+			submitted.pop_front();
+			wait = false;
+		}
+	};
+	auto beginBatch = [&]() {
+		if (recording) {
+			return;
+		}
+		if (submitted.size() == UPLOAD_BATCH_COUNT) {
+			reclaim(true);
+		}
+		nextBatch++;
+		recording = true;
+	};
+
+	for (const Upload& upload : uploads) {
+		if (upload.size > ring.capacity()) {
+			beginBatch();
+			result.tempBuffers++;
+			continue;
+		}
+		size_t offset;
+		while (!ring.allocate(upload.size, recording ? nextBatch - 1 : nextBatch, offset)) {
+			flush();
+			uint64_t before = completed;
+			reclaim(false);
+			if (completed == before) {
+				reclaim(true);
+			}
+		}
+		beginBatch();
+		result.peakUsed = std::max(result.peakUsed, ring.usedBytes());
+
+		if (memory) {
+			check(offset % COPY_ALIGNMENT == 0, "staging offset is misaligned");
+			check(offset + upload.size <= RING_SIZE, "staging span is outside the ring");
+			for (const LiveSpan& span : live) {
+				check(offset + upload.size <= span.offset || span.offset + span.size <= offset, "staging span overlaps an in-flight span");
+			}
+			tag++;
+			for (size_t i = 0; i < upload.size; i += 4096) {
+				memory[offset + i] = tag;
+			}
+			live.push_back({nextBatch - 1, offset, upload.size, tag});
+		}
+	}
+	flush();
+	while (!submitted.empty()) {
+		reclaim(true);
+	}
+	check(ring.empty() && ring.usedBytes() == 0, "staging ring was not fully retired");
+	return result;
+}
+
+// 경계 조건: 딱 맞는 크기, 끝에서 처음으로 돌아가기, 링보다 큰 크기, 회수 후 재사용
+void validateRing() {
+	StagingRing ring;
+	ring.init(1024, 16);
+	size_t offset;
+	check(!ring.allocate(1025, 1, offset), "oversized allocation succeeded");
+	check(ring.allocate(1024, 1, offset) && offset == 0 && ring.usedBytes() == 1024, "full ring allocation failed");
+	check(!ring.allocate(1, 2, offset), "allocation from a full ring succeeded");
+	ring.retire(1);
+	check(ring.empty() && ring.usedBytes() == 0, "retired ring is not empty");
+
+	check(ring.allocate(600, 2, offset) && offset == 0, "first span has wrong offset");
+	check(ring.allocate(100, 3, offset) && offset == 608, "aligned span has wrong offset");
+	check(!ring.allocate(400, 4, offset), "allocation over an in-flight span succeeded");
+	ring.retire(2);
+	check(ring.allocate(400, 4, offset) && offset == 0, "ring did not wrap to the start");
+	check(!ring.allocate(300, 4, offset), "wrapped allocation overlapped the oldest span");
+	check(ring.allocate(200, 4, offset) && offset == 400, "wrapped span has wrong offset");
+	check(ring.usedBytes() == 1024 - 608 + 600, "wrapped usage is wrong");
+	ring.retire(4);
+	check(ring.empty(), "ring was not fully retired");
+	try {
+		ring.init(1024, 24);
+		check(false, "non power of two alignment was accepted");
+	} catch (const std::runtime_error&) {
+	}
+}
+
+} // namespace
+
+int main() {
+	std::vector<Upload> uploads = makeScene();
+	size_t totalBytes = 0;
+	for (const Upload& upload : uploads) {
+		totalBytes += upload.size;
+	}
+
+	BatchResult result;
+	try {
+		validateRing();
+		std::vector<uint8_t> memory(RING_SIZE);
+		result = runBatched(uploads, memory.data());
+	} catch (const std::exception& e) {
+		std::cerr << "FAILED: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	std::cout << "staging ring validation passed" << std::endl;
+
+	// 링 할당 비용 (검사 / 기록 없이)
+	double bestTime = 1e30;
+	for (int run = 0; run < RUN_COUNT; run++) {
+		auto startTime = std::chrono::high_resolution_clock::now();
+		runBatched(uploads, nullptr);
+		auto endTime = std::chrono::high_resolution_clock::now();
+		bestTime = std::min(bestTime, std::chrono::duration<double, std::nano>(endTime - startTime).count() / uploads.size());
+	}
+
+	uint64_t perResource = perResourceRoundTrips(uploads);
+	std::cout << uploads.size() << " uploads (" << MESH_COUNT << " meshes, " << TEXTURE_COUNT << " textures, " << totalBytes / (1024 * 1024) << " MB), "
+			  << RING_SIZE / (1024 * 1024) << " MB ring" << std::endl;
+	std::cout << "  per-resource  " << perResource << " submits, " << perResource << " queue idle waits" << std::endl;
+	std::cout << "  batched       " << result.batches << " submits, " << result.waits << " CPU waits, " << result.tempBuffers
+			  << " temporary staging buffers (ring peak " << result.peakUsed / 1024 << " KB)" << std::endl;
+	std::cout << "  round trips   " << static_cast<double>(perResource) / std::max<uint64_t>(result.waits, 1) << "x fewer CPU waits, "
+			  << bestTime << " ns per ring allocation" << std::endl;
+	return EXIT_SUCCESS;
+}
@@ -1,20 +1,41 @@
 #version 450
+#extension GL_GOOGLE_include_directive : require
 
 layout(binding = 0) uniform UniformBufferObject {
-    mat4 model;
     mat4 view;
     mat4 proj;
 } ubo;
 
-layout(location = 0) in vec3 inPosition;
-layout(location = 1) in vec3 inColor;
-layout(location = 2) in vec2 inTexCoord;
+// 인스턴스별 변환 / 머티리얼 번호 (GpuInstance, gl_InstanceIndex 로 접근)
+struct InstanceData {
+    mat4 model;
+    uvec4 material;
+};
+
+layout(std430, binding = 2) readonly buffer InstanceBuffer {
+    InstanceData instances[];
+};
+
+// 서브 메시별 정점 복원 변환 (VertexQuantization)
+layout(push_constant) uniform MeshConstants {
+    vec4 positionOffset;
+    vec4 positionScale;
+    vec4 texCoordTransform;
+} mesh;
+
+// 빌드 시 선택한 GpuVertex 레이아웃의 입력 선언 (vertex_layout_gen 이 생성)
+#include "vertex_input.glsl"
 
 layout(location = 0) out vec3 fragColor;
 layout(location = 1) out vec2 fragTexCoord;
 
 void main() {
-    gl_Position = ubo.proj * ubo.view * ubo.model * vec4(inPosition, 1.0);
+    vec3 position = inPosition * mesh.positionScale.xyz + mesh.positionOffset.xyz;
+    gl_Position = ubo.proj * ubo.view * instances[gl_InstanceIndex].model * vec4(position, 1.0);
+#ifdef VERTEX_INPUT_COLOR
     fragColor = inColor;
-    fragTexCoord = inTexCoord;
-}
\ No newline at end of file
+#else
+    fragColor = vec3(1.0);
+#endif
+    fragTexCoord = inTexCoord * mesh.texCoordTransform.zw + mesh.texCoordTransform.xy;
+}
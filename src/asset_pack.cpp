@@ -0,0 +1,189 @@
+#include "asset_pack.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+const uint32_t ASSET_PACK_MAGIC = 0x4B415041; // "APAK"
+
+// 팩 파일 맨 앞 헤더
+struct AssetPackHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t assetCount;
+	uint32_t nameTableSize;			// 인덱스 뒤에 오는 이름 문자열 전체 길이
+	uint64_t dataOffset;			// 첫 에셋 데이터 위치 (미리 읽기 시작 위치)
+	uint64_t fileSize;				// 잘린 파일 검출용 전체 크기
+};
+
+// 에셋 1 개의 인덱스
+struct AssetPackIndex {
+	uint64_t offset;				// 파일 시작 기준 위치 (ASSET_PACK_ALIGNMENT 정렬)
+	uint64_t size;
+	uint32_t type;
+	uint32_t nameOffset;			// 이름 문자열 기준 위치
+	uint32_t nameLength;
+	uint32_t reserved;
+};
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) {
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+bool AssetPack::open(const std::string& path) {
+	close();
+
+	if (!file.open(path)) {
+		return false;
+	}
+
+	// 헤더 검증
+	AssetPackHeader header;
+	if (file.size() < sizeof(header)) {
+		close();
+		throw std::runtime_error("failed to parse asset pack!");
+	}
+	memcpy(&header, file.data(), sizeof(header));
+
+	uint64_t nameTableOffset = sizeof(header) + uint64_t(header.assetCount) * sizeof(AssetPackIndex);
+	bool valid = header.magic == ASSET_PACK_MAGIC
+		&& header.version == ASSET_PACK_VERSION
+		&& header.fileSize == file.size()
+		&& nameTableOffset + header.nameTableSize <= header.dataOffset
+		&& header.dataOffset <= file.size();
+
+	// 에셋 인덱스 검증 (종류, 이름 / 데이터 범위, 정렬)
+	const char* names = reinterpret_cast<const char*>(file.data() + nameTableOffset);
+	for (uint32_t i = 0; valid && i < header.assetCount; i++) {
+		AssetPackIndex index;
+		memcpy(&index, file.data() + sizeof(header) + i * sizeof(index), sizeof(index));
+
+		valid = index.type <= ASSET_TYPE_SHADER
+			&& uint64_t(index.nameOffset) + index.nameLength <= header.nameTableSize
+			&& index.offset % ASSET_PACK_ALIGNMENT == 0
+			&& index.offset >= header.dataOffset
+			&& index.offset <= file.size()
+			&& index.size <= file.size() - index.offset;
+		if (valid) {
+			Entry entry;
+			entry.name.assign(names + index.nameOffset, index.nameLength);
+			entry.type = static_cast<AssetType>(index.type);
+			entry.blob.data = file.data() + index.offset;
+			entry.blob.size = static_cast<size_t>(index.size);
+			entries.push_back(std::move(entry));
+		}
+	}
+
+	// 이진 탐색을 위해 이름 순으로 저장되어 있어야 함
+	for (size_t i = 1; valid && i < entries.size(); i++) {
+		valid = entries[i - 1].name < entries[i].name;
+	}
+
+	if (!valid) {
+		close();
+		throw std::runtime_error("failed to parse asset pack!");
+	}
+
+	// 에셋 데이터 전체를 한 번에 미리 읽기 (개별 파일처럼 에셋마다 첫 접근에서 디스크를 기다리지 않음)
+	file.prefetch(static_cast<size_t>(header.dataOffset), file.size() - static_cast<size_t>(header.dataOffset));
+	return true;
+}
+
+void AssetPack::close() {
+	file.close();
+	entries.clear();
+}
+
+bool AssetPack::find(const std::string& name, AssetType type, AssetBlob& blob) const {
+	auto it = std::lower_bound(entries.begin(), entries.end(), name, [](const Entry& entry, const std::string& value) {
+		return entry.name < value;
+	});
+	if (it == entries.end() || it->name != name || it->type != type) {
+		return false;
+	}
+	blob = it->blob;
+	return true;
+}
+
+bool AssetPack::write(const std::string& path, const std::vector<AssetPackInput>& inputs) {
+	// 이름 순으로 배치 (같은 이름은 허용하지 않음)
+	std::vector<const AssetPackInput*> sorted;
+	for (const AssetPackInput& input : inputs) {
+		sorted.push_back(&input);
+	}
+	std::sort(sorted.begin(), sorted.end(), [](const AssetPackInput* a, const AssetPackInput* b) {
+		return a->name < b->name;
+	});
+	for (size_t i = 1; i < sorted.size(); i++) {
+		if (sorted[i - 1]->name == sorted[i]->name) {
+			return false;
+		}
+	}
+
+	// 인덱스 / 이름 문자열 / 데이터 배치
+	std::vector<AssetPackIndex> index(sorted.size());
+	std::string nameTable;
+	for (size_t i = 0; i < sorted.size(); i++) {
+		index[i].type = static_cast<uint32_t>(sorted[i]->type);
+		index[i].nameOffset = static_cast<uint32_t>(nameTable.size());
+		index[i].nameLength = static_cast<uint32_t>(sorted[i]->name.size());
+		index[i].reserved = 0;
+		nameTable += sorted[i]->name;
+	}
+
+	AssetPackHeader header{};
+	header.magic = ASSET_PACK_MAGIC;
+	header.version = ASSET_PACK_VERSION;
+	header.assetCount = static_cast<uint32_t>(sorted.size());
+	header.nameTableSize = static_cast<uint32_t>(nameTable.size());
+	header.dataOffset = alignUp(sizeof(header) + index.size() * sizeof(AssetPackIndex) + nameTable.size(), ASSET_PACK_ALIGNMENT);
+
+	uint64_t offset = header.dataOffset;
+	for (size_t i = 0; i < sorted.size(); i++) {
+		offset = alignUp(offset, ASSET_PACK_ALIGNMENT);
+		index[i].offset = offset;
+		index[i].size = sorted[i]->data.size();
+		offset += sorted[i]->data.size();
+	}
+	header.fileSize = offset;
+
+	// 쓰는 도중 종료되어도 깨진 팩이 남지 않도록 임시 파일에 먼저 기록
+	std::string tempPath = path + ".tmp";
+	{
+		std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+		if (!out.is_open()) {
+			return false;
+		}
+
+		const std::vector<char> padding(ASSET_PACK_ALIGNMENT, 0);
+		out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		out.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(AssetPackIndex));
+		out.write(nameTable.data(), nameTable.size());
+
+		uint64_t written = sizeof(header) + index.size() * sizeof(AssetPackIndex) + nameTable.size();
+		for (size_t i = 0; i < sorted.size(); i++) {
+			out.write(padding.data(), index[i].offset - written);
+			out.write(reinterpret_cast<const char*>(sorted[i]->data.data()), sorted[i]->data.size());
+			written = index[i].offset + sorted[i]->data.size();
+		}
+		out.write(padding.data(), header.fileSize - written);		// 에셋이 없을 때 데이터 시작 위치까지 채움
+
+		if (!out.good()) {
+			return false;
+		}
+	}
+
+	std::error_code ec;
+	std::filesystem::rename(tempPath, path, ec);
+	if (ec) {
+		std::filesystem::remove(tempPath, ec);
+		return false;
+	}
+	return true;
+}
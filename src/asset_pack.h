@@ -0,0 +1,74 @@
+#pragma once
+
+#include "mapped_file.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+	[단일 파일 에셋 팩]
+	메시 / 텍스처 / 셰이더를 로드 형식 그대로 (메시 캐시, KTX2, SPIR-V) 파일 1 개에 이어 붙인다.
+	런타임은 파일 1 개만 매핑하고 전체 데이터 구간에 미리 읽기를 요청한 뒤,
+	에셋마다 매핑된 메모리 구간을 그대로 넘겨서 복사 없이 업로드한다.
+
+	파일 구성
+	1. AssetPackHeader (식별자, 버전, 에셋 수, 전체 크기)
+	2. 에셋 인덱스 (이름 / 종류 / 위치 / 크기, 이름 순 정렬)
+	3. 이름 문자열
+	4. 에셋 데이터 (각각 페이지 크기로 정렬)
+*/
+
+// 팩 형식이 바뀌면 올려서 이전 팩을 거부
+const uint32_t ASSET_PACK_VERSION = 1;
+
+// 에셋 데이터 정렬 (페이지 크기, 에셋별 데이터가 페이지를 공유하지 않음)
+const uint64_t ASSET_PACK_ALIGNMENT = 4096;
+
+enum AssetType {
+	ASSET_TYPE_MESH,		// MeshCache 형식
+	ASSET_TYPE_TEXTURE,		// KTX2
+	ASSET_TYPE_SHADER		// SPIR-V
+};
+
+// 매핑된 에셋 데이터 구간 (팩이 열려 있는 동안 유효)
+struct AssetBlob {
+	const uint8_t* data = nullptr;
+	size_t size = 0;
+};
+
+// 팩에 넣을 에셋 1 개
+struct AssetPackInput {
+	std::string name;
+	AssetType type;
+	std::vector<uint8_t> data;
+};
+
+class AssetPack {
+public:
+	// 팩 파일을 매핑하고 인덱스 검증 후 전체 데이터 미리 읽기 요청 (파일이 없으면 false, 형식이 잘못되면 예외 발생)
+	bool open(const std::string& path);
+	// 매핑 해제
+	void close();
+
+	// 에셋들을 팩 파일로 저장 (임시 파일에 쓴 뒤 교체 / 실패시 false)
+	static bool write(const std::string& path, const std::vector<AssetPackInput>& inputs);
+
+	// 이름과 종류가 일치하는 에셋 구간 (없으면 false)
+	bool find(const std::string& name, AssetType type, AssetBlob& blob) const;
+
+	bool isOpen() const { return file.isOpen(); }
+	size_t size() const { return file.size(); }
+	uint32_t assetCount() const { return static_cast<uint32_t>(entries.size()); }
+
+private:
+	struct Entry {
+		std::string name;
+		AssetType type;
+		AssetBlob blob;
+	};
+
+	MappedFile file;
+	std::vector<Entry> entries;			// 이름 순 정렬
+};
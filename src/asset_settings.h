@@ -0,0 +1,51 @@
+#pragma once
+
+#include "mesh.h"
+
+#include <assimp/postprocess.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+/*
+	[에셋 경로 / 임포트 설정]
+	렌더러와 에셋 패커가 같은 값을 쓰도록 한 곳에 모아둔다.
+	(패커가 다른 설정으로 메시를 만들면 메시 캐시 키가 달라서 렌더러가 팩의 메시를 쓰지 않음)
+	경로는 실행 위치 기준이며 팩 안의 에셋 이름으로도 사용
+	빌드가 생성하는 에셋 (KTX2 / SPIR-V / 에셋 팩) 은 빌드 폴더에 같은 상대 경로로 출력되므로 generatedAssetPath 로 찾음
+*/
+
+// 빌드가 생성한 에셋 폴더 (렌더러는 CMake 가 빌드 폴더로 지정, 지정하지 않으면 실행 위치)
+#ifndef GENERATED_ASSET_DIR
+#define GENERATED_ASSET_DIR "."
+#endif
+
+// 생성 에셋 파일 경로 (실행 위치에 있으면 그대로, 없으면 GENERATED_ASSET_DIR 기준)
+inline std::string generatedAssetPath(const std::string& path) {
+	if (std::filesystem::exists(path)) {
+		return path;
+	}
+	return std::string(GENERATED_ASSET_DIR) + "/" + path;
+}
+
+// 단일 파일 에셋 팩 (asset_packer 로 생성, 없으면 아래 개별 파일 사용)
+const std::string ASSET_PACK_PATH = "assets.pack";
+
+// 모델 / texture / 셰이더 경로
+const std::string MODEL_PATH = "models/viking_room.obj";
+const std::string TEXTURE_PATH = "textures/viking_room.png";
+const std::string TEXTURE_KTX2_PATH = "textures/viking_room.ktx2";	// texture_bake 로 만든 BC7 텍스처 (없으면 TEXTURE_PATH 사용)
+const std::string VERT_SHADER_PATH = "shaders/vert.spv";
+const std::string FRAG_SHADER_PATH = "shaders/frag.spv";
+const std::string CULL_SHADER_PATH = "shaders/cull.spv";			// GPU 컬링 컴퓨트 셰이더
+
+// 모델 임포트 플래그 (메시 캐시 키에도 포함)
+const uint32_t MODEL_IMPORT_FLAGS = aiProcess_Triangulate | aiProcess_FlipUVs;
+
+// 임포트 후처리 설정 (메시 캐시 키에도 포함)
+const MeshProcessOptions MODEL_PROCESS_OPTIONS = {
+	MESH_PROCESS_WELD_VERTICES | MESH_PROCESS_VERTEX_CACHE | MESH_PROCESS_OVERDRAW | MESH_PROCESS_VERTEX_FETCH | MESH_PROCESS_LODS | MESH_PROCESS_MESHLETS,	// flags
+	0.0f,							// weldEpsilon (완전히 같은 정점만 병합)
+	1.05f							// overdrawThreshold
+};
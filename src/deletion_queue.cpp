@@ -0,0 +1,173 @@
+#include "deletion_queue.h"
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+
+namespace {
+
+const char* OBJECT_TYPE_NAMES[GPU_OBJECT_TYPE_COUNT] = {
+	"VkBuffer",
+	"VkImage",
+	"VkImageView",
+	"VkSampler",
+	"VkFramebuffer",
+	"VkPipeline",
+	"VkSwapchainKHR",
+	"GpuAllocation"
+};
+
+} // namespace
+
+DeletionQueueFunctions defaultDeletionQueueFunctions() {
+	DeletionQueueFunctions functions{};
+	functions.destroyBuffer = vkDestroyBuffer;
+	functions.destroyImage = vkDestroyImage;
+	functions.destroyImageView = vkDestroyImageView;
+	functions.destroySampler = vkDestroySampler;
+	functions.destroyFramebuffer = vkDestroyFramebuffer;
+	functions.destroyPipeline = vkDestroyPipeline;
+	functions.destroySwapchain = vkDestroySwapchainKHR;
+	return functions;
+}
+
+DeletionQueue::~DeletionQueue() {
+	destroy();
+}
+
+void DeletionQueue::init(VkDevice device, GpuAllocator& allocator, bool trackHandles, const DeletionQueueFunctions& functions) {
+	destroy();
+	this->device = device;
+	this->allocator = &allocator;
+	this->trackHandles = trackHandles;
+	this->functions = functions;
+	queueStats = DeletionQueueStats();
+}
+
+void DeletionQueue::destroy() {
+	if (allocator == nullptr) {
+		return;
+	}
+
+	drain(UINT64_MAX);
+
+	if (trackHandles) {
+		for (uint32_t type = 0; type < GPU_OBJECT_TYPE_COUNT; type++) {
+			for (const std::pair<uint64_t, uint64_t>& handle : liveHandles[type]) {
+				std::cerr << "leaked " << OBJECT_TYPE_NAMES[type] << " 0x" << std::hex << handle.first << std::dec;
+				if (type == GPU_OBJECT_MEMORY) {
+					std::cerr << " + " << handle.second;
+				}
+				std::cerr << std::endl;
+				queueStats.leaked++;
+			}
+			liveHandles[type].clear();
+		}
+	}
+
+	frameSerials.clear();
+	submittedSerial = 0;
+	completedSerial = 0;
+	device = VK_NULL_HANDLE;
+	allocator = nullptr;
+}
+
+void DeletionQueue::frameSubmitted(uint32_t frame) {
+	if (frame >= frameSerials.size()) {
+		frameSerials.resize(frame + 1, 0);
+	}
+	frameSerials[frame] = ++submittedSerial;
+}
+
+void DeletionQueue::frameCompleted(uint32_t frame) {
+	if (frame < frameSerials.size()) {
+		completedSerial = std::max(completedSerial, frameSerials[frame]);
+	}
+	drain(completedSerial);
+}
+
+void DeletionQueue::track(GpuObjectType type, uint64_t handle, uint64_t offset) {
+	if (trackHandles && allocator != nullptr) {
+		liveHandles[type].insert({handle, offset});
+	}
+}
+
+void DeletionQueue::untrack(GpuObjectType type, uint64_t handle, uint64_t offset) {
+	if (trackHandles) {
+		liveHandles[type].erase({handle, offset});
+	}
+}
+
+void DeletionQueue::release(GpuObjectType type, uint64_t handle, uint32_t delayFrames) {
+	if (allocator == nullptr) {
+		return;
+	}
+	untrack(type, handle, 0);
+	push({submittedSerial + 1 + delayFrames, type, handle, GpuAllocation()});
+}
+
+void DeletionQueue::release(GpuAllocation& allocation) {
+	if (allocator != nullptr && allocation.memory != VK_NULL_HANDLE) {
+		untrack(GPU_OBJECT_MEMORY, (uint64_t)allocation.memory, allocation.offset);
+		push({submittedSerial + 1, GPU_OBJECT_MEMORY, 0, allocation});
+	}
+	allocation = GpuAllocation();
+}
+
+// serial 순서 유지 (지연한 객체 뒤에 들어온 객체가 그 객체를 기다리지 않도록, 대부분은 끝에 추가)
+void DeletionQueue::push(Deferred object) {
+	auto position = pending.end();
+	while (position != pending.begin() && std::prev(position)->serial > object.serial) {
+		--position;
+	}
+	pending.insert(position, object);
+	queueStats.released++;
+	queueStats.peakPending = std::max(queueStats.peakPending, static_cast<uint32_t>(pending.size()));
+}
+
+DeletionQueueStats DeletionQueue::stats() const {
+	DeletionQueueStats result = queueStats;
+	result.pending = static_cast<uint32_t>(pending.size());
+	return result;
+}
+
+// 핸들을 원래 Vulkan 타입으로 되돌려서 파괴
+void DeletionQueue::destroyObject(Deferred& object) {
+	switch (object.type) {
+	case GPU_OBJECT_BUFFER:
+		functions.destroyBuffer(device, (VkBuffer)object.handle, nullptr);
+		break;
+	case GPU_OBJECT_IMAGE:
+		functions.destroyImage(device, (VkImage)object.handle, nullptr);
+		break;
+	case GPU_OBJECT_IMAGE_VIEW:
+		functions.destroyImageView(device, (VkImageView)object.handle, nullptr);
+		break;
+	case GPU_OBJECT_SAMPLER:
+		functions.destroySampler(device, (VkSampler)object.handle, nullptr);
+		break;
+	case GPU_OBJECT_FRAMEBUFFER:
+		functions.destroyFramebuffer(device, (VkFramebuffer)object.handle, nullptr);
+		break;
+	case GPU_OBJECT_PIPELINE:
+		functions.destroyPipeline(device, (VkPipeline)object.handle, nullptr);
+		break;
+	case GPU_OBJECT_SWAPCHAIN:
+		functions.destroySwapchain(device, (VkSwapchainKHR)object.handle, nullptr);
+		break;
+	case GPU_OBJECT_MEMORY:
+		allocator->free(object.allocation);
+		break;
+	default:
+		break;
+	}
+	queueStats.destroyed++;
+}
+
+// serial 이하로 기록된 객체 파괴 (해제한 순서대로, 이미지 / 버퍼를 메모리보다 먼저 해제했으면 먼저 파괴됨)
+void DeletionQueue::drain(uint64_t serial) {
+	while (!pending.empty() && pending.front().serial <= serial) {
+		destroyObject(pending.front());
+		pending.pop_front();
+	}
+}
@@ -0,0 +1,223 @@
+#pragma once
+
+#include "gpu_allocator.h"
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <deque>
+#include <set>
+#include <utility>
+#include <vector>
+
+/*
+	[지연 삭제 큐]
+	해제한 GPU 객체를 바로 파괴하지 않고, 해제 시점까지 제출한 프레임이 모두 끝난 뒤 (inFlightFences 대기 후) 파괴한다.
+	(리소스 교체 / 창 크기 변경마다 vkDeviceWaitIdle 로 장치 전체를 멈추지 않기 위해)
+	1. 프레임 제출마다 번호를 매기고 (frameSubmitted), 해제한 객체에는 다음 제출 번호를 기록
+	   (기록 중인 커맨드 버퍼가 해제 전에 객체를 참조했을 수 있으므로 그 프레임까지 기다림)
+	2. 프레임의 펜스를 기다린 뒤 (frameCompleted) 그 프레임 번호 이하로 기록된 객체를 파괴
+	   (같은 큐의 제출은 순서대로 끝나므로 펜스가 signal 되면 그 전에 제출한 프레임도 끝난 것)
+	3. 업로드 큐에 예약한 리소스는 그 업로드를 기다리는 프레임을 제출한 뒤에 해제해야 함
+	4. 펜스가 덮지 않는 작업이 쓰는 객체 (표시 요청 중인 스왑 체인) 는 delayFrames 만큼 더 늦게 파괴
+	5. trackHandles 이면 살아있는 핸들을 모두 기록해서 destroy 할 때 해제하지 않은 핸들을 출력
+	메인 스레드 전용
+*/
+
+enum GpuObjectType : uint32_t {
+	GPU_OBJECT_BUFFER,
+	GPU_OBJECT_IMAGE,
+	GPU_OBJECT_IMAGE_VIEW,
+	GPU_OBJECT_SAMPLER,
+	GPU_OBJECT_FRAMEBUFFER,
+	GPU_OBJECT_PIPELINE,
+	GPU_OBJECT_SWAPCHAIN,
+	GPU_OBJECT_MEMORY,				// GpuAllocator 구간
+	GPU_OBJECT_TYPE_COUNT
+};
+
+// 객체 파괴에 쓰는 Vulkan 함수 (테스트에서 가짜 장치로 교체 가능)
+struct DeletionQueueFunctions {
+	PFN_vkDestroyBuffer destroyBuffer;
+	PFN_vkDestroyImage destroyImage;
+	PFN_vkDestroyImageView destroyImageView;
+	PFN_vkDestroySampler destroySampler;
+	PFN_vkDestroyFramebuffer destroyFramebuffer;
+	PFN_vkDestroyPipeline destroyPipeline;
+	PFN_vkDestroySwapchainKHR destroySwapchain;
+};
+
+// Vulkan 로더의 함수
+DeletionQueueFunctions defaultDeletionQueueFunctions();
+
+struct DeletionQueueStats {
+	uint64_t released = 0;			// 지금까지 해제 요청한 객체 수
+	uint64_t destroyed = 0;			// 지금까지 파괴한 객체 수
+	uint32_t pending = 0;			// 파괴를 기다리는 객체 수
+	uint32_t peakPending = 0;
+	uint32_t leaked = 0;			// destroy 할 때 해제하지 않은 핸들 수 (trackHandles 일 때만)
+};
+
+class DeletionQueue {
+public:
+	DeletionQueue() = default;
+	~DeletionQueue();
+
+	DeletionQueue(const DeletionQueue&) = delete;
+	DeletionQueue& operator=(const DeletionQueue&) = delete;
+
+	void init(VkDevice device, GpuAllocator& allocator, bool trackHandles, const DeletionQueueFunctions& functions);
+	// 남은 객체를 모두 파괴 (장치가 idle 인 상태에서 호출), trackHandles 이면 해제하지 않은 핸들 출력
+	// 이후의 해제 요청은 무시 (누수로 출력한 핸들)
+	void destroy();
+
+	// 프레임 커맨드 버퍼를 frame 의 펜스와 함께 제출한 직후 호출
+	void frameSubmitted(uint32_t frame);
+	// frame 의 펜스를 기다린 직후 호출 (그 프레임까지 끝난 객체 파괴)
+	void frameCompleted(uint32_t frame);
+
+	// 핸들 등록 (trackHandles 일 때 누수 검사용, GpuHandle / GpuMemory 가 호출)
+	void track(GpuObjectType type, uint64_t handle, uint64_t offset = 0);
+	// 지금까지 제출한 프레임과 기록 중인 프레임, 그 뒤로 delayFrames 개 프레임이 더 끝나면 파괴
+	void release(GpuObjectType type, uint64_t handle, uint32_t delayFrames = 0);
+	// 해제 후 allocation 은 빈 값
+	void release(GpuAllocation& allocation);
+
+	DeletionQueueStats stats() const;
+
+private:
+	struct Deferred {
+		uint64_t serial;			// 이 번호의 프레임이 끝나면 파괴
+		GpuObjectType type;
+		uint64_t handle;
+		GpuAllocation allocation;	// GPU_OBJECT_MEMORY
+	};
+
+	VkDevice device = VK_NULL_HANDLE;
+	GpuAllocator* allocator = nullptr;
+	DeletionQueueFunctions functions{};
+	bool trackHandles = false;
+
+	std::deque<Deferred> pending;			// serial 순 (같은 serial 은 해제 순)
+	std::vector<uint64_t> frameSerials;		// 프레임 (펜스) 별 마지막 제출 번호
+	uint64_t submittedSerial = 0;
+	uint64_t completedSerial = 0;
+	std::set<std::pair<uint64_t, uint64_t>> liveHandles[GPU_OBJECT_TYPE_COUNT];		// (핸들, offset)
+	DeletionQueueStats queueStats;
+
+	void untrack(GpuObjectType type, uint64_t handle, uint64_t offset);
+	void push(Deferred object);
+	void destroyObject(Deferred& object);
+	void drain(uint64_t serial);
+};
+
+// 객체 종류별 Vulkan 핸들 타입
+template <GpuObjectType Type> struct GpuObjectTraits;
+template <> struct GpuObjectTraits<GPU_OBJECT_BUFFER> { using Handle = VkBuffer; };
+template <> struct GpuObjectTraits<GPU_OBJECT_IMAGE> { using Handle = VkImage; };
+template <> struct GpuObjectTraits<GPU_OBJECT_IMAGE_VIEW> { using Handle = VkImageView; };
+template <> struct GpuObjectTraits<GPU_OBJECT_SAMPLER> { using Handle = VkSampler; };
+template <> struct GpuObjectTraits<GPU_OBJECT_FRAMEBUFFER> { using Handle = VkFramebuffer; };
+template <> struct GpuObjectTraits<GPU_OBJECT_PIPELINE> { using Handle = VkPipeline; };
+template <> struct GpuObjectTraits<GPU_OBJECT_SWAPCHAIN> { using Handle = VkSwapchainKHR; };
+
+/*
+	[GPU 객체 핸들]
+	소멸 / reset / 다른 핸들 대입시 DeletionQueue 로 해제 (파괴는 프레임이 끝난 뒤)
+	Vulkan 핸들로 암시적 변환되므로 vk 함수에 그대로 전달 가능
+	(32bit 플랫폼에서는 non-dispatchable 핸들이 모두 uint64_t 라서 포인터 / 정수 모두 되는 C 스타일 변환 사용)
+*/
+template <GpuObjectType Type>
+class GpuHandle {
+public:
+	using Handle = typename GpuObjectTraits<Type>::Handle;
+
+	GpuHandle() = default;
+	GpuHandle(DeletionQueue& queue, Handle handle) : queue(&queue), handle(handle) {
+		queue.track(Type, (uint64_t)handle);
+	}
+	~GpuHandle() {
+		reset();
+	}
+
+	GpuHandle(const GpuHandle&) = delete;
+	GpuHandle& operator=(const GpuHandle&) = delete;
+
+	GpuHandle(GpuHandle&& other) noexcept : queue(other.queue), handle(other.handle) {
+		other.handle = VK_NULL_HANDLE;
+	}
+	GpuHandle& operator=(GpuHandle&& other) noexcept {
+		if (this != &other) {
+			reset();
+			queue = other.queue;
+			handle = other.handle;
+			other.handle = VK_NULL_HANDLE;
+		}
+		return *this;
+	}
+
+	operator Handle() const { return handle; }
+	Handle get() const { return handle; }
+	const Handle* address() const { return &handle; }
+
+	// delayFrames: 펜스가 덮지 않는 작업이 아직 쓸 수 있으면 그만큼 프레임을 더 기다린 뒤 파괴
+	void reset(uint32_t delayFrames = 0) {
+		if (handle != VK_NULL_HANDLE) {
+			queue->release(Type, (uint64_t)handle, delayFrames);
+			handle = VK_NULL_HANDLE;
+		}
+	}
+
+private:
+	DeletionQueue* queue = nullptr;
+	Handle handle = VK_NULL_HANDLE;
+};
+
+using GpuBuffer = GpuHandle<GPU_OBJECT_BUFFER>;
+using GpuImage = GpuHandle<GPU_OBJECT_IMAGE>;
+using GpuImageView = GpuHandle<GPU_OBJECT_IMAGE_VIEW>;
+using GpuSampler = GpuHandle<GPU_OBJECT_SAMPLER>;
+using GpuFramebuffer = GpuHandle<GPU_OBJECT_FRAMEBUFFER>;
+using GpuPipeline = GpuHandle<GPU_OBJECT_PIPELINE>;
+using GpuSwapchain = GpuHandle<GPU_OBJECT_SWAPCHAIN>;
+
+// GpuAllocator 구간 핸들 (해제하면 프레임이 끝난 뒤 GpuAllocator::free)
+class GpuMemory {
+public:
+	GpuMemory() = default;
+	GpuMemory(DeletionQueue& queue, const GpuAllocation& allocation) : queue(&queue), allocation(allocation) {
+		queue.track(GPU_OBJECT_MEMORY, (uint64_t)allocation.memory, allocation.offset);
+	}
+	~GpuMemory() {
+		reset();
+	}
+
+	GpuMemory(const GpuMemory&) = delete;
+	GpuMemory& operator=(const GpuMemory&) = delete;
+
+	GpuMemory(GpuMemory&& other) noexcept : queue(other.queue), allocation(other.allocation) {
+		other.allocation = GpuAllocation();
+	}
+	GpuMemory& operator=(GpuMemory&& other) noexcept {
+		if (this != &other) {
+			reset();
+			queue = other.queue;
+			allocation = other.allocation;
+			other.allocation = GpuAllocation();
+		}
+		return *this;
+	}
+
+	const GpuAllocation& get() const { return allocation; }
+	const GpuAllocation* operator->() const { return &allocation; }
+
+	void reset() {
+		if (allocation.memory != VK_NULL_HANDLE) {
+			queue->release(allocation);
+		}
+	}
+
+private:
+	DeletionQueue* queue = nullptr;
+	GpuAllocation allocation;
+};
@@ -0,0 +1,82 @@
+#include "frame_command_pools.h"
+
+#include <stdexcept>
+
+FrameCommandPools::~FrameCommandPools() {
+	destroy();
+}
+
+void FrameCommandPools::init(VkDevice device, uint32_t queueFamilyIndex, uint32_t frameCount, uint32_t slotCount) {
+	destroy();
+	this->device = device;
+	slots = slotCount;
+
+	frames.resize(frameCount);
+	for (Frame& frame : frames) {
+		frame.primaryPool = createPool(queueFamilyIndex);
+		frame.primaryBuffer = allocateBuffer(frame.primaryPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+		for (uint32_t slot = 0; slot < slotCount; slot++) {
+			frame.secondaryPools.push_back(createPool(queueFamilyIndex));
+			frame.secondaryBuffers.push_back(allocateBuffer(frame.secondaryPools.back(), VK_COMMAND_BUFFER_LEVEL_SECONDARY));
+		}
+	}
+}
+
+void FrameCommandPools::destroy() {
+	if (device == VK_NULL_HANDLE) {
+		return;
+	}
+
+	// 커맨드 버퍼는 풀과 같이 해제
+	for (Frame& frame : frames) {
+		if (frame.primaryPool != VK_NULL_HANDLE) {
+			vkDestroyCommandPool(device, frame.primaryPool, nullptr);
+		}
+		for (VkCommandPool pool : frame.secondaryPools) {
+			vkDestroyCommandPool(device, pool, nullptr);
+		}
+	}
+	frames.clear();
+	slots = 0;
+	device = VK_NULL_HANDLE;
+}
+
+void FrameCommandPools::reset(uint32_t frame) {
+	// 풀 재설정은 풀에서 할당한 커맨드 버퍼를 모두 초기 상태로 되돌림 (메모리는 풀에 남겨서 다음 기록에 재사용)
+	if (vkResetCommandPool(device, frames[frame].primaryPool, 0) != VK_SUCCESS) {
+		throw std::runtime_error("failed to reset command pool!");
+	}
+	for (VkCommandPool pool : frames[frame].secondaryPools) {
+		if (vkResetCommandPool(device, pool, 0) != VK_SUCCESS) {
+			throw std::runtime_error("failed to reset command pool!");
+		}
+	}
+}
+
+VkCommandPool FrameCommandPools::createPool(uint32_t queueFamilyIndex) {
+	// 매 프레임 다시 기록하므로 TRANSIENT, 풀 단위로만 재설정하므로 RESET_COMMAND_BUFFER 플래그는 쓰지 않음
+	VkCommandPoolCreateInfo poolInfo{};
+	poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+	poolInfo.queueFamilyIndex = queueFamilyIndex;
+
+	VkCommandPool pool;
+	if (vkCreateCommandPool(device, &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+		throw std::runtime_error("failed to create command pool!");
+	}
+	return pool;
+}
+
+VkCommandBuffer FrameCommandPools::allocateBuffer(VkCommandPool pool, VkCommandBufferLevel level) {
+	VkCommandBufferAllocateInfo allocInfo{};
+	allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	allocInfo.commandPool = pool;
+	allocInfo.level = level;
+	allocInfo.commandBufferCount = 1;
+
+	VkCommandBuffer commandBuffer;
+	if (vkAllocateCommandBuffers(device, &allocInfo, &commandBuffer) != VK_SUCCESS) {
+		throw std::runtime_error("failed to allocate command buffers!");
+	}
+	return commandBuffer;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <vector>
+
+/*
+	[프레임별 커맨드 풀]
+	프레임마다 primary 커맨드 버퍼용 풀 1 개 + 기록 슬롯 (워커 스레드) 마다 secondary 커맨드 버퍼용 풀 1 개를 둔다.
+	1. 커맨드 풀은 외부 동기화 대상이라 같은 풀의 커맨드 버퍼를 여러 스레드가 동시에 기록할 수 없으므로
+	   슬롯마다 풀을 따로 만들고 한 프레임 동안 슬롯 1 개는 스레드 1 개만 기록
+	2. 커맨드 버퍼를 하나씩 vkResetCommandBuffer 하지 않고 프레임의 펜스를 기다린 뒤 그 프레임 풀을 모두 vkResetCommandPool
+	   (풀은 TRANSIENT, 개별 재설정 플래그 없이 생성)
+	3. 커맨드 버퍼는 init 에서 프레임 / 슬롯마다 1 개씩 미리 할당 (풀 재설정 후에도 그대로 재사용)
+	생성 / 재설정 / 파괴는 메인 스레드 전용
+*/
+class FrameCommandPools {
+public:
+	FrameCommandPools() = default;
+	~FrameCommandPools();
+
+	FrameCommandPools(const FrameCommandPools&) = delete;
+	FrameCommandPools& operator=(const FrameCommandPools&) = delete;
+
+	// queueFamilyIndex 큐에 제출할 frameCount 프레임 x (primary 1 개 + secondary slotCount 개) 커맨드 버퍼 생성
+	void init(VkDevice device, uint32_t queueFamilyIndex, uint32_t frameCount, uint32_t slotCount);
+	// 모든 풀 파괴 (커맨드 버퍼도 같이 해제, 장치가 idle 상태여야 함)
+	void destroy();
+
+	// frame 의 풀을 모두 재설정 (그 프레임을 제출한 펜스를 기다린 뒤 호출)
+	void reset(uint32_t frame);
+
+	VkCommandBuffer primary(uint32_t frame) const { return frames[frame].primaryBuffer; }
+	VkCommandBuffer secondary(uint32_t frame, uint32_t slot) const { return frames[frame].secondaryBuffers[slot]; }
+	// frame 의 secondary 커맨드 버퍼 배열 (슬롯 순서, vkCmdExecuteCommands 에 앞에서부터 넘김)
+	const VkCommandBuffer* secondaryBuffers(uint32_t frame) const { return frames[frame].secondaryBuffers.data(); }
+	uint32_t slotCount() const { return slots; }
+
+private:
+	struct Frame {
+		VkCommandPool primaryPool = VK_NULL_HANDLE;
+		VkCommandBuffer primaryBuffer = VK_NULL_HANDLE;
+		std::vector<VkCommandPool> secondaryPools;		// 슬롯마다 1 개
+		std::vector<VkCommandBuffer> secondaryBuffers;
+	};
+
+	VkDevice device = VK_NULL_HANDLE;
+	std::vector<Frame> frames;
+	uint32_t slots = 0;
+
+	VkCommandPool createPool(uint32_t queueFamilyIndex);
+	VkCommandBuffer allocateBuffer(VkCommandPool pool, VkCommandBufferLevel level);
+};
@@ -0,0 +1,512 @@
+#include "gpu_allocator.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+const uint32_t NO_RANGE = UINT32_MAX;
+const uint32_t NO_BLOCK = UINT32_MAX;
+
+// 작은 힙은 블록 1 개가 힙을 다 차지하지 않도록 1/8 로 제한
+const VkDeviceSize SMALL_HEAP_BLOCK_DIVISOR = 8;
+
+VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment) {
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+uint32_t highestBit(uint64_t value) {
+	uint32_t bit = 0;
+	while (value >>= 1) {
+		bit++;
+	}
+	return bit;
+}
+
+uint32_t lowestBit(uint64_t value) {
+	uint32_t bit = 0;
+	while ((value & 1) == 0) {
+		value >>= 1;
+		bit++;
+	}
+	return bit;
+}
+
+} // namespace
+
+GpuAllocatorFunctions defaultGpuAllocatorFunctions() {
+	GpuAllocatorFunctions functions{};
+	functions.allocateMemory = vkAllocateMemory;
+	functions.freeMemory = vkFreeMemory;
+	functions.mapMemory = vkMapMemory;
+	functions.unmapMemory = vkUnmapMemory;
+	return functions;
+}
+
+GpuAllocator::~GpuAllocator() {
+	destroy();
+}
+
+void GpuAllocator::init(VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties, VkDeviceSize bufferImageGranularity, const GpuAllocatorFunctions& functions) {
+	destroy();
+	this->device = device;
+	this->memoryProperties = memoryProperties;
+	this->bufferImageGranularity = std::max<VkDeviceSize>(bufferImageGranularity, 1);
+	this->functions = functions;
+
+	// 메모리 유형 x 리소스 종류 x 수명
+	pools.resize(memoryProperties.memoryTypeCount * 4);
+	for (uint32_t i = 0; i < pools.size(); i++) {
+		Pool& pool = pools[i];
+		pool.memoryType = i / 4;
+		pool.lifetime = (i & 1) ? GPU_MEMORY_TRANSIENT : GPU_MEMORY_PERSISTENT;
+
+		VkDeviceSize heapSize = memoryProperties.memoryHeaps[memoryProperties.memoryTypes[pool.memoryType].heapIndex].size;
+		pool.blockSize = std::min(GPU_ALLOCATOR_BLOCK_SIZE, heapSize / SMALL_HEAP_BLOCK_DIVISOR);
+
+		for (uint32_t fl = 0; fl < TLSF_FL_COUNT; fl++) {
+			for (uint32_t sl = 0; sl < TLSF_SL_COUNT; sl++) {
+				pool.freeHeads[fl][sl] = NO_RANGE;
+			}
+		}
+	}
+}
+
+void GpuAllocator::destroy() {
+	std::lock_guard<std::mutex> lock(mutex);
+	for (Pool& pool : pools) {
+		for (Block& block : pool.blocks) {
+			if (block.memory == VK_NULL_HANDLE) {
+				continue;
+			}
+			if (block.mapped) {
+				functions.unmapMemory(device, block.memory);
+			}
+			functions.freeMemory(device, block.memory, nullptr);
+		}
+	}
+	pools.clear();
+	device = VK_NULL_HANDLE;
+}
+
+GpuAllocation GpuAllocator::allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, GpuResourceKind kind, GpuMemoryLifetime lifetime) {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// granularity 가 1 이면 버퍼와 이미지가 같은 풀을 써도 됨
+	if (bufferImageGranularity <= 1) {
+		kind = GPU_RESOURCE_LINEAR;
+	}
+	VkDeviceSize size = std::max<VkDeviceSize>(requirements.size, 1);
+	VkDeviceSize alignment = std::max<VkDeviceSize>(requirements.alignment, 1);
+	totalAllocations++;
+
+	// 조건을 만족하는 메모리 유형을 순서대로 시도 (힙이 가득 차면 다음 유형)
+	bool found = false;
+	for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+		if (!(requirements.memoryTypeBits & (1u << i)) || (memoryProperties.memoryTypes[i].propertyFlags & properties) != properties) {
+			continue;
+		}
+		found = true;
+
+		GpuAllocation allocation;
+		if (allocateFromPool(i * 4 + kind * 2 + lifetime, size, alignment, allocation)) {
+			return allocation;
+		}
+	}
+	if (!found) {
+		throw std::runtime_error("failed to find suitable memory type!");
+	}
+	throw std::runtime_error("failed to allocate gpu memory!");
+}
+
+bool GpuAllocator::hasMemoryType(uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const {
+	for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+		if ((memoryTypeBits & (1u << i)) && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool GpuAllocator::canReuse(const GpuAllocation& allocation, const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties) const {
+	if (allocation.memory == VK_NULL_HANDLE) {
+		return false;
+	}
+	uint32_t memoryType = pools[allocation.pool].memoryType;
+	VkDeviceSize alignment = std::max<VkDeviceSize>(requirements.alignment, 1);
+	return (requirements.memoryTypeBits & (1u << memoryType))
+		&& (memoryProperties.memoryTypes[memoryType].propertyFlags & properties) == properties
+		&& requirements.size <= allocation.size
+		&& allocation.offset % alignment == 0;
+}
+
+void GpuAllocator::free(GpuAllocation& allocation) {
+	if (allocation.memory == VK_NULL_HANDLE) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	Pool& pool = pools[allocation.pool];
+	Block& block = pool.blocks[allocation.block];
+	block.usedBytes -= allocation.size;
+	block.allocationCount--;
+
+	if (block.dedicated) {
+		releaseBlock(pool, allocation.block);
+	} else if (pool.lifetime == GPU_MEMORY_PERSISTENT) {
+		freeTlsf(pool, allocation.range);
+	} else if (block.allocationCount == 0) {
+		block.linearHead = 0;
+	}
+
+	// 비어버린 블록은 풀에 블록이 더 있으면 해제 (마지막 1 개는 할당 / 해제 반복을 막기 위해 유지)
+	if (!block.dedicated && block.memory != VK_NULL_HANDLE && block.allocationCount == 0) {
+		uint32_t liveBlocks = 0;
+		for (const Block& other : pool.blocks) {
+			if (other.memory != VK_NULL_HANDLE && !other.dedicated) {
+				liveBlocks++;
+			}
+		}
+		if (liveBlocks > 1) {
+			releaseBlock(pool, allocation.block);
+		}
+	}
+
+	allocation = GpuAllocation();
+}
+
+GpuAllocatorStats GpuAllocator::stats() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	GpuAllocatorStats stats;
+	stats.deviceAllocations = deviceAllocations;
+	stats.totalAllocations = totalAllocations;
+
+	// 블록별 가장 큰 빈 구간 합 (블록끼리는 이어지지 않으므로 블록 안에서의 단편화만 계산)
+	VkDeviceSize contiguousBytes = 0;
+	std::vector<VkDeviceSize> largestInBlock;
+	for (const Pool& pool : pools) {
+		largestInBlock.assign(pool.blocks.size(), 0);
+		for (const Range& range : pool.ranges) {
+			if (range.free && range.size > 0) {
+				stats.freeBytes += range.size;
+				largestInBlock[range.block] = std::max(largestInBlock[range.block], range.size);
+			}
+		}
+
+		for (uint32_t i = 0; i < pool.blocks.size(); i++) {
+			const Block& block = pool.blocks[i];
+			if (block.memory == VK_NULL_HANDLE) {
+				continue;
+			}
+			stats.blockCount++;
+			stats.allocationCount += block.allocationCount;
+			stats.blockBytes += block.size;
+			stats.usedBytes += block.usedBytes;
+
+			// 선형 풀은 블록 끝의 남은 공간 (중간에 해제된 구간은 블록이 빌 때까지 재사용 불가)
+			if (pool.lifetime == GPU_MEMORY_TRANSIENT && !block.dedicated) {
+				largestInBlock[i] = block.size - block.linearHead;
+				stats.freeBytes += largestInBlock[i];
+			}
+			contiguousBytes += largestInBlock[i];
+			stats.largestFreeRange = std::max(stats.largestFreeRange, largestInBlock[i]);
+		}
+	}
+
+	if (stats.freeBytes > 0) {
+		stats.fragmentation = 1.0f - static_cast<float>(contiguousBytes) / static_cast<float>(stats.freeBytes);
+	}
+	return stats;
+}
+
+bool GpuAllocator::allocateFromPool(uint32_t poolIndex, VkDeviceSize size, VkDeviceSize alignment, GpuAllocation& allocation) {
+	Pool& pool = pools[poolIndex];
+	allocation.pool = poolIndex;
+	allocation.size = size;
+
+	// 큰 리소스는 전용 블록
+	if (size > pool.blockSize / 2) {
+		allocation.block = createBlock(pool, size, true);
+		if (allocation.block == NO_BLOCK) {
+			return false;
+		}
+		Block& block = pool.blocks[allocation.block];
+		block.usedBytes = size;
+		block.allocationCount = 1;
+		allocation.memory = block.memory;
+		allocation.mapped = block.mapped;
+		return true;
+	}
+
+	bool allocated = pool.lifetime == GPU_MEMORY_PERSISTENT
+		? allocateTlsf(pool, size, alignment, allocation)
+		: allocateLinear(pool, size, alignment, allocation);
+	if (!allocated) {
+		// 기존 블록에 자리가 없으면 블록 추가
+		uint32_t blockIndex = createBlock(pool, pool.blockSize, false);
+		if (blockIndex == NO_BLOCK) {
+			return false;
+		}
+		if (pool.lifetime == GPU_MEMORY_PERSISTENT) {
+			uint32_t range = newRange(pool);
+			pool.ranges[range] = {0, pool.blockSize, blockIndex, NO_RANGE, NO_RANGE, NO_RANGE, NO_RANGE, true};
+			insertFree(pool, range);
+			allocateTlsf(pool, size, alignment, allocation);
+		} else {
+			allocateLinear(pool, size, alignment, allocation);
+		}
+	}
+
+	Block& block = pool.blocks[allocation.block];
+	block.usedBytes += size;
+	block.allocationCount++;
+	allocation.memory = block.memory;
+	allocation.mapped = block.mapped ? block.mapped + allocation.offset : nullptr;
+	return true;
+}
+
+uint32_t GpuAllocator::createBlock(Pool& pool, VkDeviceSize size, bool dedicated) {
+	VkMemoryAllocateInfo allocInfo{};
+	allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	allocInfo.allocationSize = size;
+	allocInfo.memoryTypeIndex = pool.memoryType;
+
+	Block block;
+	block.size = size;
+	block.dedicated = dedicated;
+	VkResult result = functions.allocateMemory(device, &allocInfo, nullptr, &block.memory);
+	if (result == VK_ERROR_OUT_OF_DEVICE_MEMORY || result == VK_ERROR_OUT_OF_HOST_MEMORY) {
+		return NO_BLOCK;
+	}
+	if (result != VK_SUCCESS) {
+		throw std::runtime_error("failed to allocate gpu memory!");
+	}
+	deviceAllocations++;
+
+	// 블록 전체를 한 번만 매핑 (같은 메모리를 중복 매핑할 수 없으므로 구간별 매핑 불가)
+	if (memoryProperties.memoryTypes[pool.memoryType].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+		void* mapped = nullptr;
+		if (functions.mapMemory(device, block.memory, 0, VK_WHOLE_SIZE, 0, &mapped) != VK_SUCCESS) {
+			functions.freeMemory(device, block.memory, nullptr);
+			throw std::runtime_error("failed to map gpu memory!");
+		}
+		block.mapped = static_cast<uint8_t*>(mapped);
+	}
+
+	// 해제한 블록 자리 재사용
+	for (uint32_t i = 0; i < pool.blocks.size(); i++) {
+		if (pool.blocks[i].memory == VK_NULL_HANDLE) {
+			pool.blocks[i] = block;
+			return i;
+		}
+	}
+	pool.blocks.push_back(block);
+	return static_cast<uint32_t>(pool.blocks.size() - 1);
+}
+
+void GpuAllocator::releaseBlock(Pool& pool, uint32_t blockIndex) {
+	Block& block = pool.blocks[blockIndex];
+
+	// TLSF 블록은 블록 전체를 덮는 빈 구간 1 개만 남아 있음
+	if (pool.lifetime == GPU_MEMORY_PERSISTENT && !block.dedicated) {
+		for (uint32_t i = 0; i < pool.ranges.size(); i++) {
+			Range& range = pool.ranges[i];
+			if (range.free && range.size > 0 && range.block == blockIndex) {
+				removeFree(pool, i);
+				range.size = 0;
+				range.free = false;
+				pool.unusedRanges.push_back(i);
+			}
+		}
+	}
+
+	if (block.mapped) {
+		functions.unmapMemory(device, block.memory);
+	}
+	functions.freeMemory(device, block.memory, nullptr);
+	block = Block();
+}
+
+uint32_t GpuAllocator::newRange(Pool& pool) {
+	if (!pool.unusedRanges.empty()) {
+		uint32_t index = pool.unusedRanges.back();
+		pool.unusedRanges.pop_back();
+		return index;
+	}
+	pool.ranges.push_back(Range());
+	return static_cast<uint32_t>(pool.ranges.size() - 1);
+}
+
+/*
+	[TLSF 크기 분류]
+	fl = 크기의 최상위 bit, sl = 그 아래 TLSF_SL_BITS bit (2^fl 구간을 32 등분)
+	작은 크기 (< 32) 는 fl 0 에서 크기 그대로 분류
+*/
+void GpuAllocator::mapping(VkDeviceSize size, uint32_t& fl, uint32_t& sl) {
+	if (size < TLSF_SL_COUNT) {
+		fl = 0;
+		sl = static_cast<uint32_t>(size);
+		return;
+	}
+	uint32_t bit = highestBit(size);
+	fl = bit - TLSF_SL_BITS + 1;
+	sl = static_cast<uint32_t>(size >> (bit - TLSF_SL_BITS)) - TLSF_SL_COUNT;
+}
+
+void GpuAllocator::insertFree(Pool& pool, uint32_t index) {
+	Range& range = pool.ranges[index];
+	uint32_t fl, sl;
+	mapping(range.size, fl, sl);
+
+	range.free = true;
+	range.prevFree = NO_RANGE;
+	range.nextFree = pool.freeHeads[fl][sl];
+	if (range.nextFree != NO_RANGE) {
+		pool.ranges[range.nextFree].prevFree = index;
+	}
+	pool.freeHeads[fl][sl] = index;
+	pool.flBitmap |= 1ull << fl;
+	pool.slBitmap[fl] |= 1u << sl;
+}
+
+void GpuAllocator::removeFree(Pool& pool, uint32_t index) {
+	Range& range = pool.ranges[index];
+	uint32_t fl, sl;
+	mapping(range.size, fl, sl);
+
+	if (range.prevFree != NO_RANGE) {
+		pool.ranges[range.prevFree].nextFree = range.nextFree;
+	} else {
+		pool.freeHeads[fl][sl] = range.nextFree;
+	}
+	if (range.nextFree != NO_RANGE) {
+		pool.ranges[range.nextFree].prevFree = range.prevFree;
+	}
+	if (pool.freeHeads[fl][sl] == NO_RANGE) {
+		pool.slBitmap[fl] &= ~(1u << sl);
+		if (pool.slBitmap[fl] == 0) {
+			pool.flBitmap &= ~(1ull << fl);
+		}
+	}
+	range.free = false;
+	range.prevFree = NO_RANGE;
+	range.nextFree = NO_RANGE;
+}
+
+uint32_t GpuAllocator::findFree(Pool& pool, VkDeviceSize size) {
+	// 크기를 다음 분류 경계로 올려서 찾은 분류의 어떤 빈 구간이든 size 이상이 되게 함
+	if (size >= TLSF_SL_COUNT) {
+		size += (VkDeviceSize(1) << (highestBit(size) - TLSF_SL_BITS)) - 1;
+	}
+	uint32_t fl, sl;
+	mapping(size, fl, sl);
+	if (fl >= TLSF_FL_COUNT) {
+		return NO_RANGE;
+	}
+
+	// 같은 fl 에서 sl 이상 → 없으면 더 큰 fl 의 가장 작은 sl
+	uint32_t slMap = pool.slBitmap[fl] & (~0u << sl);
+	if (slMap == 0) {
+		uint64_t flMap = fl + 1 < TLSF_FL_COUNT ? pool.flBitmap & (~0ull << (fl + 1)) : 0;
+		if (flMap == 0) {
+			return NO_RANGE;
+		}
+		fl = lowestBit(flMap);
+		slMap = pool.slBitmap[fl];
+	}
+	sl = lowestBit(slMap);
+	return pool.freeHeads[fl][sl];
+}
+
+bool GpuAllocator::allocateTlsf(Pool& pool, VkDeviceSize size, VkDeviceSize alignment, GpuAllocation& allocation) {
+	// 정렬 padding 을 감안한 크기로 찾음
+	uint32_t index = findFree(pool, size + alignment - 1);
+	if (index == NO_RANGE) {
+		return false;
+	}
+	removeFree(pool, index);
+
+	// 앞쪽 정렬 padding 은 빈 구간으로 분리
+	VkDeviceSize alignedOffset = alignUp(pool.ranges[index].offset, alignment);
+	VkDeviceSize padding = alignedOffset - pool.ranges[index].offset;
+	if (padding > 0) {
+		uint32_t front = newRange(pool);
+		Range& range = pool.ranges[index];
+		pool.ranges[front] = {range.offset, padding, range.block, range.prevPhysical, index, NO_RANGE, NO_RANGE, false};
+		if (range.prevPhysical != NO_RANGE) {
+			pool.ranges[range.prevPhysical].nextPhysical = front;
+		}
+		range.prevPhysical = front;
+		range.offset = alignedOffset;
+		range.size -= padding;
+		insertFree(pool, front);
+	}
+
+	// 뒤쪽 남는 공간도 빈 구간으로 분리
+	if (pool.ranges[index].size > size) {
+		uint32_t back = newRange(pool);
+		Range& range = pool.ranges[index];
+		pool.ranges[back] = {range.offset + size, range.size - size, range.block, index, range.nextPhysical, NO_RANGE, NO_RANGE, false};
+		if (range.nextPhysical != NO_RANGE) {
+			pool.ranges[range.nextPhysical].prevPhysical = back;
+		}
+		range.nextPhysical = back;
+		range.size = size;
+		insertFree(pool, back);
+	}
+
+	allocation.block = pool.ranges[index].block;
+	allocation.offset = pool.ranges[index].offset;
+	allocation.range = index;
+	return true;
+}
+
+void GpuAllocator::freeTlsf(Pool& pool, uint32_t index) {
+	// 물리적으로 이웃한 빈 구간과 병합
+	uint32_t next = pool.ranges[index].nextPhysical;
+	if (next != NO_RANGE && pool.ranges[next].free) {
+		removeFree(pool, next);
+		Range& range = pool.ranges[index];
+		range.size += pool.ranges[next].size;
+		range.nextPhysical = pool.ranges[next].nextPhysical;
+		if (range.nextPhysical != NO_RANGE) {
+			pool.ranges[range.nextPhysical].prevPhysical = index;
+		}
+		pool.ranges[next].size = 0;
+		pool.unusedRanges.push_back(next);
+	}
+
+	uint32_t prev = pool.ranges[index].prevPhysical;
+	if (prev != NO_RANGE && pool.ranges[prev].free) {
+		removeFree(pool, prev);
+		Range& range = pool.ranges[prev];
+		range.size += pool.ranges[index].size;
+		range.nextPhysical = pool.ranges[index].nextPhysical;
+		if (range.nextPhysical != NO_RANGE) {
+			pool.ranges[range.nextPhysical].prevPhysical = prev;
+		}
+		pool.ranges[index].size = 0;
+		pool.ranges[index].free = false;
+		pool.unusedRanges.push_back(index);
+		index = prev;
+	}
+
+	insertFree(pool, index);
+}
+
+bool GpuAllocator::allocateLinear(Pool& pool, VkDeviceSize size, VkDeviceSize alignment, GpuAllocation& allocation) {
+	for (uint32_t i = 0; i < pool.blocks.size(); i++) {
+		Block& block = pool.blocks[i];
+		if (block.memory == VK_NULL_HANDLE || block.dedicated) {
+			continue;
+		}
+		VkDeviceSize offset = alignUp(block.linearHead, alignment);
+		if (offset + size <= block.size) {
+			block.linearHead = offset + size;
+			allocation.block = i;
+			allocation.offset = offset;
+			return true;
+		}
+	}
+	return false;
+}
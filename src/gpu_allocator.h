@@ -0,0 +1,165 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/*
+	[GPU 메모리 할당기]
+	메모리 유형마다 큰 블록을 vkAllocateMemory 로 잡아두고 리소스마다 블록 안의 구간을 나눠준다.
+	(리소스마다 vkAllocateMemory 를 부르면 maxMemoryAllocationCount 제한에 걸리고 할당마다 커널 호출이 생김)
+	1. 오래 사는 리소스 (정점 / 인덱스 / 텍스처 / 유니폼 버퍼 등) 는 TLSF 풀
+	   (2 단계 크기 분류 free list + 비트맵으로 O(1) 탐색, 해제시 인접한 빈 구간과 병합)
+	2. 바로 해제하는 리소스 (스테이징 버퍼 등) 는 선형 풀 (블록 끝에 이어서 할당, 블록의 할당이 모두 해제되면 처음부터 재사용)
+	3. bufferImageGranularity 가 1 보다 크면 선형 리소스 (버퍼) 와 optimal 이미지를 서로 다른 풀에 둬서 같은 페이지를 공유하지 않게 함
+	4. HOST_VISIBLE 블록은 생성할 때 한 번만 전체 매핑 (할당은 매핑 주소 + offset 을 그대로 사용, vkMapMemory 호출 금지)
+	5. 블록 크기의 절반보다 큰 리소스는 전용 블록에 따로 할당
+*/
+
+// 기본 블록 크기 (메모리 힙이 작으면 힙 크기의 1/8)
+const VkDeviceSize GPU_ALLOCATOR_BLOCK_SIZE = 64ull * 1024 * 1024;
+
+// 블록 할당에 쓰는 Vulkan 함수 (테스트에서 가짜 장치로 교체 가능)
+struct GpuAllocatorFunctions {
+	PFN_vkAllocateMemory allocateMemory;
+	PFN_vkFreeMemory freeMemory;
+	PFN_vkMapMemory mapMemory;
+	PFN_vkUnmapMemory unmapMemory;
+};
+
+// Vulkan 로더의 함수
+GpuAllocatorFunctions defaultGpuAllocatorFunctions();
+
+// 리소스 종류 (bufferImageGranularity 처리용)
+enum GpuResourceKind : uint32_t {
+	GPU_RESOURCE_LINEAR,		// 버퍼 / linear tiling 이미지
+	GPU_RESOURCE_OPTIMAL		// optimal tiling 이미지
+};
+
+// 할당 수명
+enum GpuMemoryLifetime : uint32_t {
+	GPU_MEMORY_PERSISTENT,		// TLSF 풀
+	GPU_MEMORY_TRANSIENT		// 선형 풀
+};
+
+// 리소스 1 개에 나눠준 메모리 구간
+struct GpuAllocation {
+	VkDeviceMemory memory = VK_NULL_HANDLE;
+	VkDeviceSize offset = 0;			// 바인딩 offset (alignment 정렬)
+	VkDeviceSize size = 0;
+	void* mapped = nullptr;				// HOST_VISIBLE 이면 구간 시작의 매핑 주소
+
+	// 할당기 내부 위치 (해제용)
+	uint32_t pool = UINT32_MAX;
+	uint32_t block = 0;
+	uint32_t range = 0;
+};
+
+struct GpuAllocatorStats {
+	uint32_t blockCount = 0;			// 현재 잡고 있는 블록 수 (전용 블록 포함)
+	uint32_t allocationCount = 0;		// 현재 나눠준 구간 수
+	VkDeviceSize blockBytes = 0;		// 블록 크기 합
+	VkDeviceSize usedBytes = 0;			// 나눠준 구간 크기 합 (정렬 padding 제외)
+	VkDeviceSize freeBytes = 0;			// 블록 안의 빈 공간 합
+	VkDeviceSize largestFreeRange = 0;	// 가장 큰 연속 빈 구간
+	float fragmentation = 0.0f;			// 1 - 블록별 가장 큰 빈 구간의 합 / 빈 공간 합 (0 이면 블록마다 빈 공간이 한 덩어리)
+	uint64_t deviceAllocations = 0;		// 지금까지 vkAllocateMemory 호출 수
+	uint64_t totalAllocations = 0;		// 지금까지 allocate 호출 수
+};
+
+class GpuAllocator {
+public:
+	GpuAllocator() = default;
+	~GpuAllocator();
+
+	GpuAllocator(const GpuAllocator&) = delete;
+	GpuAllocator& operator=(const GpuAllocator&) = delete;
+
+	// 장치 메모리 정보 설정 (bufferImageGranularity 는 VkPhysicalDeviceLimits 값)
+	void init(VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties, VkDeviceSize bufferImageGranularity, const GpuAllocatorFunctions& functions);
+	// 모든 블록 해제 (장치 파괴 전에 호출)
+	void destroy();
+
+	// memoryTypeBits 중 properties 를 만족하는 메모리 유형에서 구간 할당 (힙이 가득 차면 다음 유형, 모두 실패시 예외 발생)
+	GpuAllocation allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, GpuResourceKind kind, GpuMemoryLifetime lifetime);
+	// 구간 해제 (빈 할당이면 무시, 해제 후 allocation 은 빈 값)
+	void free(GpuAllocation& allocation);
+
+	// memoryTypeBits 중 properties 를 만족하는 메모리 유형이 있는지 (LAZILY_ALLOCATED 처럼 선택적인 속성 확인용)
+	bool hasMemoryType(uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const;
+	// 기존 구간에 requirements 리소스를 그대로 바인딩할 수 있는지 (메모리 유형 / 속성 / 크기 / 정렬)
+	bool canReuse(const GpuAllocation& allocation, const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties) const;
+
+	GpuAllocatorStats stats() const;
+
+private:
+	// vkAllocateMemory 로 잡은 메모리 1 개
+	struct Block {
+		VkDeviceMemory memory = VK_NULL_HANDLE;
+		VkDeviceSize size = 0;
+		uint8_t* mapped = nullptr;
+		VkDeviceSize usedBytes = 0;
+		uint32_t allocationCount = 0;
+		VkDeviceSize linearHead = 0;		// 선형 풀의 다음 할당 위치
+		bool dedicated = false;
+	};
+
+	// TLSF 구간 (블록 안에서 물리적으로 이웃한 구간끼리 연결, 빈 구간은 크기 분류 free list 에도 연결)
+	struct Range {
+		VkDeviceSize offset;
+		VkDeviceSize size;
+		uint32_t block;
+		uint32_t prevPhysical;
+		uint32_t nextPhysical;
+		uint32_t prevFree;
+		uint32_t nextFree;
+		bool free;
+	};
+
+	static const uint32_t TLSF_SL_BITS = 5;
+	static const uint32_t TLSF_SL_COUNT = 1u << TLSF_SL_BITS;
+	static const uint32_t TLSF_FL_COUNT = 64;
+
+	// 메모리 유형 x 리소스 종류 x 수명 별 풀
+	struct Pool {
+		uint32_t memoryType = 0;
+		GpuMemoryLifetime lifetime = GPU_MEMORY_PERSISTENT;
+		VkDeviceSize blockSize = 0;
+		std::vector<Block> blocks;			// 해제한 블록 자리는 memory 가 VK_NULL_HANDLE
+
+		// TLSF (PERSISTENT)
+		std::vector<Range> ranges;
+		std::vector<uint32_t> unusedRanges;
+		uint64_t flBitmap = 0;
+		uint32_t slBitmap[TLSF_FL_COUNT] = {};
+		uint32_t freeHeads[TLSF_FL_COUNT][TLSF_SL_COUNT];
+	};
+
+	VkDevice device = VK_NULL_HANDLE;
+	VkPhysicalDeviceMemoryProperties memoryProperties{};
+	VkDeviceSize bufferImageGranularity = 1;
+	GpuAllocatorFunctions functions{};
+	std::vector<Pool> pools;
+	mutable std::mutex mutex;
+	uint64_t deviceAllocations = 0;
+	uint64_t totalAllocations = 0;
+
+	// 풀에서 구간 할당 (장치 메모리가 부족하면 false)
+	bool allocateFromPool(uint32_t poolIndex, VkDeviceSize size, VkDeviceSize alignment, GpuAllocation& allocation);
+	// 블록 추가 (장치 메모리가 부족하면 UINT32_MAX)
+	uint32_t createBlock(Pool& pool, VkDeviceSize size, bool dedicated);
+	void releaseBlock(Pool& pool, uint32_t blockIndex);
+
+	// TLSF
+	static void mapping(VkDeviceSize size, uint32_t& fl, uint32_t& sl);
+	uint32_t newRange(Pool& pool);
+	void insertFree(Pool& pool, uint32_t index);
+	void removeFree(Pool& pool, uint32_t index);
+	uint32_t findFree(Pool& pool, VkDeviceSize size);
+	bool allocateTlsf(Pool& pool, VkDeviceSize size, VkDeviceSize alignment, GpuAllocation& allocation);
+	void freeTlsf(Pool& pool, uint32_t index);
+
+	bool allocateLinear(Pool& pool, VkDeviceSize size, VkDeviceSize alignment, GpuAllocation& allocation);
+};
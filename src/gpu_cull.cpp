@@ -0,0 +1,55 @@
+#include "gpu_cull.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// 바운딩 구와 평면 사이 가장 먼 쪽 거리 (음수면 평면 바깥, 셰이더와 같은 계산)
+float sphereDistance(const glm::vec4 frustumPlanes[6], const glm::vec3& center, float radius) {
+	float distance = INFINITY;
+	for (int p = 0; p < 6; p++) {
+		distance = std::min(distance, glm::dot(glm::vec3(frustumPlanes[p]), center) + frustumPlanes[p].w + radius);
+	}
+	return distance;
+}
+
+} // namespace
+
+void makeGpuCullSubMeshes(const SubMesh* subMeshes, uint32_t subMeshCount, std::vector<GpuCullSubMesh>& cullSubMeshes) {
+	cullSubMeshes.resize(subMeshCount);
+	for (uint32_t i = 0; i < subMeshCount; i++) {
+		const SubMesh& subMesh = subMeshes[i];
+		GpuCullSubMesh& cullSubMesh = cullSubMeshes[i];
+		cullSubMesh.sphere = glm::vec4(subMesh.center, subMesh.radius);
+		cullSubMesh.indexCount = subMesh.indexCount;
+		cullSubMesh.firstIndex = subMesh.firstIndex;
+		cullSubMesh.vertexOffset = static_cast<int32_t>(subMesh.baseVertex);
+		cullSubMesh.firstLod = subMesh.firstLod;
+		cullSubMesh.lodCount = subMesh.lodCount;
+		cullSubMesh.padding[0] = cullSubMesh.padding[1] = cullSubMesh.padding[2] = 0;
+	}
+}
+
+GpuCullReference countVisibleDraws(const GpuInstance* instances, uint32_t instanceCount, const GpuCullSubMesh* subMeshes, uint32_t subMeshCount,
+								   const glm::vec4 frustumPlanes[6], float tolerance) {
+	GpuCullReference reference;
+	for (uint32_t i = 0; i < instanceCount; i++) {
+		const glm::mat4& model = instances[i].model;
+		// 축별 배율 중 가장 큰 값으로 반지름 확대
+		float scale = std::sqrt(std::max({glm::dot(glm::vec3(model[0]), glm::vec3(model[0])),
+										  glm::dot(glm::vec3(model[1]), glm::vec3(model[1])),
+										  glm::dot(glm::vec3(model[2]), glm::vec3(model[2]))}));
+		for (uint32_t s = 0; s < subMeshCount; s++) {
+			glm::vec3 center = glm::vec3(model * glm::vec4(glm::vec3(subMeshes[s].sphere), 1.0f));
+			float distance = sphereDistance(frustumPlanes, center, subMeshes[s].sphere.w * scale);
+			if (distance >= tolerance) {
+				reference.minVisible++;
+			}
+			if (distance >= -tolerance) {
+				reference.maxVisible++;
+			}
+		}
+	}
+	return reference;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "mesh.h"
+#include "mesh_instance.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+/*
+	[GPU 컬링 (컴퓨트 pre-pass)]
+	렌더 패스 전에 컴퓨트 셰이더 (cull.comp) 가 인스턴스 x 서브 메시마다 바운딩 구를 frustum 평면과 비교해서
+	보이는 것만 VkDrawIndexedIndirectCommand 로 압축 기록하고 서브 메시별 개수를 센다.
+	명령의 인덱스 구간은 인스턴스 x 서브 메시마다 selectMeshLod 와 같은 기준으로 고른 LOD 구간 (LOD 표는 MeshLod 배열 그대로 업로드)
+	그리기는 서브 메시마다 vkCmdDrawIndexedIndirectCount 1 번 (CPU 기록 비용이 물체 수와 무관)
+	1. 서브 메시 표 (GpuCullSubMesh) / LOD 표는 시작할 때 1 번 업로드
+	2. 명령은 서브 메시 s 마다 [s * maxDrawsPerSubMesh, ...) 구간에 기록 (firstInstance = 인스턴스 번호)
+	   인스턴스 1 개는 서브 메시마다 명령을 최대 1 개 쓰므로 maxDrawsPerSubMesh 는 이번 프레임 인스턴스 수
+	3. countVisibleDraws 는 셰이더와 같은 판정을 CPU 에서 수행 (readback 검사용 기준값)
+*/
+
+// 셰이더 CullSubMesh (std430) 와 같은 배치
+struct GpuCullSubMesh {
+	glm::vec4 sphere;				// xyz: 바운딩 구 중심 (모델 좌표), w: 반지름
+	uint32_t indexCount;
+	uint32_t firstIndex;			// indexType 별 인덱스 배열 기준
+	int32_t vertexOffset;
+	uint32_t firstLod;				// LOD 표에서 첫 LOD 위치 (lodCount 0 이면 LOD 0 만)
+	uint32_t lodCount;
+	uint32_t padding[3];
+};
+
+static_assert(sizeof(GpuCullSubMesh) == 48, "GpuCullSubMesh must match the std430 CullSubMesh layout");
+static_assert(sizeof(MeshLod) == 12, "MeshLod must match the std430 MeshLod layout");
+
+// 셰이더 CullConstants (push constant) 와 같은 배치
+struct GpuCullConstants {
+	glm::vec4 frustumPlanes[6];		// 월드 좌표 기준 안쪽을 향하는 정규화된 평면
+	uint32_t instanceCount;
+	uint32_t subMeshCount;
+	uint32_t maxDrawsPerSubMesh;	// 서브 메시별 명령 구간 크기 (= instanceCount, vkCmdDrawIndexedIndirectCount 의 maxDrawCount)
+	uint32_t padding;
+	glm::vec4 lodCamera;			// xyz: 월드 좌표 카메라 위치, w: pixelsPerUnit / errorThreshold (LOD 선택)
+};
+
+static_assert(sizeof(GpuCullConstants) <= 128, "GpuCullConstants must fit in the guaranteed push constant range");
+
+// 컴퓨트 셰이더 작업 그룹 크기 (cull.comp 의 local_size_x)
+const uint32_t GPU_CULL_GROUP_SIZE = 64;
+
+// readback 검사 기준 (평면 경계에서 CPU / GPU 부동소수점 차이를 허용하는 범위)
+struct GpuCullReference {
+	uint32_t minVisible = 0;		// 허용 오차 밖에서도 확실히 보이는 draw 수
+	uint32_t maxVisible = 0;		// 허용 오차 안쪽까지 포함한 draw 수
+};
+
+// 서브 메시 draw 범위 / 바운딩 구 / LOD 위치를 셰이더 표로 변환
+void makeGpuCullSubMeshes(const SubMesh* subMeshes, uint32_t subMeshCount, std::vector<GpuCullSubMesh>& cullSubMeshes);
+
+// 셰이더와 같은 판정으로 살아남는 draw 수 계산 (tolerance: 평면 거리 허용 오차)
+GpuCullReference countVisibleDraws(const GpuInstance* instances, uint32_t instanceCount, const GpuCullSubMesh* subMeshes, uint32_t subMeshCount,
+								   const glm::vec4 frustumPlanes[6], float tolerance);
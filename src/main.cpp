@@ -1,23 +1,41 @@
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
 
-#include <assimp/Importer.hpp>
-#include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb/stb_image.h>
-
 #define GLM_FORCE_RADIANS
 // GLM에서는 보통 -1.0 ~ 1.0 범위로 원근 투영 행렬을 사용하므로 0.0 ~ 1.0 범위로 한다는 설정 적용
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include "vertex_layout.h"
+#include "asset_pack.h"
+#include "asset_settings.h"
+#include "deletion_queue.h"
+#include "frame_command_pools.h"
+#include "gpu_allocator.h"
+#include "gpu_cull.h"
+#include "mesh_cache.h"
+#include "mesh_instance.h"
+#include "mesh_lod.h"
+#include "mesh_meshlet.h"
+#include "model_loader.h"
+#include "scene_bvh.h"
+#include "texture_bc.h"
+#include "texture_ktx2.h"
+#include "texture_loader.h"
+#include "texture_mip.h"
+#include "texture_stream.h"
+#include "thread_pool.h"
+#include "uniform_ring.h"
+#include "upload_queue.h"
+
 #include <iostream>
 #include <fstream>
 #include <stdexcept>
 #include <algorithm>
+#include <numeric>
 #include <chrono>
 #include <vector>
 #include <cstring>
@@ -26,15 +44,59 @@
 #include <limits>
 #include <array>
 #include <optional>
+#include <functional>
 #include <set>
 
-// texture 경로
-const std::string MODEL_PATH = "models/viking_room.obj";
-const std::string TEXTURE_PATH = "textures/viking_room.png";
+// 텍스처 밉맵 다운샘플 필터
+const MipFilter TEXTURE_MIP_FILTER = MIP_FILTER_KAISER;
+
+// 프레임당 텍스처 스트리밍 업로드 예산 (byte)
+const size_t TEXTURE_STREAM_BUDGET = 256 * 1024;
+
+// 스트리밍 전 가장 작은 밉 레벨을 채우는 임시 색 (RGBA8)
+const uint8_t TEXTURE_PLACEHOLDER_COLOR[4] = {128, 128, 128, 255};
+
+// 프레임당 유니폼 링 영역 크기 (byte, 물체별 상수 수천 개 분량)
+const size_t UNIFORM_RING_FRAME_SIZE = 1024 * 1024;
+
+// 업로드 큐 스테이징 링 크기 (byte, 이보다 큰 업로드는 임시 스테이징 버퍼 사용)
+const VkDeviceSize UPLOAD_STAGING_SIZE = 16 * 1024 * 1024;
+
+// 멀티샘플링 attachment 메모리를 다시 할당할 때 두는 여유 (창 크기 조절 중 재할당 방지)
+const float ATTACHMENT_GROWTH = 0.25f;
+
+// LOD 선택 허용 화면 오차 (픽셀)
+const float LOD_ERROR_PIXELS = 1.0f;
+
+// 인스턴스 버퍼에 담을 수 있는 최대 인스턴스 수 (프레임마다 MAX_INSTANCES * sizeof(GpuInstance) 영역)
+const uint32_t MAX_INSTANCES = 100000;
+
+// 인스턴스 격자 간격 (모델 크기 기준)
+const float INSTANCE_SPACING = 2.5f;
+
+// --instance-sweep 에서 측정할 인스턴스 수와 단계별 프레임 수 (워밍업 후 측정)
+const uint32_t INSTANCE_SWEEP_COUNTS[] = {1, 10, 100, 1000, 10000, 100000};
+const uint32_t INSTANCE_SWEEP_WARMUP_FRAMES = 30;
+const uint32_t INSTANCE_SWEEP_MEASURE_FRAMES = 120;
+
+// 커맨드 기록 스레드 1 개가 맡는 최소 draw 단위 수 (이보다 적게 나누면 secondary 커맨드 버퍼 시작 / 상태 바인딩 비용이 더 큼)
+const uint32_t RECORD_MIN_DRAWS_PER_THREAD = 256;
+
+// --record-threads 를 지정하지 않았을 때: 스레드 풀의 모든 스레드 (워커 + 메인) 로 기록
+const uint32_t RECORD_THREADS_ALL = std::numeric_limits<uint32_t>::max();
+
+// --cull-check 에서 GPU 컬링 결과를 CPU 기준값과 비교할 프레임 수
+const uint32_t CULL_CHECK_FRAMES = 60;
+
+// GPU 컬링 readback 검사에서 평면 경계 부근으로 보고 결과를 허용하는 거리 (월드 좌표)
+const float CULL_CHECK_TOLERANCE = 1e-3f;
 
 // 동시에 처리할 최대 프레임 수
 const int MAX_FRAMES_IN_FLIGHT = 2;
 
+// present 펜스가 없을 때 이전 스왑 체인 파괴를 미루는 추가 프레임 수 (해제 후 MAX_FRAMES_IN_FLIGHT + 1 번째 제출이 끝나면 파괴)
+const uint32_t SWAPCHAIN_RETIRE_DELAY_FRAMES = MAX_FRAMES_IN_FLIGHT;
+
 // 검증 레이어 설정
 const std::vector<const char*> validationLayers = {
 	"VK_LAYER_KHRONOS_validation"
@@ -82,6 +144,7 @@ void DestroyDebugUtilsMessengerEXT(VkInstance instance, VkDebugUtilsMessengerEXT
 struct QueueFamilyIndices {
 	std::optional<uint32_t> graphicsFamily;
 	std::optional<uint32_t> presentFamily;
+	std::optional<uint32_t> transferFamily;		// 그래픽스를 지원하지 않는 전송 큐 패밀리 (없으면 그래픽스 큐로 업로드)
 
 	bool isComplete() {
 		return graphicsFamily.has_value() && presentFamily.has_value();
@@ -96,59 +159,42 @@ struct SwapChainSupportDetails {
 };
 
 
-struct Vertex {
-	glm::vec3 pos;
-	glm::vec3 color;
-	glm::vec2 texCoord;
-
-	// 정점 데이터가 전달되는 방법을 알려주는 구조체 반환하는 함수
-	static VkVertexInputBindingDescription getBindingDescription() {
-		// 파이프라인에 정점 데이터가 전달되는 방법을 알려주는 구조체
-		VkVertexInputBindingDescription bindingDescription{};		
-		bindingDescription.binding = 0;								// 버텍스 바인딩 포인트 (현재 0번에 vertex 정보 바인딩)
-		bindingDescription.stride = sizeof(Vertex);					// 버텍스 1개 단위의 정보 크기
-		bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX; // 정점 데이터 처리 방법
-																	// 1. VK_VERTEX_INPUT_RATE_VERTEX : 정점별로 데이터 처리
-																	// 2. VK_VERTEX_INPUT_RATE_INSTANCE : 인스턴스별로 데이터 처리
-		return bindingDescription;
-	}
-
-	// 정점 속성별 데이터 형식과 위치를 지정하는 구조체 반환하는 함수
-	static std::array<VkVertexInputAttributeDescription, 3> getAttributeDescriptions() {
-		// 정점 속성의 데이터 형식과 위치를 지정하는 구조체
-		std::array<VkVertexInputAttributeDescription, 3> attributeDescriptions{};
-
-		// pos 속성 정보 입력
-		attributeDescriptions[0].binding = 0;							// 버텍스 버퍼의 바인딩 포인트
-		attributeDescriptions[0].location = 0;							// 버텍스 셰이더의 어떤 location에 대응되는지 지정
-		attributeDescriptions[0].format = VK_FORMAT_R32G32B32_SFLOAT;	// 저장되는 데이터 형식 (VK_FORMAT_R32G32B32_SFLOAT = vec3)
-		attributeDescriptions[0].offset = offsetof(Vertex, pos);		// 버텍스 구조체에서 해당 속성이 시작되는 위치
-
-		// color 속성 정보 입력
-		attributeDescriptions[1].binding = 0;
-		attributeDescriptions[1].location = 1;
-		attributeDescriptions[1].format = VK_FORMAT_R32G32B32_SFLOAT;
-		attributeDescriptions[1].offset = offsetof(Vertex, color);
-
-		// texCoord 속성 정보 입력
-		attributeDescriptions[2].binding = 0;
-		attributeDescriptions[2].location = 2;
-		attributeDescriptions[2].format = VK_FORMAT_R32G32_SFLOAT;
-		attributeDescriptions[2].offset = offsetof(Vertex, texCoord);
-
-		return attributeDescriptions;
-	}
-};
-
+// 물체별 변환은 인스턴스 버퍼 (GpuInstance) 에 있음
 struct UniformBufferObject {
-	alignas(16) glm::mat4 model;
 	alignas(16) glm::mat4 view;
 	alignas(16) glm::mat4 proj;
 };
 
+// 명령행 옵션 (main 에서 파싱)
+struct RenderOptions {
+	uint32_t instanceCount = 1;		// --instances N : 격자로 배치할 모델 수
+	bool instanceSweep = false;		// --instance-sweep : 인스턴스 수별 CPU 기록 / GPU 시간 측정 후 종료
+	bool gpuCulling = true;			// --no-gpu-cull : 지원해도 GPU 컬링을 쓰지 않음 (CPU BVH 컬링 사용)
+	bool cullCheck = false;			// --cull-check : GPU 컬링 후 남은 draw 수를 CPU 기준값과 비교하고 종료
+	uint32_t recordThreads = RECORD_THREADS_ALL;	// --record-threads N : draw 를 secondary 커맨드 버퍼로 나눠 기록할 스레드 수 (0 이면 primary 에 직접 기록)
+	bool recordSweep = false;		// --record-sweep : 기록 스레드 수별 커맨드 기록 시간 측정 후 종료
+};
+
+// 인스턴스 draw 방식
+enum InstanceDrawMode {
+	INSTANCE_DRAW_GPU_CULLED,		// 컴퓨트 컬링 + vkCmdDrawIndexedIndirectCount (서브 메시마다 1 번)
+	INSTANCE_DRAW_CPU_CULLED,		// GPU 컬링을 못 쓸 때: CPU BVH 컬링 후 남은 인스턴스만 instanced draw
+	INSTANCE_DRAW_INSTANCED,		// 서브 메시마다 instanceCount 로 1 번 (인스턴스 1 개면 메시렛 컬링 경로)
+	INSTANCE_DRAW_SEPARATE,			// 비교용: 인스턴스마다 draw 1 번 (firstInstance 로 구분)
+	INSTANCE_DRAW_MODE_COUNT
+};
+
+const char* INSTANCE_DRAW_MODE_NAMES[INSTANCE_DRAW_MODE_COUNT] = {
+	"gpu culled draws",
+	"cpu culled draws",
+	"instanced draws ",
+	"separate draws  "
+};
+
 class HelloTriangleApplication {
 public:
-	void run() {
+	void run(const RenderOptions& options) {
+		this->options = options;
 		initWindow();
 		initVulkan();
 		mainLoop();
@@ -156,6 +202,7 @@ public:
 	}
 
 private:
+	RenderOptions options;
 	GLFWwindow* window;
 
 	VkInstance instance;
@@ -168,54 +215,146 @@ private:
 	
 	VkQueue graphicsQueue;
 	VkQueue presentQueue;
+	VkQueue transferQueue;					// 업로드 전용 큐 (전송 전용 큐 패밀리가 없으면 graphicsQueue)
+
+	DeletionQueue deletionQueue;			// 해제한 GPU 객체를 프레임이 끝난 뒤 파괴 (Gpu* 핸들 멤버보다 먼저 선언해서 마지막에 소멸)
 
-	VkSwapchainKHR swapChain;
+	GpuSwapchain swapChain;
 	std::vector<VkImage> swapChainImages;
 	VkFormat swapChainImageFormat;
 	VkExtent2D swapChainExtent;
-	std::vector<VkImageView> swapChainImageViews;
-	std::vector<VkFramebuffer> swapChainFramebuffers;
+	std::vector<GpuImageView> swapChainImageViews;
+	std::vector<GpuFramebuffer> swapChainFramebuffers;
 
 	VkRenderPass renderPass;
 	VkDescriptorSetLayout descriptorSetLayout;
 	VkPipelineLayout pipelineLayout;
-	VkPipeline graphicsPipeline;
+	GpuPipeline graphicsPipeline;
 
-	VkCommandPool commandPool;
+	FrameCommandPools frameCommandPools;	// 프레임별 primary / 기록 스레드별 secondary 커맨드 풀 (프레임 단위로 풀 재설정)
+	uint32_t recordThreadCount = 0;			// draw 기록에 쓸 스레드 수 (0 이면 primary 에 직접 기록)
+	uint32_t frameRecordJobs = 0;			// 이번 프레임 draw 를 나눠 기록한 secondary 커맨드 버퍼 수
+
+	GpuAllocator gpuAllocator;				// 장치 메모리 할당기 (메모리 유형별 큰 블록에서 리소스마다 구간 할당)
+	UploadQueue uploadQueue;				// 버퍼 / 이미지 업로드 배치 제출 (스테이징 링 + 타임라인 세마포어, 전송 큐)
+	uint64_t uploadWaitValue = 0;			// 이번 프레임 제출이 기다릴 업로드 타임라인 값 (0 이면 대기 없음)
 	
-	VkImage colorImage;
-	VkDeviceMemory colorImageMemory;
-	VkImageView colorImageView;
+	GpuImage colorImage;
+	GpuMemory colorImageAllocation;
+	GpuImageView colorImageView;
 
-	VkImage depthImage;
-	VkDeviceMemory depthImageMemory;
-	VkImageView depthImageView;
+	GpuImage depthImage;
+	GpuMemory depthImageAllocation;
+	GpuImageView depthImageView;
 
 	uint32_t mipLevels;
-	VkImage textureImage;
-	VkDeviceMemory textureImageMemory;
-	VkImageView textureImageView;
-    VkSampler textureSampler;
-
-	std::vector<Vertex> vertices;
-	std::vector<uint32_t> indices;
-	VkBuffer vertexBuffer;
-	VkDeviceMemory vertexBufferMemory;
-	VkBuffer indexBuffer;
-	VkDeviceMemory indexBufferMemory;
-
-	std::vector<VkBuffer> uniformBuffers;
-	std::vector<VkDeviceMemory> uniformBuffersMemory;
-	std::vector<void*> uniformBuffersMapped;
+	VkFormat textureFormat;
+	GpuImage textureImage;
+	GpuMemory textureImageAllocation;
+	GpuImageView textureImageView;
+	std::vector<GpuSampler> textureSamplers;			// minLod 별 샘플러 (index = 상주한 가장 큰 레벨)
+	uint32_t textureResidentLevel = 0;				// 업로드가 끝난 가장 큰 밉 레벨 (이보다 작은 번호 레벨은 샘플링 금지)
+	std::vector<uint32_t> descriptorTextureLevels;	// 프레임별 디스크립터 셋에 바인딩된 샘플러 minLod
+	std::vector<GpuBuffer> textureStreamBuffers;	// 프레임별 스트리밍 업로드 버퍼 (영구 매핑)
+	std::vector<GpuMemory> textureStreamBuffersAllocation;
+	std::vector<void*> textureStreamBuffersMapped;
+	std::vector<TextureStreamChunk> textureStreamChunks;	// 이번 프레임에 받은 조각
+	std::vector<VkBufferImageCopy> textureStreamCopies;		// 이번 프레임 커맨드 버퍼에 기록할 복사
+	std::chrono::high_resolution_clock::time_point textureStreamStartTime;
+
+	AssetPack assetPack;					// 단일 파일 에셋 팩 매핑 (메시 캐시 / KTX2 가 매핑을 참조하므로 가장 먼저 선언해서 마지막에 소멸)
+	ThreadPool threadPool;					// CPU 작업용 워커 스레드 (모델 변환 등)
+	Ktx2File textureKtx2;					// 스트리밍 중인 KTX2 파일 매핑 (producer / 스트리밍 조각이 그대로 가리킴)
+	TextureStream textureStream;			// 텍스처 밉 레벨 스트리밍 (threadPool / textureKtx2 를 쓰므로 그 뒤에 선언해서 먼저 소멸)
+	MeshData meshData;						// Assimp 임포트 결과 (캐시를 쓰면 비워짐)
+	MeshCache meshCache;
+	const GpuVertex* vertexData = nullptr;	// 업로드할 정점 배열 (캐시 매핑 또는 meshData)
+	uint32_t vertexCount = 0;
+	const uint16_t* index16Data = nullptr;	// 업로드할 16bit 인덱스 배열 (캐시 매핑 또는 meshData)
+	uint32_t index16Count = 0;
+	const uint32_t* index32Data = nullptr;	// 업로드할 32bit 인덱스 배열 (캐시 매핑 또는 meshData)
+	uint32_t index32Count = 0;
+	VkDeviceSize index32Offset = 0;			// 인덱스 버퍼에서 32bit 인덱스 구간 시작 위치 (16bit 구간 뒤)
+	const SubMesh* subMeshData = nullptr;	// 서브 메시별 draw 범위 (캐시 매핑 또는 meshData)
+	uint32_t subMeshCount = 0;
+	const Meshlet* meshletData = nullptr;	// 서브 메시별 메시렛 (캐시 매핑 또는 meshData)
+	uint32_t meshletCount = 0;
+	MeshletCullParams meshletCullParams;	// 이번 프레임 카메라 (updateUniformBuffer 에서 갱신)
+	std::vector<MeshletDraw> meshletDraws;	// 이번 프레임에 컬링을 통과한 draw 목록
+	const MeshLod* lodData = nullptr;		// 서브 메시별 LOD 구간 (캐시 매핑 또는 meshData)
+	uint32_t lodCount = 0;
+	MeshLodSelectParams meshLodSelectParams;	// 이번 프레임 LOD 선택용 카메라 (updateUniformBuffer 에서 갱신)
+	GpuBuffer vertexBuffer;
+	GpuMemory vertexBufferAllocation;
+	GpuBuffer indexBuffer;
+	GpuMemory indexBufferAllocation;
+
+	GpuBuffer uniformRingBuffer;			// 프레임별 영역으로 나눈 유니폼 링 버퍼 (영구 매핑)
+	GpuMemory uniformRingAllocation;
+	UniformRing uniformRing;
+	uint32_t frameUniformOffset = 0;		// 이번 프레임 UniformBufferObject 의 dynamic offset
+
+	std::vector<GpuInstance> instances;		// 인스턴스 배치 (매 프레임 회전을 곱해서 인스턴스 링에 기록)
+	InstanceDrawMode instanceDrawMode = INSTANCE_DRAW_INSTANCED;
+	GpuBuffer instanceRingBuffer;			// 프레임별 영역으로 나눈 인스턴스 storage buffer (영구 매핑)
+	GpuMemory instanceRingAllocation;
+	UniformRing instanceRing;
+	uint32_t frameInstanceOffset = 0;		// 이번 프레임 인스턴스 배열의 dynamic offset
+	const GpuInstance* frameInstanceData = nullptr;	// 이번 프레임 인스턴스 링 영역 (readback 검사 기준값 계산용)
+	uint32_t frameInstanceCount = 0;		// 이번 프레임 인스턴스 링에 기록한 인스턴스 수 (CPU 컬링이면 남은 수)
+	SceneBvh instanceBvh;					// INSTANCE_DRAW_CPU_CULLED: 인스턴스 AABB 위의 BVH (격자를 만들 때마다 다시 생성)
+	std::vector<uint32_t> visibleInstances;	// 이번 프레임 인스턴스 링에 기록한 인스턴스 번호 (CPU 컬링이면 남은 것만, LOD 버킷 순서)
+	InstanceLodBuckets instanceLodBuckets;	// 여러 인스턴스 instanced draw 의 서브 메시 / LOD 별 인스턴스 링 구간
+	std::vector<float> instanceLodDistances;	// 인스턴스별 바운딩 구까지 모델 좌표 거리 (LOD 버킷 정렬 키)
+	float instanceBoundRadius = 0.0f;		// 모든 서브 메시 바운딩 구를 덮는 모델 좌표 반지름 (회전과 무관)
+
+	bool gpuCullSupported = false;			// drawIndirectCount / multiDrawIndirect / drawIndirectFirstInstance 지원 여부
+	VkDescriptorSetLayout cullDescriptorSetLayout;
+	VkPipelineLayout cullPipelineLayout;
+	GpuPipeline cullPipeline;				// 컴퓨트 컬링 파이프라인
+	std::vector<VkDescriptorSet> cullDescriptorSets;	// 프레임별 (명령 / 개수 구간이 프레임마다 다름)
+	std::vector<GpuCullSubMesh> cullSubMeshes;	// 서브 메시 바운딩 구 / draw 범위 표 (readback 검사 기준값 계산에도 사용)
+	GpuBuffer cullSubMeshBuffer;
+	GpuMemory cullSubMeshAllocation;
+	GpuBuffer cullLodBuffer;				// 서브 메시 LOD 구간 표 (lodData 그대로, 컴퓨트 셰이더가 인스턴스별 LOD 선택)
+	GpuMemory cullLodAllocation;
+	GpuBuffer drawCommandBuffer;			// 프레임별 압축된 VkDrawIndexedIndirectCommand (서브 메시마다 인스턴스 수만큼의 구간)
+	GpuMemory drawCommandAllocation;
+	VkDeviceSize drawCommandFrameSize = 0;
+	uint32_t cullDrawCapacity = 0;			// 서브 메시별 명령 구간 최대 크기 (GPU 컬링으로 그릴 수 있는 최대 인스턴스 수)
+	GpuBuffer drawCountBuffer;				// 프레임별 서브 메시 draw 수 (호스트에서 readback 가능)
+	GpuMemory drawCountAllocation;
+	VkDeviceSize drawCountFrameSize = 0;
+	GpuCullConstants cullConstants{};		// 이번 프레임 frustum 평면 / 인스턴스 수 (updateUniformBuffer 에서 갱신)
+	std::vector<GpuCullReference> cullReferences;	// --cull-check: 프레임별 제출한 컬링의 CPU 기준값
+	std::vector<bool> cullReferenceValid;
+	uint32_t cullCheckFrames = 0;			// 비교한 프레임 수
+	uint32_t cullCheckCulledFrames = 0;		// 일부만 남은 (컬링이 실제로 일어난) 프레임 수
+
+	VkQueryPool timestampQueryPool = VK_NULL_HANDLE;	// 프레임마다 렌더 패스 앞뒤 timestamp 2 개 (지원하지 않으면 VK_NULL_HANDLE)
+	float timestampPeriod = 0.0f;			// timestamp 1 틱의 ns
+	std::vector<bool> timestampWritten;		// 프레임별 timestamp 를 기록해서 제출했는지
+	double frameRecordMs = 0.0;				// 이번 프레임 인스턴스 기록 + 커맨드 버퍼 기록 CPU 시간
+	double frameCommandRecordMs = 0.0;		// 그중 커맨드 버퍼 기록 CPU 시간
+	double frameGpuMs = 0.0;				// 펜스를 기다린 프레임의 렌더 패스 GPU 시간
+	uint32_t sweepStep = 0;					// --instance-sweep 진행 상태 (단계 = 인스턴스 수 x draw 방식)
+	uint32_t sweepFrame = 0;
+	double sweepRecordMs = 0.0;
+	double sweepGpuMs = 0.0;
+	uint32_t sweepGpuSamples = 0;
+	std::vector<uint32_t> recordSweepThreads;	// --record-sweep 에서 측정할 기록 스레드 수 (0, 1, 2, 4, ..., 슬롯 수)
+	uint32_t recordSweepStep = 0;
+	double recordSweepBaselineMs = 0.0;		// 직접 기록 (스레드 0) 단계의 기록 시간
 
 	VkDescriptorPool descriptorPool;
 	std::vector<VkDescriptorSet> descriptorSets;
-	
-	std::vector<VkCommandBuffer> commandBuffers;
 
 	std::vector<VkSemaphore> imageAvailableSemaphores;
 	std::vector<VkSemaphore> renderFinishedSemaphores;
 	std::vector<VkFence> inFlightFences;
+	bool surfaceMaintenanceEnabled = false;	// VK_EXT_surface_maintenance1 (VK_EXT_swapchain_maintenance1 의 인스턴스 쪽 요구 사항)
+	bool presentFenceSupported = false;		// VK_EXT_swapchain_maintenance1 present 펜스 사용 여부
+	std::vector<VkFence> presentFences;		// 프레임별 vkQueuePresentKHR 완료 펜스 (presentFenceSupported 일 때만)
 	uint32_t currentFrame = 0;
 
 	bool framebufferResized = false;
@@ -243,17 +382,22 @@ private:
 
 	// 렌더링을 위한 초기 setting
 	void initVulkan() {
+		openAssetPack();
 		createInstance();
 		setupDebugMessenger();
 		createSurface();
 		pickPhysicalDevice();
 		createLogicalDevice();
+		createGpuAllocator();
+		createDeletionQueue();
 		createSwapChain();
 		createImageViews();
 		createRenderPass();
 		createDescriptorSetLayout();
 		createGraphicsPipeline();
+		createCullPipeline();
 		createCommandPool();
+		createUploadQueue();
 		createColorResources();
 		createDepthResources();
 		createFramebuffers();	
@@ -264,10 +408,17 @@ private:
 		createVertexBuffer();
 		createIndexBuffer();
 		createUniformBuffers();		
+		createInstanceBuffers();
+		createCullBuffers();
+		createTextureStreamBuffers();
 		createDescriptorPool();
 		createDescriptorSets();
-		createCommandBuffers();
+		createCullDescriptorSets();
 		createSyncObjects();
+		createTimestampQueries();
+		uploadQueue.flush();		// 예약한 초기 업로드 제출 (첫 프레임이 GPU 에서 타임라인 값을 기다리므로 CPU 는 대기하지 않음)
+		printUploadQueueStats();
+		printGpuAllocatorStats();
 	}
 
 	/*
@@ -279,65 +430,91 @@ private:
 			drawFrame();
 		}
 		vkDeviceWaitIdle(device);  // 종료시 실행 중인 GPU 작업을 전부 기다림
+		if (presentFenceSupported) {
+			// 표시 요청은 vkDeviceWaitIdle 이 기다리지 않으므로 스왑 체인 파괴 전에 present 펜스 대기
+			vkWaitForFences(device, static_cast<uint32_t>(presentFences.size()), presentFences.data(), VK_TRUE, UINT64_MAX);
+		}
 	}
 
-	// FrameBuffer, ImageView, SwapChain 삭제
+	/*
+		FrameBuffer, ImageView, 멀티샘플링 attachment 해제
+		(삭제 큐에 넣기만 하고 지금까지 제출한 프레임이 끝나면 파괴)
+		attachment 메모리는 재생성할 때 재사용하므로 유지, 스왑 체인은 새 스왑 체인의 oldSwapchain 으로 넘긴 뒤 해제
+	*/
 	void cleanupSwapChain() {
+		// 깊이 버퍼 이미지, 이미지 뷰 해제
+		depthImageView.reset();
+		depthImage.reset();
 
-		// 깊이 버퍼 이미지, 이미지 뷰, 메모리 삭제 
-        vkDestroyImageView(device, depthImageView, nullptr);
-        vkDestroyImage(device, depthImage, nullptr);
-        vkFreeMemory(device, depthImageMemory, nullptr);
+		// 컬러 버퍼 이미지, 이미지 뷰 해제
+		colorImageView.reset();
+		colorImage.reset();
 
-		// 컬러 버퍼 이미지, 이미지 뷰, 메모리 삭제
-		vkDestroyImageView(device, colorImageView, nullptr);
-		vkDestroyImage(device, colorImage, nullptr);
-		vkFreeMemory(device, colorImageMemory, nullptr);
-		
-		// 프레임 버퍼 배열 삭제
-		for (auto framebuffer : swapChainFramebuffers) {
-			vkDestroyFramebuffer(device, framebuffer, nullptr);
-		}
-		// 이미지뷰 삭제
-		for (auto imageView : swapChainImageViews) {
-			vkDestroyImageView(device, imageView, nullptr);
-		}
-		// 스왑 체인 파괴
-		vkDestroySwapchainKHR(device, swapChain, nullptr);
+		// 프레임 버퍼 배열, 이미지뷰 해제
+		swapChainFramebuffers.clear();
+		swapChainImageViews.clear();
 	}
 
 	/*
 		[사용한 자원들 정리]
 	*/
 	void cleanup() {
-		// 스왑 체인 파괴
+		// 텍스처 스트리밍 스레드 종료 대기
+		textureStream.stop();
+		textureKtx2.close();
+
+		// [GPU 객체 해제]
+		// 삭제 큐에 넣기만 하고 (버퍼 / 이미지를 메모리보다 먼저 해제해서 그 순서로 파괴) 장치 파괴 전에 한 번에 파괴
 		cleanupSwapChain();
+		swapChain.reset();
+		depthImageAllocation.reset();								// 멀티샘플링 attachment 메모리
+		colorImageAllocation.reset();
 
-		vkDestroyPipeline(device, graphicsPipeline, nullptr);      	// 파이프라인 객체 삭제
+		graphicsPipeline.reset();									// 파이프라인 객체
 		vkDestroyPipelineLayout(device, pipelineLayout, nullptr);  	// 파이프라인 레이아웃 삭제
+		if (gpuCullSupported) {
+			cullPipeline.reset();									// 컴퓨트 컬링 파이프라인
+			vkDestroyPipelineLayout(device, cullPipelineLayout, nullptr);
+			vkDestroyDescriptorSetLayout(device, cullDescriptorSetLayout, nullptr);
+		}
 		vkDestroyRenderPass(device, renderPass, nullptr);         	// 렌더 패스 삭제
 
-        for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
-			// 매핑된 거 해제 안하나?????????????????????
-            vkDestroyBuffer(device, uniformBuffers[i], nullptr);	// 유니폼 버퍼 객체 삭제
-            vkFreeMemory(device, uniformBuffersMemory[i], nullptr);	// 유니폼 버퍼에 할당된 메모리 삭제
-        }
+		// 매핑은 할당기 블록 단위라 블록을 해제할 때 같이 해제됨
+		uniformRingBuffer.reset();									// 유니폼 링 버퍼 객체
+		uniformRingAllocation.reset();								// 유니폼 링 버퍼에 할당된 메모리
+		instanceRingBuffer.reset();									// 인스턴스 링 버퍼 객체
+		instanceRingAllocation.reset();								// 인스턴스 링 버퍼에 할당된 메모리
+		cullSubMeshBuffer.reset();									// GPU 컬링 서브 메시 표 / LOD 표 / 명령 / 개수 버퍼
+		cullSubMeshAllocation.reset();
+		cullLodBuffer.reset();
+		cullLodAllocation.reset();
+		drawCommandBuffer.reset();
+		drawCommandAllocation.reset();
+		drawCountBuffer.reset();
+		drawCountAllocation.reset();
 
 		vkDestroyDescriptorPool(device, descriptorPool, nullptr);			// 디스크립터 풀 삭제
- 
-		vkDestroySampler(device, textureSampler, nullptr);					// 샘플러 삭제
-		vkDestroyImageView(device, textureImageView, nullptr);				// 텍스처 이미지뷰 삭제
 
-		vkDestroyImage(device, textureImage, nullptr);						// 텍스처 객체 삭제
-		vkFreeMemory(device, textureImageMemory, nullptr);					// 텍스처에 할당된 메모리 삭제
-        
+		for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+			textureStreamBuffers[i].reset();								// 텍스처 스트리밍 업로드 버퍼
+			textureStreamBuffersAllocation[i].reset();
+		}
+
+		textureSamplers.clear();											// 샘플러
+		textureImageView.reset();											// 텍스처 이미지뷰
+		textureImage.reset();												// 텍스처 객체
+		textureImageAllocation.reset();										// 텍스처에 할당된 메모리
+
 		vkDestroyDescriptorSetLayout(device, descriptorSetLayout, nullptr);	// 디스크립터 셋 레이아수 삭제
 
-		vkDestroyBuffer(device, indexBuffer, nullptr);				// 인덱스 버퍼 객체 삭제
-		vkFreeMemory(device, indexBufferMemory, nullptr);			// 인덱스 버퍼에 할당된 메모리 삭제
-		
-		vkDestroyBuffer(device, vertexBuffer, nullptr);				// 버텍스 버퍼 객체 삭제
-		vkFreeMemory(device, vertexBufferMemory, nullptr);			// 버텍스 버퍼에 할당된 메모리 삭제
+		indexBuffer.reset();										// 인덱스 버퍼 객체
+		indexBufferAllocation.reset();								// 인덱스 버퍼에 할당된 메모리
+
+		vertexBuffer.reset();										// 버텍스 버퍼 객체
+		vertexBufferAllocation.reset();								// 버텍스 버퍼에 할당된 메모리
+
+		meshCache.close();											// 메시 캐시 매핑 해제
+		assetPack.close();											// 에셋 팩 매핑 해제
 
 		// 세마포어, 펜스 파괴
 		for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
@@ -345,8 +522,21 @@ private:
 			vkDestroySemaphore(device, imageAvailableSemaphores[i], nullptr);
 			vkDestroyFence(device, inFlightFences[i], nullptr);
 		}
+		for (VkFence fence : presentFences) {
+			vkDestroyFence(device, fence, nullptr);
+		}
+
+		if (timestampQueryPool != VK_NULL_HANDLE) {
+			vkDestroyQueryPool(device, timestampQueryPool, nullptr);	// timestamp 쿼리 풀 파괴
+		}
+
+		frameCommandPools.destroy(); 	  							// 커맨드 풀 파괴 (커맨드 버퍼도 같이 해제)
 
-		vkDestroyCommandPool(device, commandPool, nullptr); 	  	// 커맨드 풀 파괴
+		deletionQueue.destroy();									// 해제한 GPU 객체 전부 파괴 (디버그 빌드는 해제하지 않은 핸들 출력)
+
+		uploadQueue.destroy();										// 업로드 배치 대기 후 스테이징 링 / 커맨드 풀 해제
+
+		gpuAllocator.destroy();										// 할당기 블록 전체 해제
 
 		vkDestroyDevice(device, nullptr);                         	// 논리적 장치 파괴
 
@@ -376,13 +566,10 @@ private:
 			glfwWaitEvents(); // 다음 이벤트 발생 전까지 대기하여 CPU 사용률을 줄이는 함수 
 		}
 
-		// 모든 GPU 작업 종료될 때까지 대기 (사용중인 리소스를 건들지 않기 위해)
-		vkDeviceWaitIdle(device);
-
-		// 스왑 체인 관련 리소스 정리
+		// 스왑 체인 관련 리소스 해제 (GPU 작업을 기다리지 않음, 실행 중인 프레임이 끝나면 삭제 큐에서 파괴)
 		cleanupSwapChain();
 
-		// 현재 window 크기에 맞게 SwapChain, DepthResource, ImageView, FrameBuffer 재생성
+		// 현재 window 크기에 맞게 SwapChain, DepthResource, ImageView, FrameBuffer 재생성 (이전 스왑 체인은 새 스왑 체인을 만든 뒤 해제)
 		createSwapChain();
 		createImageViews();
 		createColorResources();
@@ -411,7 +598,7 @@ private:
 		appInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
 		appInfo.pEngineName = "No Engine";
 		appInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
-		appInfo.apiVersion = VK_API_VERSION_1_0;
+		appInfo.apiVersion = VK_API_VERSION_1_2;			// 타임라인 세마포어 (1.2 core)
 
 		// 인스턴스 생성을 위한 정보를 담은 구조체
 		VkInstanceCreateInfo createInfo{};
@@ -513,6 +700,9 @@ private:
 		QueueFamilyIndices indices = findQueueFamilies(physicalDevice);
 		// 큐 패밀리의 인덱스들을 set으로 래핑
 		std::set<uint32_t> uniqueQueueFamilies = {indices.graphicsFamily.value(), indices.presentFamily.value()};
+		if (indices.transferFamily.has_value()) {
+			uniqueQueueFamilies.insert(indices.transferFamily.value());
+		}
 
 		// 큐 생성을 위한 정보 설정 
 		std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
@@ -536,6 +726,31 @@ private:
         deviceFeatures.samplerAnisotropy = VK_TRUE;		// 이방성 필터링 사용 설정
 		deviceFeatures.sampleRateShading = VK_TRUE; 	// 디바이스에 샘플 셰이딩 기능 활성화
 
+		// BC 압축 텍스처는 지원하는 경우만 활성화 (미지원시 KTX2 를 CPU 에서 복원)
+		VkPhysicalDeviceFeatures supportedFeatures;
+		vkGetPhysicalDeviceFeatures(physicalDevice, &supportedFeatures);
+		deviceFeatures.textureCompressionBC = supportedFeatures.textureCompressionBC;
+
+		// GPU 컬링 (컴퓨트로 기록한 간접 명령을 개수 버퍼와 함께 그림) 은 필요한 기능을 모두 지원하는 경우만 사용
+		VkPhysicalDeviceVulkan12Features supportedVulkan12Features{};
+		supportedVulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+		// present 펜스는 surface 확장과 VK_EXT_swapchain_maintenance1 을 모두 지원하는 경우만 사용
+		VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT supportedSwapchainMaintenance{};
+		supportedSwapchainMaintenance.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SWAPCHAIN_MAINTENANCE_1_FEATURES_EXT;
+		bool swapchainMaintenanceAvailable = surfaceMaintenanceEnabled && deviceExtensionSupported(physicalDevice, VK_EXT_SWAPCHAIN_MAINTENANCE_1_EXTENSION_NAME);
+		if (swapchainMaintenanceAvailable) {
+			supportedVulkan12Features.pNext = &supportedSwapchainMaintenance;
+		}
+		VkPhysicalDeviceFeatures2 supportedFeatures2{};
+		supportedFeatures2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+		supportedFeatures2.pNext = &supportedVulkan12Features;
+		vkGetPhysicalDeviceFeatures2(physicalDevice, &supportedFeatures2);
+		presentFenceSupported = swapchainMaintenanceAvailable && supportedSwapchainMaintenance.swapchainMaintenance1;
+		gpuCullSupported = options.gpuCulling && supportedVulkan12Features.drawIndirectCount
+			&& supportedFeatures.multiDrawIndirect && supportedFeatures.drawIndirectFirstInstance;
+		deviceFeatures.multiDrawIndirect = gpuCullSupported ? VK_TRUE : VK_FALSE;
+		deviceFeatures.drawIndirectFirstInstance = gpuCullSupported ? VK_TRUE : VK_FALSE;
+
 		// 논리적 장치 생성을 위한 정보 등록
 		VkDeviceCreateInfo createInfo{};
 		createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -543,9 +758,25 @@ private:
 		createInfo.pQueueCreateInfos = queueCreateInfos.data();
 		createInfo.pEnabledFeatures = &deviceFeatures;
 
+		// 업로드 배치 완료 추적용 타임라인 세마포어 활성화
+		VkPhysicalDeviceVulkan12Features vulkan12Features{};
+		vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+		vulkan12Features.timelineSemaphore = VK_TRUE;
+		vulkan12Features.drawIndirectCount = gpuCullSupported ? VK_TRUE : VK_FALSE;
+		createInfo.pNext = &vulkan12Features;
+
+		VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT swapchainMaintenanceFeatures{};
+		swapchainMaintenanceFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SWAPCHAIN_MAINTENANCE_1_FEATURES_EXT;
+		swapchainMaintenanceFeatures.swapchainMaintenance1 = VK_TRUE;
+		std::vector<const char*> enabledExtensions(deviceExtensions.begin(), deviceExtensions.end());
+		if (presentFenceSupported) {
+			vulkan12Features.pNext = &swapchainMaintenanceFeatures;
+			enabledExtensions.push_back(VK_EXT_SWAPCHAIN_MAINTENANCE_1_EXTENSION_NAME);
+		}
+
 		// 확장 설정
-		createInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
-		createInfo.ppEnabledExtensionNames = deviceExtensions.data();
+		createInfo.enabledExtensionCount = static_cast<uint32_t>(enabledExtensions.size());
+		createInfo.ppEnabledExtensionNames = enabledExtensions.data();
 		
 		// 구버전 호환을 위해 디버그 모드일 경우
 		// 검증 레이어를 포함 시키지만, 현대 시스템에서는 논리적 장치의 레이어를 안 씀
@@ -564,6 +795,36 @@ private:
 		// 큐 핸들 가져오기
 		vkGetDeviceQueue(device, indices.graphicsFamily.value(), 0, &graphicsQueue);
 		vkGetDeviceQueue(device, indices.presentFamily.value(), 0, &presentQueue);
+		if (indices.transferFamily.has_value()) {
+			vkGetDeviceQueue(device, indices.transferFamily.value(), 0, &transferQueue);
+		} else {
+			transferQueue = graphicsQueue;
+		}
+	}
+
+	// 장치 메모리 할당기 초기화 (메모리 유형 / 힙 정보와 버퍼-이미지 배치 간격)
+	void createGpuAllocator() {
+		VkPhysicalDeviceMemoryProperties memProperties;
+		vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memProperties);
+
+		VkPhysicalDeviceProperties properties;
+		vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+		gpuAllocator.init(device, memProperties, properties.limits.bufferImageGranularity, defaultGpuAllocatorFunctions());
+	}
+
+	// 디버그 빌드 (검증 레이어 사용) 에서는 살아있는 핸들을 기록해서 종료할 때 해제하지 않은 핸들 출력
+	void createDeletionQueue() {
+		deletionQueue.init(device, gpuAllocator, enableValidationLayers, defaultDeletionQueueFunctions());
+	}
+
+	// 초기화 후 할당기 상태 출력 (리소스마다 vkAllocateMemory 를 부를 때와 호출 수 비교)
+	void printGpuAllocatorStats() {
+		GpuAllocatorStats stats = gpuAllocator.stats();
+		std::cout << "[gpuAllocator] " << stats.allocationCount << " allocations in " << stats.blockCount << " blocks ("
+				  << stats.usedBytes / (1024.0f * 1024.0f) << " / " << stats.blockBytes / (1024.0f * 1024.0f) << " MB in use, "
+				  << "fragmentation " << stats.fragmentation * 100.0f << "%, "
+				  << stats.deviceAllocations << " vkAllocateMemory calls for " << stats.totalAllocations << " allocations)" << std::endl;
 	}
 
 	/*
@@ -631,16 +892,21 @@ private:
 		createInfo.presentMode = presentMode; // 프레젠트 모드 설정
 		createInfo.clipped = VK_TRUE; // 실제 컴퓨터 화면에 보이지 않는 부분을 렌더링 할 것인지 설정 (VK_TRUE = 렌더링 하지 않겠다)
 
-		createInfo.oldSwapchain = VK_NULL_HANDLE; // 재활용할 이전 스왑체인 설정 (만약 설정한다면 새로운 할당을 하지 않고 가능한만큼 이전 스왑체인 리소스 재활용)
+		createInfo.oldSwapchain = swapChain; // 재활용할 이전 스왑체인 설정 (재생성시 이전 스왑체인 리소스를 가능한만큼 재활용, 처음이면 VK_NULL_HANDLE)
 
 		/* 
 		[스왑 체인 생성] 
 		스왑 체인 생성시 이미지들도 설정대로 만들어지고, 
 	 	만약 렌더링에 필요한 추가 이미지가 있으면 따로 만들어야 함 
 		*/
-		if (vkCreateSwapchainKHR(device, &createInfo, nullptr, &swapChain) != VK_SUCCESS) {
+		VkSwapchainKHR newSwapChain;
+		if (vkCreateSwapchainKHR(device, &createInfo, nullptr, &newSwapChain) != VK_SUCCESS) {
 			throw std::runtime_error("failed to create swap chain!");
 		}
+		// 이전 스왑 체인은 삭제 큐로 해제 (큐를 기다리지 않음, 이미 표시 요청한 이미지가 있으므로 실행 중인 프레임이 끝난 뒤 파괴)
+		// 프레임 펜스는 vkQueuePresentKHR 를 포함하지 않으므로 present 펜스가 없으면 SWAPCHAIN_RETIRE_DELAY_FRAMES 프레임 더 늦게 파괴
+		swapChain.reset(presentFenceSupported ? 0 : SWAPCHAIN_RETIRE_DELAY_FRAMES);
+		swapChain = GpuSwapchain(deletionQueue, newSwapChain);
 
 		// 스왑 체인 이미지 개수 저장
 		vkGetSwapchainImagesKHR(device, swapChain, &imageCount, nullptr);
@@ -662,12 +928,10 @@ private:
 	GPU가 이미지에 쓰기 작업할 떄는 x
 	*/ 
 	void createImageViews() {
-		// 이미지의 개수만큼 vector 초기화
-		swapChainImageViews.resize(swapChainImages.size());
-
 		// 이미지의 개수만큼 이미지뷰 생성
+		swapChainImageViews.clear();
 		for (size_t i = 0; i < swapChainImages.size(); i++) {
-			swapChainImageViews[i] = createImageView(swapChainImages[i], swapChainImageFormat, VK_IMAGE_ASPECT_COLOR_BIT, 1);
+			swapChainImageViews.push_back(createImageView(swapChainImages[i], swapChainImageFormat, VK_IMAGE_ASPECT_COLOR_BIT, 1));
 		}
 	}
 
@@ -686,7 +950,7 @@ private:
 		colorAttachment.format = swapChainImageFormat;		 					// 이미지 포맷 (스왑 체인과 일치 시킴)
 		colorAttachment.samples = msaaSamples;			 						// 샘플 개수 (멀티 샘플링을 위한 값 사용)
 		colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;					// 렌더링 전 버퍼 클리어 (렌더링 시작 시 기존 attachment의 데이터 처리 방법)
-		colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE; 				// 렌더링 결과 저장 (렌더링 후 attachment를 메모리에 저장하는 방법 결정)
+		colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE; 			// 저장 x (resolve attachment 로 옮긴 뒤 버리므로 메모리에 기록할 필요 없음 → lazily allocated 메모리 사용 가능)
 		colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE; 		// 이전 데이터 무시 (스텐실 버퍼의 loadOp)
 		colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE; 		// 저장 x (스텐실 버퍼의 storeOp)
 		colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED; 				// 초기 레이아웃 설정을 UNDEFINED로 설정 (초기 데이터 가공을 하지 않기 때문에 가장 빠름)
@@ -780,7 +1044,7 @@ private:
 		VkDescriptorSetLayoutBinding uboLayoutBinding{};
 		uboLayoutBinding.binding = 0;														// 바인딩 위치 지정 (디스크립터 셋 내부의 순서)
 		uboLayoutBinding.descriptorCount = 1;												// 디스크립터의 개수 (구조체는 1개의 디스크립터 취급, 배열 사용시 여러 개 디스크립터 취급)
-		uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;				// 디스크립터의 종류 (현재는 Uniform buffer)
+		uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;		// 디스크립터의 종류 (유니폼 링 안의 위치를 바인딩할 때 dynamic offset 으로 지정)
 		uboLayoutBinding.pImmutableSamplers = nullptr;										// 변경 불가능한(immutable) 샘플러를 사용할 경우 지정하는 포인터인데 지금은 상관 없음
 		uboLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;							// 사용할 스테이지 지정 (현재는 vertex shader에서 사용하고 여러 스테이지 지정 가능)
 
@@ -792,7 +1056,15 @@ private:
 		samplerLayoutBinding.pImmutableSamplers = nullptr;									// 샘플러 불변 설정 (현재 False)
 		samplerLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;						// 사용할 스테이지 지정 (Fragment Stage)
 
-        std::array<VkDescriptorSetLayoutBinding, 2> bindings = {uboLayoutBinding, samplerLayoutBinding};	// 바인딩 정보 2개
+		// 인스턴스 배열 (storage buffer, 인스턴스 링 안의 이번 프레임 위치를 dynamic offset 으로 지정)
+		VkDescriptorSetLayoutBinding instanceLayoutBinding{};
+		instanceLayoutBinding.binding = 2;
+		instanceLayoutBinding.descriptorCount = 1;
+		instanceLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+		instanceLayoutBinding.pImmutableSamplers = nullptr;
+		instanceLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+        std::array<VkDescriptorSetLayoutBinding, 3> bindings = {uboLayoutBinding, samplerLayoutBinding, instanceLayoutBinding};	// 바인딩 정보 3개
 		// 디스크립터 셋 레이아웃을 생성하기 위한 설정 정보를 포함한 구조체
 		VkDescriptorSetLayoutCreateInfo layoutInfo{};
 		layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
@@ -810,9 +1082,10 @@ private:
 	파이프라인 객체는 GPU가 그래픽 또는 컴퓨팅 명령을 실행할 때 필요한 설정을 제공한다.
 	*/ 
 	void createGraphicsPipeline() {
-		// SPIR-V 파일 읽기
-		std::vector<char> vertShaderCode = readFile("./shaders/vert.spv");
-		std::vector<char> fragShaderCode = readFile("./shaders/frag.spv");
+		// SPIR-V 읽기 (에셋 팩에 있으면 매핑된 데이터를 그대로 사용)
+		std::vector<char> vertShaderFile, fragShaderFile;
+		AssetBlob vertShaderCode = loadShaderCode(VERT_SHADER_PATH, vertShaderFile);
+		AssetBlob fragShaderCode = loadShaderCode(FRAG_SHADER_PATH, fragShaderFile);
 
 		// shader module 생성
 		VkShaderModule vertShaderModule = createShaderModule(vertShaderCode);
@@ -846,8 +1119,8 @@ private:
 		VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
 		vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
 
-		auto bindingDescription = Vertex::getBindingDescription();												// 정점 바인딩 정보를 가진 구조체
-		auto attributeDescriptions = Vertex::getAttributeDescriptions();										// 정점 속성 정보를 가진 구조체 배열
+		auto bindingDescription = getBindingDescription<GpuVertex>();											// 정점 바인딩 정보를 가진 구조체 (빌드 옵션으로 선택한 레이아웃)
+		auto attributeDescriptions = getAttributeDescriptions<GpuVertex>();										// 정점 속성 정보를 가진 구조체 배열
 
 		vertexInputInfo.vertexBindingDescriptionCount = 1;														// 정점 바인딩 정보 개수
 		vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescriptions.size());	// 정점 속성 정보 개수
@@ -939,6 +1212,14 @@ private:
 		pipelineLayoutInfo.setLayoutCount = 1; 									// 디스크립터 셋 레이아웃 개수
 		pipelineLayoutInfo.pSetLayouts = &descriptorSetLayout; 					// 디스크립투 셋 레이아웃
 
+		// 서브 메시별 정점 복원 변환 (VertexQuantization) 을 push constant 로 전달
+		VkPushConstantRange pushConstantRange{};
+		pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;				// 정점 셰이더에서만 사용
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(VertexQuantization);
+		pipelineLayoutInfo.pushConstantRangeCount = 1;
+		pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
 		if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &pipelineLayout) != VK_SUCCESS) {
 			throw std::runtime_error("failed to create pipeline layout!");
 		}
@@ -964,24 +1245,86 @@ private:
 
 		// [파이프라인 객체 생성]
 		// 두 번째 매개변수는 상속할 파이프라인
-		if (vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &graphicsPipeline) != VK_SUCCESS) {
+		VkPipeline pipeline;
+		if (vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline) != VK_SUCCESS) {
 			throw std::runtime_error("failed to create graphics pipeline!");
 		}
+		graphicsPipeline = GpuPipeline(deletionQueue, pipeline);
 
 		// 쉐이더 모듈 더 안 쓰므로 제거
 		vkDestroyShaderModule(device, fragShaderModule, nullptr);
 		vkDestroyShaderModule(device, vertShaderModule, nullptr);
 	}
 
+	/*
+		[GPU 컬링 컴퓨트 파이프라인 생성]
+		디스크립터: 0 = 인스턴스 배열 (인스턴스 링, dynamic offset), 1 = 서브 메시 표, 2 = 간접 명령, 3 = draw 개수, 4 = LOD 표
+		frustum 평면 / 인스턴스 수 / LOD 선택용 카메라는 push constant (GpuCullConstants)
+	*/
+	void createCullPipeline() {
+		if (!gpuCullSupported) {
+			return;
+		}
+
+		std::array<VkDescriptorSetLayoutBinding, 5> bindings{};
+		for (uint32_t i = 0; i < bindings.size(); i++) {
+			bindings[i].binding = i;
+			bindings[i].descriptorCount = 1;
+			bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+		}
+		bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+
+		VkDescriptorSetLayoutCreateInfo layoutInfo{};
+		layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+		layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+		layoutInfo.pBindings = bindings.data();
+		if (vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &cullDescriptorSetLayout) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create cull descriptor set layout!");
+		}
+
+		VkPushConstantRange pushConstantRange{};
+		pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(GpuCullConstants);
+
+		VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipelineLayoutInfo.setLayoutCount = 1;
+		pipelineLayoutInfo.pSetLayouts = &cullDescriptorSetLayout;
+		pipelineLayoutInfo.pushConstantRangeCount = 1;
+		pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+		if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &cullPipelineLayout) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create cull pipeline layout!");
+		}
+
+		std::vector<char> cullShaderFile;
+		AssetBlob cullShaderCode = loadShaderCode(CULL_SHADER_PATH, cullShaderFile);
+		VkShaderModule cullShaderModule = createShaderModule(cullShaderCode);
+
+		VkComputePipelineCreateInfo pipelineInfo{};
+		pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+		pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+		pipelineInfo.stage.module = cullShaderModule;
+		pipelineInfo.stage.pName = "main";
+		pipelineInfo.layout = cullPipelineLayout;
+
+		VkPipeline pipeline;
+		if (vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create cull pipeline!");
+		}
+		cullPipeline = GpuPipeline(deletionQueue, pipeline);
+
+		vkDestroyShaderModule(device, cullShaderModule, nullptr);
+	}
+
 	/*
 		[프레임 버퍼 생성]
 		프레임 버퍼를 생성하고 SwapChain의 이미지를 attachment로 설정 
 		(depth buffer 같은 image가 더 필요하면 따로 image를 생성해서 attachment에 추가해야 함)
 	*/
 	void createFramebuffers() {
-		// 프레임 버퍼 배열 초기화
-		swapChainFramebuffers.resize(swapChainImageViews.size());
-
 		// 이미지 뷰마다 프레임 버퍼 1개씩 생성
 		for (size_t i = 0; i < swapChainImageViews.size(); i++) {
 			std::array<VkImageView, 3> attachments = {
@@ -999,9 +1342,11 @@ private:
 			framebufferInfo.height = swapChainExtent.height;								// 프레임 버퍼 height
 			framebufferInfo.layers = 1;														// 레이어 수
 
-			if (vkCreateFramebuffer(device, &framebufferInfo, nullptr, &swapChainFramebuffers[i]) != VK_SUCCESS) {
+			VkFramebuffer framebuffer;
+			if (vkCreateFramebuffer(device, &framebufferInfo, nullptr, &framebuffer) != VK_SUCCESS) {
 				throw std::runtime_error("failed to create framebuffer!");
 			}
+			swapChainFramebuffers.emplace_back(deletionQueue, framebuffer);
 		}
 	}
 
@@ -1010,28 +1355,57 @@ private:
 		커맨드 풀이란?
 		1. 커맨드 버퍼들을 관리한다.
 		2. 큐 패밀리당 1개의 커맨드 풀이 필요하다.
+		3. 여러 스레드가 같은 커맨드 풀을 동시에 쓸 수 없으므로 프레임마다, 기록 스레드마다 풀을 따로 만든다. (FrameCommandPools)
+		커맨드 버퍼도 같이 할당 (프레임마다 primary 1 개 + 스레드 풀의 스레드 수만큼 secondary)
 	*/
 	void createCommandPool() {
 		// 큐 패밀리 인덱스 가져오기
 		QueueFamilyIndices queueFamilyIndices = findQueueFamilies(physicalDevice);
+		frameCommandPools.init(device, queueFamilyIndices.graphicsFamily.value(), MAX_FRAMES_IN_FLIGHT, threadPool.threadCount());
+
+		// 기록 스레드 수 (--record-sweep 이면 0 부터 2 배씩 슬롯 수까지 차례로 측정)
+		recordThreadCount = std::min(options.recordThreads, frameCommandPools.slotCount());
+		if (options.recordSweep) {
+			recordSweepThreads.push_back(0);
+			for (uint32_t threads = 1; threads < frameCommandPools.slotCount(); threads *= 2) {
+				recordSweepThreads.push_back(threads);
+			}
+			recordSweepThreads.push_back(frameCommandPools.slotCount());
+			recordThreadCount = recordSweepThreads[0];
+		}
+	}
+
+	/*
+		[업로드 큐 생성]
+		리소스마다 스테이징 버퍼 생성 → 제출 → vkQueueWaitIdle 하던 것을 스테이징 링 1 개 + 배치 제출로 대체
+		전송 전용 큐 패밀리가 있으면 그 큐에서 복사하고 그래픽스 큐 패밀리로 소유권 이전 (렌더링과 병렬로 실행)
+		스테이징 offset 은 BC 블록 (16 byte) 과 optimalBufferCopyOffsetAlignment 의 배수로 정렬
+		(전송 전용 큐는 minImageTransferGranularity 가 (1, 1, 1) 이 아닐 수 있지만 전체 레벨 복사만 하므로 상관없음)
+	*/
+	void createUploadQueue() {
+		QueueFamilyIndices queueFamilyIndices = findQueueFamilies(physicalDevice);
+		uint32_t graphicsFamily = queueFamilyIndices.graphicsFamily.value();
+		uint32_t transferFamily = queueFamilyIndices.transferFamily.value_or(graphicsFamily);
 
-		VkCommandPoolCreateInfo poolInfo{};
-		poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-		poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT; 		// 커맨드 버퍼를 개별적으로 재설정할 수 있도록 설정 
-																				// (이게 아니면 커맨드 풀의 모든 커맨드 버퍼 설정이 한 번에 이루어짐)
-		poolInfo.queueFamilyIndex = queueFamilyIndices.graphicsFamily.value(); 	// 그래픽스 큐 인덱스 등록 (대응시킬 큐 패밀리 등록)
+		VkPhysicalDeviceProperties properties;
+		vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+		VkDeviceSize copyAlignment = std::max<VkDeviceSize>(16, properties.limits.optimalBufferCopyOffsetAlignment);
 
-		// 커맨드 풀 생성
-		if (vkCreateCommandPool(device, &poolInfo, nullptr, &commandPool) != VK_SUCCESS) {
-			throw std::runtime_error("failed to create command pool!");
-		}
+		uploadQueue.init(device, transferQueue, transferFamily, graphicsFamily, gpuAllocator, UPLOAD_STAGING_SIZE, copyAlignment);
+	}
+
+	// 초기화 후 업로드 큐 상태 출력 (리소스마다 제출 / 대기하던 때와 GPU 왕복 수 비교)
+	void printUploadQueueStats() {
+		const UploadQueueStats& stats = uploadQueue.stats();
+		std::cout << "[uploadQueue] " << (uploadQueue.transfersOwnership() ? "transfer queue, " : "graphics queue, ") << stats.copies << " uploads (" << stats.bytes / 1024.0f << " KB) in "
+				  << stats.batches << " submits, " << stats.waits << " CPU waits" << std::endl;
 	}
 
 	// 멀티샘플링용 color Image생성
     void createColorResources() {
         VkFormat colorFormat = swapChainImageFormat;
 
-        createImage(swapChainExtent.width, swapChainExtent.height, 1, msaaSamples, colorFormat, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, colorImage, colorImageMemory);
+        createTransientAttachment(colorFormat, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, colorImage, colorImageAllocation);
         colorImageView = createImageView(colorImage, colorFormat, VK_IMAGE_ASPECT_COLOR_BIT, 1);
     }
 
@@ -1040,10 +1414,60 @@ private:
 		// depth image의 format 결정
         VkFormat depthFormat = findDepthFormat();
 
-        createImage(swapChainExtent.width, swapChainExtent.height, 1, msaaSamples, depthFormat, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, depthImage, depthImageMemory);
+        createTransientAttachment(depthFormat, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, depthImage, depthImageAllocation);
         depthImageView = createImageView(depthImage, depthFormat, VK_IMAGE_ASPECT_DEPTH_BIT, 1);
     }
 
+	/*
+		[렌더 패스 안에서만 쓰는 멀티샘플링 attachment 생성]
+		clear 후 resolve 되거나 (color) 버려지는 (depth, storeOp DONT_CARE) attachment 는 메모리에 내용을 남길 필요가 없다.
+		1. TRANSIENT_ATTACHMENT 용도로 만들고, LAZILY_ALLOCATED 메모리 유형이 있으면 사용
+		   (타일 기반 GPU 는 타일 메모리에서만 처리하고 실제 메모리를 거의 잡지 않음, 없으면 DEVICE_LOCAL)
+		2. 스왑 체인 재생성시 메모리는 해제하지 않고 (cleanupSwapChain 은 이미지 / 뷰만 삭제) 새 이미지가 들어가면 그대로 재사용
+		   들어가지 않을 때만 ATTACHMENT_GROWTH 만큼 여유를 두고 다시 할당 (창 크기 조절 중 할당 반복 방지)
+	*/
+	void createTransientAttachment(VkFormat format, VkImageUsageFlags usage, GpuImage& image, GpuMemory& imageAllocation) {
+		VkImageCreateInfo imageInfo{};
+		imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		imageInfo.imageType = VK_IMAGE_TYPE_2D;
+		imageInfo.extent.width = swapChainExtent.width;
+		imageInfo.extent.height = swapChainExtent.height;
+		imageInfo.extent.depth = 1;
+		imageInfo.mipLevels = 1;
+		imageInfo.arrayLayers = 1;
+		imageInfo.format = format;
+		imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+		imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		imageInfo.usage = usage | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;		// 렌더 패스 밖에서 내용을 읽거나 쓰지 않음
+		imageInfo.samples = msaaSamples;
+		imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+		VkImage newImage;
+		if (vkCreateImage(device, &imageInfo, nullptr, &newImage) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create image!");
+		}
+		image = GpuImage(deletionQueue, newImage);
+
+		VkMemoryRequirements memRequirements;
+		vkGetImageMemoryRequirements(device, image, &memRequirements);
+
+		VkMemoryPropertyFlags properties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+		if (!gpuAllocator.hasMemoryType(memRequirements.memoryTypeBits, properties)) {
+			properties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+		}
+
+		// 이전 스왑 체인의 구간에 들어가면 재사용
+		// (이전 이미지를 쓰는 프레임이 아직 실행 중일 수 있지만 같은 그래픽스 큐에서 렌더 패스 의존성으로 순서가 보장됨)
+		// 들어가지 않으면 이전 구간은 삭제 큐로 해제 (실행 중인 프레임이 끝난 뒤 반환)
+		if (!gpuAllocator.canReuse(imageAllocation.get(), memRequirements, properties)) {
+			VkMemoryRequirements grownRequirements = memRequirements;
+			grownRequirements.size += static_cast<VkDeviceSize>(memRequirements.size * ATTACHMENT_GROWTH);
+			imageAllocation = GpuMemory(deletionQueue, gpuAllocator.allocate(grownRequirements, properties, GPU_RESOURCE_OPTIMAL, GPU_MEMORY_PERSISTENT));
+		}
+
+		vkBindImageMemory(device, image, imageAllocation->memory, imageAllocation->offset);
+	}
+
 	// Vulkan의 특정 format에 대해 GPU가 tiling의 features를 지원하는지 확인
 	VkFormat findSupportedFormat(const std::vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features) {
 		// format 들에 대해 GPU가 tiling과 features를 지원하는지 확인
@@ -1076,149 +1500,202 @@ private:
 		return format == VK_FORMAT_D32_SFLOAT_S8_UINT || format == VK_FORMAT_D24_UNORM_S8_UINT;
 	}
 
+	/*
+		[텍스처 이미지 생성]
+		텍스처 크기 / 형식만 먼저 확정해서 전체 밉 레벨 이미지를 만들고, 레벨 데이터는 백그라운드에서 스트리밍한다.
+		1. 베이크된 KTX2 가 있으면 BC 블록을 그대로 사용 (GPU 가 압축 형식을 지원하지 않으면 CPU 에서 RGBA8 로 복원)
+		   없으면 원본 이미지를 디코딩해서 CPU 에서 sRGB 밉 체인 생성 (선형 공간 필터링, 워커 스레드 사용)
+		2. 첫 프레임부터 샘플링할 수 있도록 가장 작은 레벨을 바로 업로드
+		   KTX2 는 파일의 실제 레벨, 원본 이미지는 밉 체인을 다 만들어야 가장 작은 레벨이 나오므로 임시 색으로 채움
+		3. 나머지 레벨은 작은 레벨부터 프레임당 TEXTURE_STREAM_BUDGET 만큼 업로드 (updateTextureStream)
+	*/
 	void createTextureImage() {
-		int texWidth, texHeight, texChannels;
-		stbi_uc* pixels = stbi_load(TEXTURE_PATH.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha); // 알파 채널을 포함하여 rgba 픽셀로 이미지 저장
-		VkDeviceSize imageSize = texWidth * texHeight * 4;  // 이미지 크기 (픽셀당 4byte)
-        mipLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(texWidth, texHeight)))) + 1; // mipLevel 설정
+		uint32_t width, height;
+		uint32_t blockBytes = 4;			// RGBA8 픽셀 1 개
+		uint32_t blockDimension = 1;
+		std::function<void(TextureStream&)> producer;
+		uint32_t streamedLevels;			// 스트리밍할 레벨 수 [0, streamedLevels) (나머지는 바로 업로드)
+
+		// 에셋 팩에 KTX2 가 있으면 팩 매핑을 그대로 사용
+		AssetBlob packedTexture;
+		bool ktx2Found;
+		if (assetPack.find(TEXTURE_KTX2_PATH, ASSET_TYPE_TEXTURE, packedTexture)) {
+			textureKtx2.open(packedTexture.data, packedTexture.size);
+			ktx2Found = true;
+		} else {
+			ktx2Found = textureKtx2.open(generatedAssetPath(TEXTURE_KTX2_PATH));
+		}
+
+		if (ktx2Found) {
+			const std::vector<MipLevel>& levels = textureKtx2.levels();
+			width = levels[0].width;
+			height = levels[0].height;
+			mipLevels = static_cast<uint32_t>(levels.size());
+
+			BcFormat bcFormat = BC_FORMAT_BC7;
+			bool srgb = true;
+			bool compressed = bcFormatFromVkFormat(textureKtx2.format(), bcFormat, srgb);
+			bool decompress = compressed && !isTextureFormatSupported(textureKtx2.format());
+			if (decompress) {
+				textureFormat = srgb ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM;
+				std::cout << "[createTextureImage] " << TEXTURE_KTX2_PATH << " format not supported, decompressing on CPU" << std::endl;
+			} else {
+				textureFormat = textureKtx2.format();
+				if (compressed) {
+					blockBytes = bcBlockSize(bcFormat);
+					blockDimension = 4;
+				}
 
+				// RGBA8 대비 VRAM 크기
+				size_t blockTotal = 0;
+				size_t rgbaTotal = 0;
+				for (const MipLevel& level : levels) {
+					blockTotal += level.size;
+					rgbaTotal += size_t(level.width) * level.height * 4;
+				}
+				std::cout << "[createTextureImage] " << TEXTURE_KTX2_PATH << " " << mipLevels << " mip levels, "
+						  << blockTotal / 1024 << " KB (RGBA8 " << rgbaTotal / 1024 << " KB, "
+						  << static_cast<float>(rgbaTotal) / blockTotal << "x smaller)" << std::endl;
+			}
 
-		if (!pixels) {
-			// 로드 실패시 오류 처리
-			throw std::runtime_error("failed to load texture image!");
+			// 가장 작은 레벨은 이미지를 만든 뒤 바로 업로드, 나머지를 작은 레벨부터 전달
+			// (블록은 매핑을 그대로 가리키고, 복원한 레벨만 새 버퍼로 전달)
+			streamedLevels = mipLevels - 1;
+			producer = [this, bcFormat, decompress, streamedLevels](TextureStream& stream) {
+				const std::vector<MipLevel>& levels = textureKtx2.levels();
+				for (uint32_t i = streamedLevels; i-- > 0;) {
+					const MipLevel& level = levels[i];
+					const uint8_t* blocks = textureKtx2.data() + level.offset;
+					bool pushed;
+					if (decompress) {
+						std::vector<uint8_t> data(size_t(level.width) * level.height * 4);
+						decodeBcImage(blocks, level.width, level.height, bcFormat, data.data(), &threadPool);
+						pushed = stream.pushLevel(i, std::move(data));
+					} else {
+						pushed = stream.pushLevel(i, blocks, level.size);
+					}
+					if (!pushed) {
+						return;
+					}
+				}
+			};
+		} else {
+			// 헤더만 읽어서 크기 확정 (디코딩은 producer 에서)
+			std::vector<TextureImage> images(1);
+			images[0].path = TEXTURE_PATH;
+			probeTextureImages(images, nullptr);
+			width = images[0].width;
+			height = images[0].height;
+			mipLevels = mipLevelCount(width, height);
+			textureFormat = VK_FORMAT_R8G8B8A8_SRGB;
+
+			// 밉 체인 레벨 0 자리에 바로 디코딩 (중간 픽셀 버퍼 / 복사 없음) 후 나머지 레벨 생성, 작은 레벨부터 전달
+			// 작은 레벨은 큰 레벨을 차례로 줄여서 만들기 때문에 전체 디코딩 + 밉 체인 생성이 끝나야 첫 레벨이 나감
+			// (그 동안은 임시 색 레벨을 샘플링, 시작 지연을 줄이려면 KTX2 로 베이크)
+			streamedLevels = mipLevels;
+			producer = [this, images](TextureStream& stream) {
+				MipChain mipChain;
+				layoutMipChain(images[0].width, images[0].height, mipChain);
+				decodeTextureImages(images, mipChain.pixels.data(), &threadPool);
+				generateMipLevels(mipChain, TEXTURE_MIP_FILTER, &threadPool);
+
+				for (uint32_t i = static_cast<uint32_t>(mipChain.levels.size()); i-- > 0;) {
+					const MipLevel& level = mipChain.levels[i];
+					const uint8_t* data = mipChain.pixels.data() + level.offset;
+					if (!stream.pushLevel(i, std::vector<uint8_t>(data, data + level.size))) {
+						return;
+					}
+				}
+			};
 		}
 
-		// 스테이징 버퍼 생성
-		VkBuffer stagingBuffer;
-		VkDeviceMemory stagingBufferMemory;
-		createBuffer(imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingBufferMemory);
-
-		// 스테이징 버퍼에 이미지 데이터 복사
-		void* data;
-		vkMapMemory(device, stagingBufferMemory, 0, imageSize, 0, &data);
-		memcpy(data, pixels, static_cast<size_t>(imageSize));
-		vkUnmapMemory(device, stagingBufferMemory);
-
-		// 이미지 데이터 해제
-		stbi_image_free(pixels);
-
-		// 이미지 객체 생성
-		createImage(texWidth, texHeight, mipLevels, VK_SAMPLE_COUNT_1_BIT, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, textureImage, textureImageMemory);
-
-		// Top stage 끝나고 베리어를 이용한 이미지 전환 설정 
-		// (같은 작업 큐에서 Transfer 단계 들어가는 다른 작업들 해당 베리어 작업이 끝날때까지 stop)
-		transitionImageLayout(textureImage, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipLevels);
-		
-		// 커맨드 버퍼를 이용한 버퍼 -> 이미지 데이터 복사 실행
-		copyBufferToImage(stagingBuffer, textureImage, static_cast<uint32_t>(texWidth), static_cast<uint32_t>(texHeight));
-
-		// Transfer 끝나고 베리어를 이용한 이미지 전환 설정
-		// (같은 작업 큐에서 Fragment shader 단계 들어가는 다른 작업들 해당 베리어 작업이 끝날때까지 stop)
-		// mipmap 생성에서 하는걸로 변경
-		// transitionImageLayout(textureImage, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipLevels);
+		// 이미지 객체 생성 (레벨 데이터는 스트리밍으로 채우므로 TRANSFER_DST, blit 을 하지 않으므로 TRANSFER_SRC 불필요)
+		createImage(width, height, mipLevels, VK_SAMPLE_COUNT_1_BIT, textureFormat, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, textureImage, textureImageAllocation);
 
-		// 스테이징 버퍼 삭제
-		vkDestroyBuffer(device, stagingBuffer, nullptr);
-		vkFreeMemory(device, stagingBufferMemory, nullptr);
+		// 가장 작은 레벨을 채우고 전체 레벨을 셰이더 읽기 레이아웃으로 전환
+		if (ktx2Found) {
+			uploadSmallestKtx2Level();
+		} else {
+			fillTexturePlaceholder(width, height, blockBytes, blockDimension);
+		}
 
-		// mipmap 생성
-        generateMipmaps(textureImage, VK_FORMAT_R8G8B8A8_SRGB, texWidth, texHeight, mipLevels);
+		// 레벨 스트리밍 시작 (가장 작은 레벨만 상주한 상태로 시작)
+		textureResidentLevel = mipLevels - 1;
+		textureStreamStartTime = std::chrono::high_resolution_clock::now();
+		textureStream.start(width, height, streamedLevels, blockBytes, blockDimension, producer);
 	}
 
-	void generateMipmaps(VkImage image, VkFormat imageFormat, int32_t texWidth, int32_t texHeight, uint32_t mipLevels) {
-		// 이미지 포맷이 선형 필터링을 사용한 Blit 작업을 지원하는지 확인
+	// 텍스처 형식을 optimal tiling 으로 샘플링 (선형 필터링 포함) 할 수 있는지 확인
+	bool isTextureFormatSupported(VkFormat format) {
 		VkFormatProperties formatProperties;
-		vkGetPhysicalDeviceFormatProperties(physicalDevice, imageFormat, &formatProperties);
-
-		if (!(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT)) {
-			throw std::runtime_error("texture image format does not support linear blitting!");
+		vkGetPhysicalDeviceFormatProperties(physicalDevice, format, &formatProperties);
+		VkFormatFeatureFlags required = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+		return (formatProperties.optimalTilingFeatures & required) == required;
+	}
+
+	// KTX2 의 가장 작은 레벨을 바로 업로드 (GPU 가 BC 형식을 지원하지 않으면 CPU 에서 복원)
+	void uploadSmallestKtx2Level() {
+		const MipLevel& level = textureKtx2.levels()[mipLevels - 1];
+		const uint8_t* blocks = textureKtx2.data() + level.offset;
+		BcFormat bcFormat;
+		bool srgb;
+		if (bcFormatFromVkFormat(textureKtx2.format(), bcFormat, srgb) && textureFormat != textureKtx2.format()) {
+			std::vector<uint8_t> data(size_t(level.width) * level.height * 4);
+			decodeBcImage(blocks, level.width, level.height, bcFormat, data.data(), nullptr);
+			uploadSmallestTextureLevel(level.width, level.height, data.data(), data.size());
+		} else {
+			uploadSmallestTextureLevel(level.width, level.height, blocks, level.size);
 		}
+	}
 
-		// 커맨드 버퍼 생성 및 기록 시작
-		VkCommandBuffer commandBuffer = beginSingleTimeCommands();
+	/*
+		[임시 텍스처 레벨]
+		원본 이미지에서 밉 체인을 만드는 동안 쓸 가장 작은 레벨을 TEXTURE_PLACEHOLDER_COLOR 로 채운다. (BC 형식이면 임시 색 블록을 압축해서 사용)
+		나머지 레벨은 내용 없이 SHADER_READ_ONLY 로 전환만 해두고, 샘플러 minLod 로 접근을 막는다.
+	*/
+	void fillTexturePlaceholder(uint32_t width, uint32_t height, uint32_t blockBytes, uint32_t blockDimension) {
+		MipLevel level;
+		level.width = std::max(width >> (mipLevels - 1), 1u);
+		level.height = std::max(height >> (mipLevels - 1), 1u);
+		level.offset = 0;
+		level.size = size_t((level.width + blockDimension - 1) / blockDimension) * ((level.height + blockDimension - 1) / blockDimension) * blockBytes;
+
+		// 블록 1 개 분량 임시 색
+		uint8_t pixels[64];
+		for (uint32_t i = 0; i < 16; i++) {
+			memcpy(pixels + i * 4, TEXTURE_PLACEHOLDER_COLOR, 4);
+		}
+		uint8_t block[16];
+		BcFormat bcFormat;
+		bool srgb;
+		if (bcFormatFromVkFormat(textureFormat, bcFormat, srgb)) {
+			encodeBcImage(pixels, 4, 4, bcFormat, block, nullptr);
+		} else {
+			memcpy(block, pixels, blockBytes);
+		}
 
-		// 베리어 생성
-		VkImageMemoryBarrier barrier{};
-		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-		barrier.image = image;
-		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-		barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-		barrier.subresourceRange.baseArrayLayer = 0;
-		barrier.subresourceRange.layerCount = 1;
-		barrier.subresourceRange.levelCount = 1;
-
-		int32_t mipWidth = texWidth;
-		int32_t mipHeight = texHeight;
-
-		// miplevel 0 ~ mipLevels
-		for (uint32_t i = 1; i < mipLevels; i++) {
-			barrier.subresourceRange.baseMipLevel = i - 1;								// 해당 mipmap에 대한 barrier 설정
-			barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;					// 데이터 쓰기에 적합한 레이아웃
-			barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;					// 데이터 읽기에 적합한 레이아웃
-			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;						// 쓰기 권한 on
-			barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;						// 읽기 권한 on
-
-			// 파이프라인 베리어 설정 (GPU 특정 작업간의 동기화 설정)
-			// 이전 단계의 mipmap 복사가 끝나야, 다음 단계 mipmap 복사가 시작되게 베리어 설정
-			vkCmdPipelineBarrier(commandBuffer,
-				VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
-				0, nullptr,
-				0, nullptr,
-				1, &barrier);
-
-			// blit 작업시 소스와 대상의 복사 범위를 지정하는 구조체
-			VkImageBlit blit{};
-			blit.srcOffsets[0] = {0, 0, 0};
-			blit.srcOffsets[1] = {mipWidth, mipHeight, 1};														// 소스의 범위 설정
-			blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-			blit.srcSubresource.mipLevel = i - 1;																// 소스의 mipLevel 설정
-			blit.srcSubresource.baseArrayLayer = 0;
-			blit.srcSubresource.layerCount = 1;
-			blit.dstOffsets[0] = {0, 0, 0};
-			blit.dstOffsets[1] = { mipWidth > 1 ? mipWidth / 2 : 1, mipHeight > 1 ? mipHeight / 2 : 1, 1 };		// 대상의 범위 설정
-			blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-			blit.dstSubresource.mipLevel = i;																	// 대상의 mipLevel 설정
-			blit.dstSubresource.baseArrayLayer = 0;
-			blit.dstSubresource.layerCount = 1;
-
-			// 소스 miplevel 을 대상 miplevel로 설정에 맞게 복사
-			vkCmdBlitImage(commandBuffer,
-				image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-				image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-				1, &blit,
-				VK_FILTER_LINEAR); // 선형적으로 복사
-
-			// shader 단계에서 사용하기 전에 Bllit 단계가 끝나기를 기다림
-			barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-			barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-			barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-			vkCmdPipelineBarrier(commandBuffer,
-				VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
-				0, nullptr,
-				0, nullptr,
-				1, &barrier);
-
-			if (mipWidth > 1) mipWidth /= 2;
-			if (mipHeight > 1) mipHeight /= 2;
-		}
-
-		// 마지막 단계 miplevel 처리
-		barrier.subresourceRange.baseMipLevel = mipLevels - 1;
-		barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-		barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		// 레벨 전체를 같은 블록으로 채움
+		std::vector<uint8_t> data(level.size);
+		for (size_t offset = 0; offset < level.size; offset += blockBytes) {
+			memcpy(data.data() + offset, block, blockBytes);
+		}
 
-		vkCmdPipelineBarrier(commandBuffer,
-			VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
-			0, nullptr,
-			0, nullptr,
-			1, &barrier);
+		uploadSmallestTextureLevel(level.width, level.height, data.data(), level.size);
+	}
 
-		endSingleTimeCommands(commandBuffer);
+	// 가장 작은 레벨 복사 (업로드 큐가 전체 레벨을 TRANSFER_DST 로 전환 → 복사 → SHADER_READ_ONLY 로 전환)
+	void uploadSmallestTextureLevel(uint32_t width, uint32_t height, const uint8_t* data, size_t size) {
+		VkBufferImageCopy region{};
+		region.bufferOffset = 0;											// data 기준 레벨 시작 위치
+		region.bufferRowLength = 0;											// 0 이면 이미지 너비에 자동으로 맞춰진다.
+		region.bufferImageHeight = 0;										// 0 이면 이미지 높이에 자동으로 맞춰진다.
+		region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		region.imageSubresource.mipLevel = mipLevels - 1;
+		region.imageSubresource.baseArrayLayer = 0;
+		region.imageSubresource.layerCount = 1;
+		region.imageOffset = {0, 0, 0};
+		region.imageExtent = {width, height, 1};
+		uploadQueue.enqueueImage(textureImage, mipLevels, &region, 1, data, size);
 	}
 
 	// GPU 에서 지원하는 최대 샘플 개수 반환
@@ -1242,8 +1719,8 @@ private:
 
 	// 텍스처 이미지 뷰 생성
 	void createTextureImageView() {
-		// SRGB 총 4바이트 포맷으로 된 이미지 뷰 생성
-		textureImageView = createImageView(textureImage, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_ASPECT_COLOR_BIT, mipLevels);
+		// 업로드한 텍스처 포맷 (BC 압축 또는 RGBA8) 으로 된 이미지 뷰 생성
+		textureImageView = createImageView(textureImage, textureFormat, VK_IMAGE_ASPECT_COLOR_BIT, mipLevels);
 	}
 
 	// 텍스처를 위한 샘플러 생성 함수
@@ -1267,76 +1744,121 @@ private:
 		samplerInfo.compareEnable = VK_FALSE;								// 비교 연산 사용할지 결정 (보통 쉐도우 맵같은 경우 깊이 비교 샘플링에서 사용됨)
 		samplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;						// 비교 연산에 사용할 연산 지정
 		samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;				// mipmap 사용시 mipmap 간 보간 방식 결정 (현재 선형 보간)
-		samplerInfo.minLod = 0.0f;											// 최소 level을 0으로 설정 (가장 높은 해상도의 mipmap 을 사용가능하게 허용)
 		samplerInfo.maxLod = static_cast<float>(mipLevels);					// 최대 level을 mipLevel로 설정 (VK_LOD_CLAMP_NONE 설정시 제한 해제)
 		samplerInfo.mipLodBias = 0.0f;										// Mipmap 레벨 오프셋(Bias)을 설정 
 																			// Mipmap을 일부러 더 높은(더 큰) 레벨로 사용하거나 낮은(더 작은) 레벨로 사용하고 싶을 때 사용.
 
-		// 샘플러 생성
-		if (vkCreateSampler(device, &samplerInfo, nullptr, &textureSampler) != VK_SUCCESS) {
-			throw std::runtime_error("failed to create texture sampler!");
+		// 샘플러 생성 (스트리밍으로 상주한 가장 큰 레벨마다 1 개, minLod 로 아직 업로드 안 된 레벨 접근 차단)
+		textureSamplers.clear();
+		for (uint32_t i = 0; i < mipLevels; i++) {
+			samplerInfo.minLod = static_cast<float>(i);						// 최소 level 설정 (0 이면 가장 높은 해상도의 mipmap 을 사용가능하게 허용)
+			VkSampler sampler;
+			if (vkCreateSampler(device, &samplerInfo, nullptr, &sampler) != VK_SUCCESS) {
+				throw std::runtime_error("failed to create texture sampler!");
+			}
+			textureSamplers.emplace_back(deletionQueue, sampler);
 		}
 	}
 
-	// .obj 파일을 읽고 vertices, indices 채우기
-	void loadModel() {
-		Assimp::Importer importer;
-		// scene 구조체 받아오기
-		auto scene = importer.ReadFile(MODEL_PATH, aiProcess_Triangulate | aiProcess_FlipUVs);
-
-		// scene load 오류 처리
-		if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
-		{
-			throw std::runtime_error("failed to load obj file!");
+	/*
+		[에셋 팩 열기]
+		팩 파일 1 개를 매핑하고 전체 에셋 데이터 미리 읽기를 요청한다. (이후 셰이더 / 텍스처 / 메시 로드는 매핑 구간 참조)
+		팩이 없으면 개별 파일 (셰이더, KTX2 / PNG, 메시 캐시 / 모델) 을 사용
+	*/
+	void openAssetPack() {
+		auto startTime = std::chrono::high_resolution_clock::now();
+		if (assetPack.open(generatedAssetPath(ASSET_PACK_PATH))) {
+			std::cout << "[openAssetPack] " << ASSET_PACK_PATH << " mapped in " << elapsedMilliseconds(startTime) << " ms ("
+					  << assetPack.assetCount() << " assets, " << assetPack.size() / 1024 << " KB, readahead requested)" << std::endl;
+		} else {
+			std::cout << "[openAssetPack] " << ASSET_PACK_PATH << " not found, loading loose files" << std::endl;
 		}
-		// node 데이터 처리
-		processNode(scene->mRootNode, scene);
 	}
 
-	// node에 포함된 mesh들의 데이터 처리
-	void processNode(aiNode *node, const aiScene *scene)
-	{
-		// node에 포함된 mesh들 순회
-		for (uint32_t i = 0; i < node->mNumMeshes; i++)
-		{
-			// 현재 처리할 mesh 찾기
-			auto meshIndex = node->mMeshes[i];
-			auto mesh = scene->mMeshes[meshIndex];
-			// 현재 mesh 데이터 처리
-			processMesh(mesh, scene);
+	/*
+		[모델 로드]
+		1. 에셋 팩에 같은 임포트 설정으로 만든 메시가 있으면 팩 매핑을 바로 사용 (packed)
+		2. 메시 캐시가 유효하면 캐시 파일을 매핑해서 바로 사용 (warm)
+		3. 캐시가 없거나 오래됐으면 Assimp로 .obj 파일을 읽고 캐시 재생성 (cold)
+	*/
+	void loadModel() {
+		auto startTime = std::chrono::high_resolution_clock::now();
+
+		// [packed] 에셋 팩 (원본 모델 파일이 없어도 됨)
+		AssetBlob packedMesh;
+		if (assetPack.find(MODEL_PATH, ASSET_TYPE_MESH, packedMesh)
+			&& meshCache.open(packedMesh.data, packedMesh.size, makePackedMeshCacheKey(MODEL_PATH, MODEL_IMPORT_FLAGS, MODEL_PROCESS_OPTIONS))) {
+			useMeshCache();
+			std::cout << "[loadModel] packed: mesh mapped in " << elapsedMilliseconds(startTime) << " ms ("
+					  << vertexCount << " vertices, " << index16Count + index32Count << " indices, " << subMeshCount << " meshes, " << meshletCount << " meshlets, " << lodCount << " lods)" << std::endl;
+			return;
 		}
 
-		// 자식 노드 처리
-		for (uint32_t i = 0; i < node->mNumChildren; i++)
-			processNode(node->mChildren[i], scene);
-	}
+		MeshCacheKey cacheKey = makeMeshCacheKey(MODEL_PATH, MODEL_IMPORT_FLAGS, MODEL_PROCESS_OPTIONS);
+		std::string cachePath = meshCachePath(MODEL_PATH);
 
-	// mesh의 vetex, index 데이터 처리
-	void processMesh(aiMesh *mesh, const aiScene *scene)
-	{
-		// mesh의 vertex 정보 저장
-		vertices.resize(mesh->mNumVertices);
-		for (uint32_t i = 0; i < mesh->mNumVertices; i++)
-		{
-			Vertex& v = vertices[i];
-			v.pos = glm::vec3(mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z);
-			v.texCoord = glm::vec2(mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y);
-			v.color = {1.0f, 1.0f, 1.0f};
+		// [warm] 캐시 매핑
+		if (meshCache.open(cachePath, cacheKey)) {
+			useMeshCache();
+			std::cout << "[loadModel] warm: mesh cache mapped in " << elapsedMilliseconds(startTime) << " ms ("
+					  << vertexCount << " vertices, " << index16Count + index32Count << " indices, " << subMeshCount << " meshes, " << meshletCount << " meshlets, " << lodCount << " lods)" << std::endl;
+			return;
 		}
 
-		// mesh의 index 정보 저장
-		indices.resize(mesh->mNumFaces * 3);
-		// face의 개수 = triangle 개수
-		for (uint32_t i = 0; i < mesh->mNumFaces; i++)
-		{
-			indices[3 * i] = mesh->mFaces[i].mIndices[0];
-			indices[3 * i + 1] = mesh->mFaces[i].mIndices[1];
-			indices[3 * i + 2] = mesh->mFaces[i].mIndices[2];
+		// [cold] 모델 임포트 (OBJ 는 네이티브 로더)
+		importModel(MODEL_PATH, MODEL_IMPORT_FLAGS, MODEL_PROCESS_OPTIONS, meshData, &threadPool);
+		float importTime = elapsedMilliseconds(startTime);
+
+		// 캐시 생성 후 다시 매핑 (실패하면 임포트한 배열을 그대로 사용)
+		auto cacheStartTime = std::chrono::high_resolution_clock::now();
+		if (MeshCache::write(cachePath, cacheKey, meshData) && meshCache.open(cachePath, cacheKey)) {
+			useMeshCache();
+			std::cout << "[loadModel] cold: import " << importTime << " ms, cache rebuild + map "
+					  << elapsedMilliseconds(cacheStartTime) << " ms (" << vertexCount << " vertices, " << index16Count + index32Count << " indices, " << subMeshCount << " meshes, " << meshletCount << " meshlets, " << lodCount << " lods)" << std::endl;
+			return;
 		}
+
+		vertexData = meshData.gpuVertices.data();
+		vertexCount = static_cast<uint32_t>(meshData.gpuVertices.size());
+		index16Data = meshData.gpuIndices16.data();
+		index16Count = static_cast<uint32_t>(meshData.gpuIndices16.size());
+		index32Data = meshData.gpuIndices32.data();
+		index32Count = static_cast<uint32_t>(meshData.gpuIndices32.size());
+		subMeshData = meshData.subMeshes.data();
+		subMeshCount = static_cast<uint32_t>(meshData.subMeshes.size());
+		meshletData = meshData.meshlets.data();
+		meshletCount = static_cast<uint32_t>(meshData.meshlets.size());
+		lodData = meshData.lods.data();
+		lodCount = static_cast<uint32_t>(meshData.lods.size());
+		std::cout << "[loadModel] cold: import " << importTime << " ms (failed to write mesh cache)" << std::endl;
+	}
+
+	// 매핑된 캐시를 업로드 대상으로 설정하고 임포트용 배열 해제
+	void useMeshCache() {
+		vertexData = meshCache.vertices();
+		vertexCount = meshCache.vertexCount();
+		index16Data = meshCache.indices16();
+		index16Count = meshCache.index16Count();
+		index32Data = meshCache.indices32();
+		index32Count = meshCache.index32Count();
+		subMeshData = meshCache.subMeshes();
+		subMeshCount = meshCache.subMeshCount();
+		meshletData = meshCache.meshlets();
+		meshletCount = meshCache.meshletCount();
+		lodData = meshCache.lods();
+		lodCount = meshCache.lodCount();
+
+		meshData = MeshData();
+	}
+
+	// 시작 시점부터 경과한 시간(ms)
+	static float elapsedMilliseconds(std::chrono::high_resolution_clock::time_point startTime) {
+		auto currentTime = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<float, std::chrono::milliseconds::period>(currentTime - startTime).count();
 	}
 
 	// 이미지 뷰 생성
-	VkImageView createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectFlags, uint32_t mipLevels) {
+	GpuImageView createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectFlags, uint32_t mipLevels) {
 		// 이미지 뷰 정보 생성
 		VkImageViewCreateInfo viewInfo{};
 		viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
@@ -1355,16 +1877,16 @@ private:
 			throw std::runtime_error("failed to create image view!");
 		}
 
-		return imageView;
+		return GpuImageView(deletionQueue, imageView);
 	}
 
 	/*
 		[이미지 객체 생성 및 메모리 할당]
 		1. 이미지 객체 생성
-		2. 이미지 객체가 사용할 메모리 할당
-		3. 이미지 객체에 할당한 메모리 바인딩
+		2. 할당기에서 이미지 객체가 사용할 메모리 구간 할당
+		3. 이미지 객체에 할당한 메모리 구간 바인딩 (블록 메모리 + offset)
 	*/
-	void createImage(uint32_t width, uint32_t height, uint32_t mipLevels, VkSampleCountFlagBits numSamples, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory) {
+	void createImage(uint32_t width, uint32_t height, uint32_t mipLevels, VkSampleCountFlagBits numSamples, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, GpuImage& image, GpuMemory& imageAllocation) {
 		// 이미지 객체를 만드는데 사용되는 구조체
 		VkImageCreateInfo imageInfo{};
 		imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -1382,144 +1904,33 @@ private:
 		imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;		// 이미지의 큐 공유 모드 설정 (VK_SHARING_MODE_EXCLUSIVE: 한 번에 하나의 큐 패밀리에서만 접근 가능한 단일 큐 모드)
 
 		// 이미지 객체 생성
-		if (vkCreateImage(device, &imageInfo, nullptr, &image) != VK_SUCCESS) {
+		VkImage newImage;
+		if (vkCreateImage(device, &imageInfo, nullptr, &newImage) != VK_SUCCESS) {
 			throw std::runtime_error("failed to create image!");
 		}
+		image = GpuImage(deletionQueue, newImage);
 
 		// 이미지에 필요한 메모리 요구 사항을 조회 
 		VkMemoryRequirements memRequirements;
 		vkGetImageMemoryRequirements(device, image, &memRequirements);
 
-		// 메모리 할당을 위한 구조체
-		VkMemoryAllocateInfo allocInfo{};
-		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		allocInfo.allocationSize = memRequirements.size;											// 메모리 크기 설정
-		allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);		// 메모리 유형과 속성 설정
-
-		// 이미지를 위한 메모리 할당
-		if (vkAllocateMemory(device, &allocInfo, nullptr, &imageMemory) != VK_SUCCESS) {
-			throw std::runtime_error("failed to allocate image memory!");
-		}
-
-		// 이미지에 할당한 메모리 바인딩
-		vkBindImageMemory(device, image, imageMemory, 0);
-	}
-
-	// 이미지 레이아웃, 접근 권한을 변경할 수 있는 베리어를 커맨드 버퍼에 기록
-	void transitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout, uint32_t mipLevels) {
-		VkCommandBuffer commandBuffer = beginSingleTimeCommands();			// 커맨드 버퍼 생성 및 기록 시작
-
-		// 베리어 생성을 위한 구조체
-		VkImageMemoryBarrier barrier{};
-		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-		barrier.oldLayout = oldLayout;										// src 단계까지의 이미지 레이아웃
-		barrier.newLayout = newLayout;										// src 단계 이후 적용시킬 새로운 이미지 레이아웃
-		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;				// 베리어 전환 적용 후 리소스 소유권을 넘겨줄 src 큐 패밀리 (현재는 동일 큐 패밀리에서 실행)
-		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;				// 리소스 소유권을 받을 dst 큐 패밀리로 dst 큐패밀리에는 큐 전체에 동기화가 적용 (현재는 동일 큐 패밀리에서 실행)
-		barrier.image = image;												// 배리어 적용할 이미지 객체
-		barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;	// 전환 작업의 적용 대상을 color bit 으로 설정
-		barrier.subresourceRange.baseMipLevel = 0;							// 전환 작업을 시작할 miplevel
-		barrier.subresourceRange.levelCount = mipLevels;					// 전환 작업을 적용할 miplevel의 개수
-		barrier.subresourceRange.baseArrayLayer = 0;						// 전환 작업을 시작할 레이어 인덱스
-		barrier.subresourceRange.layerCount = 1;							// 전환 작업을 적용할 레이어 개수
-
-		VkPipelineStageFlags sourceStage;									// 파이프라인의 sourceStage 단계가 끝나면 배리어 전환 실행 
-		VkPipelineStageFlags destinationStage;								// destinationStage 단계는 배리어 전환이 끝날때까지 대기
-
-		if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
-			// 이미지 복사 전에 이미지 레이아웃, 접근 권한 변경
-			barrier.srcAccessMask = 0;									// 접근 제한 x
-			barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;		// 쓰기 권한 필요
-
-			sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;			// Vulkan의 파이프라인에서 가장 상단에 위치한 첫 번째 단계로, 어떠한 작업도 진행되지 않은 상태
-			destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;			// 데이터 복사 단계
-		} else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
-			// 이미지 복사가 완료되고 읽기를 수행하기 위해 Fragment shader 작업 대기
-			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;		// 쓰기 권한 필요
-			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;			// 읽기 권한 필요
-
-			sourceStage = VK_PIPELINE_STAGE_TRANSFER_BIT;				// 데이터 복사 단계
-			destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;	// Fragment shader 단계
-		} else {
-			throw std::invalid_argument("unsupported layout transition!");
-		}
-
-		// 베리어를 커맨드 버퍼에 기록
-		vkCmdPipelineBarrier(
-			commandBuffer,						// 베리어를 기록할 커맨드 버퍼
-			sourceStage, destinationStage,		// sourceStage 단계가 끝나면 베리어 작업 시작, 베리어 작업이 끝나기 전에 destinationStage에 돌입한 다른 작업들 모두 대기
-			0,									// 의존성 플래그
-			0, nullptr,							// 메모리 베리어 (개수 + 베리어 포인터)
-			0, nullptr,							// 버퍼 베리어   (개수 + 베리어 포인터)
-			1, &barrier							// 이미지 베리어 (개수 + 베리어 포인터)
-		);
-
-		endSingleTimeCommands(commandBuffer);	// 커맨드 버퍼 기록 종료
-	}
-
-	// 커맨드 버퍼 제출을 통해 버퍼 -> 이미지 데이터 복사 
-	void copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height) {
-		// 커맨드 버퍼 생성 및 기록 시작
-		VkCommandBuffer commandBuffer = beginSingleTimeCommands();
-
-		// 버퍼 -> 이미지 복사를 위한 정보
-		VkBufferImageCopy region{};
-		region.bufferOffset = 0;											// 복사할 버퍼의 시작 위치 offset
-		region.bufferRowLength = 0;											// 저장될 공간의 row 당 픽셀 수 (0으로 하면 이미지 너비에 자동으로 맞춰진다.)
-		region.bufferImageHeight = 0;										// 저장될 공간의 col 당 픽셀 수 (0으로 하면 이미지 높이에 자동으로 맞춰진다.)
-		region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;		// 이미지의 데이터 타입 (현재는 컬러값을 복사)
-		region.imageSubresource.mipLevel = 0;								// 이미지의 miplevel 설정
-		region.imageSubresource.baseArrayLayer = 0;							// 이미지의 시작 layer 설정 (cubemap과 같은 경우 여러 레이어 존재)
-		region.imageSubresource.layerCount = 1;								// 이미지 layer 개수
-		region.imageOffset = {0, 0, 0};										// 이미지의 저장할 시작 위치
-		region.imageExtent = {												// 이미지의 저장할 너비, 높이, 깊이
-			width,
-			height,
-			1
-		};
-
-		// 커맨드 버퍼에 버퍼 -> 이미지로 데이터 복사하는 명령 기록
-		vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+		// 할당기에서 이미지 메모리 구간 할당 (optimal 이미지는 bufferImageGranularity 때문에 버퍼와 다른 풀 사용)
+		GpuResourceKind kind = tiling == VK_IMAGE_TILING_OPTIMAL ? GPU_RESOURCE_OPTIMAL : GPU_RESOURCE_LINEAR;
+		imageAllocation = GpuMemory(deletionQueue, gpuAllocator.allocate(memRequirements, properties, kind, GPU_MEMORY_PERSISTENT));
 
-		// 커맨드 버퍼 기록 종료 및 제출
-		endSingleTimeCommands(commandBuffer);
+		// 이미지에 할당한 메모리 구간 바인딩
+		vkBindImageMemory(device, image, imageAllocation->memory, imageAllocation->offset);
 	}
 
 	/*
 		[버텍스 버퍼 생성]
-		1. 스테이징 버퍼 생성
-		2. 스테이징 버퍼에 정점 정보 복사
-		3. 버텍스 버퍼 생성
-		4. 스테이징 버퍼의 정점 정보를 버텍스 버퍼에 복사
-		5. 스테이징 버퍼 리소스 해제
+		1. 버텍스 버퍼 생성
+		2. 업로드 큐에 정점 정보 복사 예약 (스테이징 링에 복사 후 배치 커맨드 버퍼에 복사 명령 기록)
+		   initVulkan 끝에서 다른 업로드와 같이 한 번에 제출
 	*/ 
 	void createVertexBuffer() {
 		// 정점 정보 크기		
-		VkDeviceSize bufferSize = sizeof(vertices[0]) * vertices.size();
-
-		// 스테이징 버퍼 객체, 스테이징 버퍼 메모리 객체 생성
-		VkBuffer stagingBuffer;
-		VkDeviceMemory stagingBufferMemory;
-
-		// [스테이징 버퍼 생성]
-		// 용도)
-		//		VK_BUFFER_USAGE_TRANSFER_SRC_BIT : 데이터 전송의 소스로 사용
-		// 속성)
-		// 		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT  : CPU에서 GPU 메모리에 접근이 가능한 설정
-		// 		VK_MEMORY_PROPERTY_HOST_COHERENT_BIT : CPU에서 GPU 메모리의 값을 수정하면 그 즉시 GPU 메모리와 캐시에 해당 값을 수정하는 설정 
-		//      									  (원래는 CPU에서 GPU 메모리 값을 수정하면 GPU 캐시를 플러쉬하여 다시 캐시에 값을 올리는 형식으로 동작)
-		createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingBufferMemory);
-
-		// [스테이징 버퍼(GPU 메모리)에 정점 정보 입력]
-		void* data; // GPU 메모리에 매핑될 CPU 메모리 가상 포인터
-		vkMapMemory(device, stagingBufferMemory, 0, bufferSize, 0, &data); 	// GPU 메모리에 매핑된 CPU 메모리 포인터 반환 (현재는 버텍스 버퍼 메모리 전부를 매핑)
-		memcpy(data, vertices.data(), (size_t) bufferSize);					// CPU 메모리 포인터는 가상포인터로 data에 정점 정보를 복사하면 GPU에 즉시 반영
-																			// 실제 CPU 메모리에 저장되는게 아닌 CPU 메모리 포인터는 가상 포인터역할만 하고 GPU 메모리에 바로 저장
-																			// 메모리 유형의 속성에 의해 GPU 캐시를 플러쉬할 필요없이 즉시 적용
-																			// VK_MEMORY_PROPERTY_HOST_COHERENT_BIT 속성 덕분
-																			// 만약 해당 속성 없이 플러쉬도 안 하면 GPU에서 변경사항이 바로 적용되지 않음
-		vkUnmapMemory(device, stagingBufferMemory);							// GPU 메모리 매핑 해제
-
+		VkDeviceSize bufferSize = sizeof(GpuVertex) * vertexCount;
 
 		// [버텍스 버퍼 생성]
 		// 용도)
@@ -1527,91 +1938,275 @@ private:
 		// 속성)
 		// 		VK_BUFFER_USAGE_VERTEX_BUFFER_BIT : 버퍼를 정점 데이터를 저장하고 처리하는 용도로 설정.
 		// 		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT : GPU 전용 메모리에 데이터를 저장하여, GPU가 최적화된 방식으로 접근할 수 있게 함.
-		createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vertexBuffer, vertexBufferMemory);
-
-		// [스테이징 버퍼에서 버텍스 버퍼로 메모리 이동]
-		copyBuffer(stagingBuffer, vertexBuffer, bufferSize);
+		createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vertexBuffer, vertexBufferAllocation, GPU_MEMORY_PERSISTENT);
 
-		// 스테이징 버퍼와 할당된 메모리 해제
-		vkDestroyBuffer(device, stagingBuffer, nullptr);
-		vkFreeMemory(device, stagingBufferMemory, nullptr);
+		// [스테이징 링을 거쳐 버텍스 버퍼로 복사 예약]
+		uploadQueue.enqueueBuffer(vertexBuffer, 0, vertexData, bufferSize);
 	}
 
 	/*
 		[인덱스 버퍼 생성]
 		버텍스 버퍼 생성 과정과 같음
+		16bit 인덱스 구간 뒤에 4 byte 정렬로 32bit 인덱스 구간을 이어 붙임 (바인딩 offset 은 인덱스 크기의 배수여야 함)
 	*/
 	void createIndexBuffer() {
-		VkDeviceSize bufferSize = sizeof(indices[0]) * indices.size();
+		VkDeviceSize index16Size = sizeof(uint16_t) * index16Count;
+		index32Offset = (index16Size + sizeof(uint32_t) - 1) & ~VkDeviceSize(sizeof(uint32_t) - 1);
+		VkDeviceSize bufferSize = index32Offset + sizeof(uint32_t) * index32Count;
 
-		VkBuffer stagingBuffer;
-		VkDeviceMemory stagingBufferMemory;
-		createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingBufferMemory);
-
-		void* data;
-		vkMapMemory(device, stagingBufferMemory, 0, bufferSize, 0, &data);
-		memcpy(data, indices.data(), (size_t) bufferSize);
-		vkUnmapMemory(device, stagingBufferMemory);
-
-		// [버텍스 버퍼 생성]
+		// [인덱스 버퍼 생성]
 		// 속성)
 		// 		VK_BUFFER_USAGE_INDEX_BUFFER_BIT : 버퍼를 인덱스 데이터를 저장하고 처리하는 용도로 설정.
 		// 		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT : GPU 전용 메모리에 데이터를 저장하여, GPU가 최적화된 방식으로 접근할 수 있게 함.
-		createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, indexBuffer, indexBufferMemory);
-
-		copyBuffer(stagingBuffer, indexBuffer, bufferSize);
+		createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, indexBuffer, indexBufferAllocation, GPU_MEMORY_PERSISTENT);
 
-		vkDestroyBuffer(device, stagingBuffer, nullptr);
-		vkFreeMemory(device, stagingBufferMemory, nullptr);
+		// 16bit / 32bit 구간을 각각 복사 예약 (같은 배치에 기록)
+		if (index16Count > 0) {
+			uploadQueue.enqueueBuffer(indexBuffer, 0, index16Data, index16Size);
+		}
+		if (index32Count > 0) {
+			uploadQueue.enqueueBuffer(indexBuffer, index32Offset, index32Data, sizeof(uint32_t) * index32Count);
+		}
 	}
 
-	// 유니폼 버퍼 생성
+	/*
+		[유니폼 링 버퍼 생성]
+		프레임마다 UNIFORM_RING_FRAME_SIZE 영역을 갖는 영구 매핑 버퍼 1 개
+		(프레임 / 물체별 유니폼 데이터는 영역 안에서 포인터만 밀어서 할당하고 dynamic offset 으로 바인딩)
+	*/
 	void createUniformBuffers() {
-		// 유니폼 버퍼에 저장 될 구조체의 크기
-		VkDeviceSize bufferSize = sizeof(UniformBufferObject);
+		// dynamic offset 은 minUniformBufferOffsetAlignment 의 배수여야 함
+		VkPhysicalDeviceProperties properties;
+		vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+		size_t alignment = static_cast<size_t>(properties.limits.minUniformBufferOffsetAlignment);
 
-		// 각 요소들을 동시에 처리 가능한 최대 프레임 수만큼 만들어 둔다.
-		uniformBuffers.resize(MAX_FRAMES_IN_FLIGHT);		// 유니폼 버퍼 객체
-		uniformBuffersMemory.resize(MAX_FRAMES_IN_FLIGHT);	// 유니폼 버퍼에 할당할 메모리
-		uniformBuffersMapped.resize(MAX_FRAMES_IN_FLIGHT);	// GPU 메모리에 매핑할 CPU 메모리 포인터
+		VkDeviceSize bufferSize = UniformRing::bufferSize(UNIFORM_RING_FRAME_SIZE, MAX_FRAMES_IN_FLIGHT, alignment);
+		createBuffer(bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, uniformRingBuffer, uniformRingAllocation, GPU_MEMORY_PERSISTENT);
 
-		for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
-			// 유니폼 버퍼 객체 생성 + 메모리 할당 + 바인딩
-			createBuffer(bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, uniformBuffers[i], uniformBuffersMemory[i]);
-			// GPU 메모리 CPU 가상 포인터에 매핑
-			vkMapMemory(device, uniformBuffersMemory[i], 0, bufferSize, 0, &uniformBuffersMapped[i]);
+		// GPU 메모리에 매핑된 CPU 가상 포인터 (할당기 블록의 영구 매핑) 위에 프레임별 영역 배치
+		uniformRing.init(uniformRingAllocation->mapped, UNIFORM_RING_FRAME_SIZE, MAX_FRAMES_IN_FLIGHT, alignment);
+	}
+
+	/*
+		[인스턴스 링 버퍼 생성]
+		1. 옵션의 인스턴스 수만큼 격자 배치 생성 후 draw 방식 결정 (--instance-sweep 이면 첫 단계)
+		2. 프레임마다 MAX_INSTANCES 개 영역을 갖는 영구 매핑 storage buffer 1 개 (유니폼 링과 같은 방식, 프레임당 할당 1 번)
+		GPU 컬링 명령 구간은 실행 중 가장 많은 인스턴스 수 기준 (명령 버퍼 1 프레임이 maxStorageBufferRange 를 넘지 않는 만큼만)
+	*/
+	void createInstanceBuffers() {
+		if (options.instanceCount == 0 || options.instanceCount > MAX_INSTANCES) {
+			throw std::runtime_error("instance count must be between 1 and MAX_INSTANCES!");
+		}
+
+		VkPhysicalDeviceProperties properties;
+		vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+		uint32_t peakInstanceCount = options.instanceSweep ? *std::max_element(std::begin(INSTANCE_SWEEP_COUNTS), std::end(INSTANCE_SWEEP_COUNTS)) : options.instanceCount;
+		cullDrawCapacity = std::min<uint32_t>(peakInstanceCount, properties.limits.maxStorageBufferRange / (sizeof(VkDrawIndexedIndirectCommand) * subMeshCount));
+		if (options.cullCheck && !gpuCullSupported) {
+			throw std::runtime_error("GPU culling is not supported on this device!");
+		}
+		if (options.cullCheck && !gpuCullFits(options.instanceCount)) {
+			throw std::runtime_error("instance count exceeds the GPU culling draw command capacity!");
+		}
+		if (options.instanceSweep) {
+			applySweepStep();
+		} else {
+			makeInstanceGrid(options.instanceCount, INSTANCE_SPACING, 1, instances);
+			buildInstanceBvh();
+			// 인스턴스가 여러 개면 GPU 컬링 (지원하지 않으면 CPU BVH 컬링), 1 개면 메시렛 컬링 경로
+			if (options.recordSweep && options.instanceCount > 1) {
+				// 기록 스레드 측정은 draw 수가 인스턴스 수에 비례하는 방식으로
+				instanceDrawMode = INSTANCE_DRAW_SEPARATE;
+			} else if (gpuCullFits(options.instanceCount) && (options.instanceCount > 1 || options.cullCheck)) {
+				instanceDrawMode = INSTANCE_DRAW_GPU_CULLED;
+			} else {
+				instanceDrawMode = options.instanceCount > 1 ? INSTANCE_DRAW_CPU_CULLED : INSTANCE_DRAW_INSTANCED;
+			}
 		}
+
+		// dynamic offset 은 minStorageBufferOffsetAlignment 의 배수여야 함
+		size_t alignment = static_cast<size_t>(properties.limits.minStorageBufferOffsetAlignment);
+		size_t frameSize = MAX_INSTANCES * sizeof(GpuInstance);
+
+		VkDeviceSize bufferSize = UniformRing::bufferSize(frameSize, MAX_FRAMES_IN_FLIGHT, alignment);
+		createBuffer(bufferSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, instanceRingBuffer, instanceRingAllocation, GPU_MEMORY_PERSISTENT);
+		instanceRing.init(instanceRingAllocation->mapped, frameSize, MAX_FRAMES_IN_FLIGHT, alignment);
 	}
 
-	// 디스크립터 풀 생성
-	void createDescriptorPool() {
-		
-		// 디스크립터 풀의 타입별 디스크립터 개수를 설정하는 구조체
-        std::array<VkDescriptorPoolSize, 2> poolSizes{};
-        poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;							// 유니폼 버퍼 설정
-        poolSizes[0].descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);		// 유니폼 버퍼 디스크립터 최대 개수 설정
-        poolSizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;					// 샘플러 설정
-        poolSizes[1].descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);		// 샘플러 디스크립터 최대 개수 설정
+	// instanceCount 개 인스턴스를 GPU 컬링으로 그릴 수 있는지 (명령 구간이 인스턴스 수만큼 필요)
+	bool gpuCullFits(uint32_t instanceCount) const {
+		return gpuCullSupported && instanceCount <= cullDrawCapacity;
+	}
 
-		// 디스크립터 풀을 생성할 때 필요한 설정 정보를 담는 구조체
-		VkDescriptorPoolCreateInfo poolInfo{};
-		poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-        poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());			// 디스크립터 poolSize 구조체 개수
-        poolInfo.pPoolSizes = poolSizes.data();										// 디스크립터 poolSize 구조체 배열
-		poolInfo.maxSets = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);				// 풀에 존재할 수 있는 총 디스크립터 셋 개수
+	/*
+		[인스턴스 BVH 생성]
+		인스턴스는 제자리에서 z 축 회전만 하므로 모든 서브 메시 바운딩 구를 회전해도 덮는 반지름으로 AABB 를 만들어
+		회전과 무관한 (refit 이 필요 없는) 박스 사용 (인스턴스 배치가 바뀌면 다시 호출)
+		같은 반지름을 인스턴스 LOD 거리 (인스턴스 LOD 버킷) 에도 사용
+	*/
+	void buildInstanceBvh() {
+		float modelRadius = 0.0f;
+		for (uint32_t i = 0; i < subMeshCount; i++) {
+			modelRadius = std::max(modelRadius, glm::length(subMeshData[i].center) + subMeshData[i].radius);
+		}
+		instanceBoundRadius = modelRadius;
 
-		// 디스크립터 풀 생성
-		if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &descriptorPool) != VK_SUCCESS) {
-			throw std::runtime_error("failed to create descriptor pool!");
+		std::vector<SceneAabb> boxes(instances.size());
+		for (size_t i = 0; i < instances.size(); i++) {
+			const glm::mat4& model = instances[i].model;
+			float scale = std::max({glm::length(glm::vec3(model[0])), glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))});
+			glm::vec3 position(model[3]);
+			boxes[i] = {position - glm::vec3(modelRadius * scale), position + glm::vec3(modelRadius * scale)};
 		}
+		instanceBvh.build(boxes.data(), static_cast<uint32_t>(boxes.size()));
 	}
 
-	// 디스크립터 셋 할당 및 업데이트 하여 리소스 바인딩
-	void createDescriptorSets() {
-		// 디스크립터 셋 레이아웃 벡터 생성 (기존 만들어놨던 디스크립터 셋 레이아웃 객체 이용)
-		std::vector<VkDescriptorSetLayout> layouts(MAX_FRAMES_IN_FLIGHT, descriptorSetLayout);
-
-		// 디스크립터 셋 할당에 필요한 정보를 설정하는 구조체
+	/*
+		[GPU 컬링 버퍼 생성]
+		1. 서브 메시 표 / LOD 표는 장치 메모리에 1 번 업로드 (LOD 가 없으면 빈 바인딩 대신 1 개 크기)
+		2. 간접 명령 버퍼는 프레임마다 서브 메시 수 x cullDrawCapacity 개 (컴퓨트 셰이더만 쓰므로 장치 메모리)
+		   인스턴스 1 개는 서브 메시마다 명령을 최대 1 개 쓰므로 서브 메시 구간은 인스턴스 수면 충분
+		3. draw 개수 버퍼는 프레임마다 서브 메시 수 개 (--cull-check 가 펜스 대기 후 읽으므로 호스트 메모리)
+		프레임 구간은 storage buffer 디스크립터 offset 이므로 minStorageBufferOffsetAlignment 로 정렬
+	*/
+	void createCullBuffers() {
+		if (!gpuCullSupported) {
+			return;
+		}
+
+		VkPhysicalDeviceProperties properties;
+		vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+		VkDeviceSize alignment = properties.limits.minStorageBufferOffsetAlignment;
+		auto alignSize = [alignment](VkDeviceSize size) { return (size + alignment - 1) / alignment * alignment; };
+
+		makeGpuCullSubMeshes(subMeshData, subMeshCount, cullSubMeshes);
+		VkDeviceSize subMeshSize = sizeof(GpuCullSubMesh) * subMeshCount;
+		createBuffer(subMeshSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, cullSubMeshBuffer, cullSubMeshAllocation, GPU_MEMORY_PERSISTENT);
+		uploadQueue.enqueueBuffer(cullSubMeshBuffer, 0, cullSubMeshes.data(), subMeshSize);
+
+		VkDeviceSize lodSize = sizeof(MeshLod) * lodCount;
+		createBuffer(std::max<VkDeviceSize>(lodSize, sizeof(MeshLod)), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, cullLodBuffer, cullLodAllocation, GPU_MEMORY_PERSISTENT);
+		if (lodSize > 0) {
+			uploadQueue.enqueueBuffer(cullLodBuffer, 0, lodData, lodSize);
+		}
+
+		drawCommandFrameSize = alignSize(sizeof(VkDrawIndexedIndirectCommand) * cullDrawCapacity * subMeshCount);
+		createBuffer(drawCommandFrameSize * MAX_FRAMES_IN_FLIGHT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, drawCommandBuffer, drawCommandAllocation, GPU_MEMORY_PERSISTENT);
+
+		drawCountFrameSize = alignSize(sizeof(uint32_t) * subMeshCount);
+		createBuffer(drawCountFrameSize * MAX_FRAMES_IN_FLIGHT, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+					 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, drawCountBuffer, drawCountAllocation, GPU_MEMORY_PERSISTENT);
+
+		cullReferences.resize(MAX_FRAMES_IN_FLIGHT);
+		cullReferenceValid.assign(MAX_FRAMES_IN_FLIGHT, false);
+	}
+
+	// 텍스처 스트리밍 업로드 버퍼 생성 (프레임마다 1 개, 예산 또는 블록 행 1 줄 중 큰 크기)
+	void createTextureStreamBuffers() {
+		VkDeviceSize bufferSize = std::max(TEXTURE_STREAM_BUDGET, textureStream.maxRowSize());
+
+		textureStreamBuffers.resize(MAX_FRAMES_IN_FLIGHT);
+		textureStreamBuffersAllocation.resize(MAX_FRAMES_IN_FLIGHT);
+		textureStreamBuffersMapped.resize(MAX_FRAMES_IN_FLIGHT);
+
+		for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+			createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, textureStreamBuffers[i], textureStreamBuffersAllocation[i], GPU_MEMORY_PERSISTENT);
+			textureStreamBuffersMapped[i] = textureStreamBuffersAllocation[i]->mapped;
+		}
+	}
+
+	/*
+		[텍스처 스트리밍 업로드 준비]
+		1. 이번 프레임 예산만큼 조각을 받아서 이 프레임의 업로드 버퍼에 복사 (커맨드 버퍼 기록시 이미지로 복사)
+		2. 레벨 업로드가 끝나면 상주 레벨을 내려서 샘플러 minLod 완화 (같은 커맨드 버퍼에서 복사 후 그리므로 이번 프레임부터 사용)
+		3. 이 프레임 디스크립터 셋의 샘플러가 상주 레벨과 다르면 교체 (펜스 대기 후라 GPU 가 쓰지 않는 셋)
+	*/
+	void updateTextureStream() {
+		textureStreamCopies.clear();
+		if (!textureStream.isComplete()) {
+			textureStream.takeChunks(TEXTURE_STREAM_BUDGET, textureStreamChunks);
+
+			VkDeviceSize offset = 0;
+			for (const TextureStreamChunk& chunk : textureStreamChunks) {
+				memcpy(static_cast<uint8_t*>(textureStreamBuffersMapped[currentFrame]) + offset, chunk.data, chunk.size);
+
+				VkBufferImageCopy region{};
+				region.bufferOffset = offset;										// 업로드 버퍼 안의 조각 위치 (블록 크기의 배수)
+				region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+				region.imageSubresource.mipLevel = chunk.level;
+				region.imageSubresource.baseArrayLayer = 0;
+				region.imageSubresource.layerCount = 1;
+				region.imageOffset = {0, static_cast<int32_t>(chunk.y), 0};			// 레벨 안의 시작 행
+				region.imageExtent = {chunk.width, chunk.height, 1};
+				textureStreamCopies.push_back(region);
+				offset += chunk.size;
+
+				if (chunk.completesLevel) {
+					textureResidentLevel = chunk.level;
+				}
+			}
+
+			if (textureStream.isComplete()) {
+				auto endTime = std::chrono::high_resolution_clock::now();
+				std::cout << "[updateTextureStream] " << mipLevels << " mip levels resident in "
+						  << std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - textureStreamStartTime).count() << " ms" << std::endl;
+				textureStream.stop();
+			}
+		}
+
+		if (descriptorTextureLevels[currentFrame] != textureResidentLevel) {
+			VkDescriptorImageInfo imageInfo{};
+			imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+			imageInfo.imageView = textureImageView;
+			imageInfo.sampler = textureSamplers[textureResidentLevel];
+
+			VkWriteDescriptorSet descriptorWrite{};
+			descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			descriptorWrite.dstSet = descriptorSets[currentFrame];
+			descriptorWrite.dstBinding = 1;
+			descriptorWrite.dstArrayElement = 0;
+			descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+			descriptorWrite.descriptorCount = 1;
+			descriptorWrite.pImageInfo = &imageInfo;
+			vkUpdateDescriptorSets(device, 1, &descriptorWrite, 0, nullptr);
+
+			descriptorTextureLevels[currentFrame] = textureResidentLevel;
+		}
+	}
+
+	// 디스크립터 풀 생성
+	void createDescriptorPool() {
+		
+		// 디스크립터 풀의 타입별 디스크립터 개수를 설정하는 구조체
+        std::array<VkDescriptorPoolSize, 4> poolSizes{};
+        poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;					// 유니폼 버퍼 설정 (dynamic offset)
+        poolSizes[0].descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);		// 유니폼 버퍼 디스크립터 최대 개수 설정
+        poolSizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;					// 샘플러 설정
+        poolSizes[1].descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);		// 샘플러 디스크립터 최대 개수 설정
+        poolSizes[2].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;					// 인스턴스 버퍼 설정 (dynamic offset, 그래픽스 / 컬링 셋)
+        poolSizes[2].descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT * 2);
+        poolSizes[3].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;							// 컬링 서브 메시 표 / 간접 명령 / draw 개수 / LOD 표
+        poolSizes[3].descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT * 4);
+
+		// 디스크립터 풀을 생성할 때 필요한 설정 정보를 담는 구조체
+		VkDescriptorPoolCreateInfo poolInfo{};
+		poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());			// 디스크립터 poolSize 구조체 개수
+        poolInfo.pPoolSizes = poolSizes.data();										// 디스크립터 poolSize 구조체 배열
+		poolInfo.maxSets = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT * 2);			// 풀에 존재할 수 있는 총 디스크립터 셋 개수 (그래픽스 / 컬링)
+
+		// 디스크립터 풀 생성
+		if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &descriptorPool) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create descriptor pool!");
+		}
+	}
+
+	// 디스크립터 셋 할당 및 업데이트 하여 리소스 바인딩
+	void createDescriptorSets() {
+		// 디스크립터 셋 레이아웃 벡터 생성 (기존 만들어놨던 디스크립터 셋 레이아웃 객체 이용)
+		std::vector<VkDescriptorSetLayout> layouts(MAX_FRAMES_IN_FLIGHT, descriptorSetLayout);
+
+		// 디스크립터 셋 할당에 필요한 정보를 설정하는 구조체
 		VkDescriptorSetAllocateInfo allocInfo{};
 		allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
 		allocInfo.descriptorPool = descriptorPool;										// 디스크립터 셋을 할당할 디스크립터 풀 지정
@@ -1626,26 +2221,33 @@ private:
 		}
 
 		// 디스크립터 셋마다 디스크립터 설정 진행
+		descriptorTextureLevels.assign(MAX_FRAMES_IN_FLIGHT, textureResidentLevel);
 		for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
 			// 디스크립터 셋에 바인딩할 버퍼 정보 
 			VkDescriptorBufferInfo bufferInfo{};
-			bufferInfo.buffer = uniformBuffers[i];								// 바인딩할 버퍼
-			bufferInfo.offset = 0;												// 버퍼에서 데이터 시작 위치 offset
+			bufferInfo.buffer = uniformRingBuffer;								// 바인딩할 버퍼 (모든 프레임이 같은 링 버퍼 사용)
+			bufferInfo.offset = 0;												// 버퍼에서 데이터 시작 위치 offset (실제 위치는 바인딩할 때 dynamic offset 으로 더함)
 			bufferInfo.range = sizeof(UniformBufferObject);						// 셰이더가 접근할 버퍼 크기
 
             VkDescriptorImageInfo imageInfo{};								
             imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;	// 이미지의 레이아웃
             imageInfo.imageView = textureImageView;								// 셰이더에서 사용할 이미지 뷰
-            imageInfo.sampler = textureSampler;									// 이미지 샘플링에 사용할 샘플러 설정
+            imageInfo.sampler = textureSamplers[textureResidentLevel];			// 이미지 샘플링에 사용할 샘플러 설정 (현재 상주 레벨 minLod)
+
+			// 인스턴스 배열 (한 프레임 영역 전체, 위치는 바인딩할 때 dynamic offset 으로 지정)
+			VkDescriptorBufferInfo instanceInfo{};
+			instanceInfo.buffer = instanceRingBuffer;
+			instanceInfo.offset = 0;
+			instanceInfo.range = instanceRing.frameSize();
 
 			// 디스크립터 셋 바인딩 및 업데이트
-			std::array<VkWriteDescriptorSet, 2> descriptorWrites{};
+			std::array<VkWriteDescriptorSet, 3> descriptorWrites{};
 
 			descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 			descriptorWrites[0].dstSet = descriptorSets[i];										// 업데이트 할 디스크립터 셋
 			descriptorWrites[0].dstBinding = 0;													// 업데이트 할 바인딩 포인트
 			descriptorWrites[0].dstArrayElement = 0;											// 업데이트 할 디스크립터가 배열 타입인 경우 해당 배열의 원하는 index 부터 업데이트 가능 (배열 아니면 0으로 지정)
-			descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;				// 업데이트 할 디스크립터 타입
+			descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;		// 업데이트 할 디스크립터 타입
 			descriptorWrites[0].descriptorCount = 1;											// 업데이트 할 디스크립터 개수
 			descriptorWrites[0].pBufferInfo = &bufferInfo;										// 업데이트 할 버퍼 디스크립터 정보 구조체 배열
 
@@ -1657,18 +2259,66 @@ private:
 			descriptorWrites[1].descriptorCount = 1;											// 업데이트 할 디스크립터 개수
 			descriptorWrites[1].pImageInfo = &imageInfo;										// 업데이트 할 버퍼 디스크립터 정보 구조체 배열	
 
+			descriptorWrites[2].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			descriptorWrites[2].dstSet = descriptorSets[i];
+			descriptorWrites[2].dstBinding = 2;
+			descriptorWrites[2].dstArrayElement = 0;
+			descriptorWrites[2].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+			descriptorWrites[2].descriptorCount = 1;
+			descriptorWrites[2].pBufferInfo = &instanceInfo;
+
 			// 디스크립터 셋을 업데이트 하여 사용할 리소스 바인딩
             vkUpdateDescriptorSets(device, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
 		}
 	}
 
+	// GPU 컬링 디스크립터 셋 할당 (프레임마다 자기 명령 / 개수 구간을 바인딩)
+	void createCullDescriptorSets() {
+		if (!gpuCullSupported) {
+			return;
+		}
+
+		std::vector<VkDescriptorSetLayout> layouts(MAX_FRAMES_IN_FLIGHT, cullDescriptorSetLayout);
+		VkDescriptorSetAllocateInfo allocInfo{};
+		allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		allocInfo.descriptorPool = descriptorPool;
+		allocInfo.descriptorSetCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);
+		allocInfo.pSetLayouts = layouts.data();
+
+		cullDescriptorSets.resize(MAX_FRAMES_IN_FLIGHT);
+		if (vkAllocateDescriptorSets(device, &allocInfo, cullDescriptorSets.data()) != VK_SUCCESS) {
+			throw std::runtime_error("failed to allocate cull descriptor sets!");
+		}
+
+		for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+			std::array<VkDescriptorBufferInfo, 5> bufferInfos{};
+			bufferInfos[0] = {instanceRingBuffer, 0, instanceRing.frameSize()};
+			bufferInfos[1] = {cullSubMeshBuffer, 0, sizeof(GpuCullSubMesh) * subMeshCount};
+			bufferInfos[2] = {drawCommandBuffer, drawCommandFrameSize * i, drawCommandFrameSize};
+			bufferInfos[3] = {drawCountBuffer, drawCountFrameSize * i, drawCountFrameSize};
+			bufferInfos[4] = {cullLodBuffer, 0, VK_WHOLE_SIZE};
+
+			std::array<VkWriteDescriptorSet, 5> descriptorWrites{};
+			for (uint32_t b = 0; b < descriptorWrites.size(); b++) {
+				descriptorWrites[b].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+				descriptorWrites[b].dstSet = cullDescriptorSets[i];
+				descriptorWrites[b].dstBinding = b;
+				descriptorWrites[b].dstArrayElement = 0;
+				descriptorWrites[b].descriptorType = b == 0 ? VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+				descriptorWrites[b].descriptorCount = 1;
+				descriptorWrites[b].pBufferInfo = &bufferInfos[b];
+			}
+			vkUpdateDescriptorSets(device, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+		}
+	}
+
 	/*
 		[버퍼 생성]
 		1. 버퍼 객체 생성
-		2. 버퍼 메모리 할당
-		3. 버퍼 객체에 할당한 메모리 바인딩
+		2. 할당기에서 버퍼 메모리 구간 할당
+		3. 버퍼 객체에 할당한 메모리 구간 바인딩 (블록 메모리 + offset)
 	*/ 
-	void createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory) {
+	void createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, GpuBuffer& buffer, GpuMemory& bufferAllocation, GpuMemoryLifetime lifetime) {
 		// 버퍼 객체를 생성하기 위한 구조체 (GPU 메모리에 데이터 저장 공간을 할당하는 데 필요한 설정을 정의)
 		VkBufferCreateInfo bufferInfo{};
 		bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -1678,125 +2328,73 @@ private:
 																	// 여러 큐 패밀리에서 공유하는 모드 사용시 추가 설정 필요
 		// [버퍼 생성]
 		// 버퍼를 생성하지만 할당은 안되어있는 상태로 만들어짐       
-		if (vkCreateBuffer(device, &bufferInfo, nullptr, &buffer) != VK_SUCCESS) {
+		VkBuffer newBuffer;
+		if (vkCreateBuffer(device, &bufferInfo, nullptr, &newBuffer) != VK_SUCCESS) {
 			throw std::runtime_error("failed to create buffer!");
 		}
+		buffer = GpuBuffer(deletionQueue, newBuffer);
 
 		// [버퍼에 메모리 할당]
 		// 메모리 할당 요구사항 조회
 		VkMemoryRequirements memRequirements;
 		vkGetBufferMemoryRequirements(device, buffer, &memRequirements);
 
-		// 메모리 할당을 위한 구조체
-		VkMemoryAllocateInfo allocInfo{};
-		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		allocInfo.allocationSize = memRequirements.size;	// 할당할 메모리 크기
-		// 메모리 요구사항 설정 (GPU 메모리 유형 중 buffer와 호환되고 properties 속성들과 일치하는 것 찾아 저장)
+		// 할당기에서 버퍼 메모리 구간 할당
 		// 메모리 유형 - GPU 메모리는 구역마다 유형이 다르다. (memoryTypeBits는 buffer가 호환되는 GPU의 메모리 유형이 전부 담겨있음)
-		// 메모리 유형의 속성 - 메모리 유형마다 특성을 가지고 있음
-		allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
-
-		// 버퍼 메모리 할당
-		if (vkAllocateMemory(device, &allocInfo, nullptr, &bufferMemory) != VK_SUCCESS) {
-			throw std::runtime_error("failed to allocate buffer memory!");
-		}
-
-		// 버퍼 객체에 할당된 메모리를 바인딩 (4번째 매개변수는 할당할 메모리의 offset)
-		vkBindBufferMemory(device, buffer, bufferMemory, 0);
-	}
-
-	// 한 번만 실행할 커맨드 버퍼 생성 및 기록 시작
-	VkCommandBuffer beginSingleTimeCommands() {
-		// 커맨드 버퍼 할당을 위한 구조체 
-		VkCommandBufferAllocateInfo allocInfo{};
-		allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-		allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;		// PRIMARY LEVEL 등록 (해당 커맨드 버퍼가 큐에 단독으로 제출될 수 있음)
-		allocInfo.commandPool = commandPool;					// 커맨드 풀 지정
-		allocInfo.commandBufferCount = 1;						// 커맨드 버퍼 개수 지정
-
-		// 커맨드 버퍼 생성
-		VkCommandBuffer commandBuffer;
-		vkAllocateCommandBuffers(device, &allocInfo, &commandBuffer);
-
-		// 커맨드 버퍼 기록을 위한 정보 객체
-		VkCommandBufferBeginInfo beginInfo{};
-		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;  // 커맨드 버퍼를 1번만 제출
-
-		// GPU에 필요한 작업을 모두 커맨드 버퍼에 기록하기 시작
-		vkBeginCommandBuffer(commandBuffer, &beginInfo);
-
-		return commandBuffer;
-	}
-
-	// 한 번만 실행할 커맨드 버퍼 기록 중지 및 큐에 커맨드 버퍼 제출
-	void endSingleTimeCommands(VkCommandBuffer commandBuffer) {
-		// 커맨드 버퍼 기록 중지
-		vkEndCommandBuffer(commandBuffer);
+		// 메모리 유형의 속성 - 메모리 유형마다 특성을 가지고 있음 (할당기가 memoryTypeBits 중 properties 를 만족하는 유형 선택)
+		// lifetime - 오래 사는 버퍼는 TLSF 풀, 바로 해제하는 스테이징 버퍼는 선형 풀
+		bufferAllocation = GpuMemory(deletionQueue, gpuAllocator.allocate(memRequirements, properties, GPU_RESOURCE_LINEAR, lifetime));
 
-		// 복사 커맨드 버퍼 제출 정보 객체 생성
-		VkSubmitInfo submitInfo{};
-		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-		submitInfo.commandBufferCount = 1;								// 커맨드 버퍼 개수
-		submitInfo.pCommandBuffers = &commandBuffer;					// 커맨드 버퍼 등록
-
-		vkQueueSubmit(graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);	// 커맨드 버퍼 큐에 제출
-		vkQueueWaitIdle(graphicsQueue);									// 그래픽스 큐 작업 종료 대기
-
-		vkFreeCommandBuffers(device, commandPool, 1, &commandBuffer);	// 커맨드 버퍼 제거
-	}
-
-	// srcBuffer 에서 dstBuffer 로 데이터 복사
-	void copyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size) {
-		VkCommandBuffer commandBuffer = beginSingleTimeCommands();
-
-		VkBufferCopy copyRegion{}; 	// 복사할 버퍼 영역을 지정 (크기, src 와 dst의 시작 offset 등)
-		copyRegion.size = size;		// 복사할 버퍼 크기 설정
-		vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion); // 커맨드 버퍼에 복사 명령 기록
-
-        endSingleTimeCommands(commandBuffer);		
+		// 버퍼 객체에 할당된 메모리를 바인딩 (4번째 매개변수는 블록 안에서 버퍼 구간의 offset)
+		vkBindBufferMemory(device, buffer, bufferAllocation->memory, bufferAllocation->offset);
 	}
 
-	/*
-		GPU와 buffer가 호환되는 메모리 유형중 properties에 해당하는 속성들을 갖는 메모리 유형 찾기
-	*/
-	uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) {
-		// GPU에서 사용한 메모리 유형을 가져온다.
-		VkPhysicalDeviceMemoryProperties memProperties;
-		vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memProperties);
-
-		for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
-			// typeFilter & (1 << i) : GPU의 메모리 유형중 버퍼와 호환되는 것인지 판단
-			// memProperties.memoryTypes[i].propertyFlags & properties : GPU 메모리 유형의 속성이 properties와 일치하는지 판단
-			if ((typeFilter & (1 << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties) {
-				// 해당 메모리 유형 반환
-				return i;
-			}
+	// 이번 프레임 텍스처 스트리밍 조각을 이미지로 복사하는 명령 기록
+	void recordTextureStreamCopies(VkCommandBuffer commandBuffer) {
+		if (textureStreamCopies.empty()) {
+			return;
 		}
 
-		throw std::runtime_error("failed to find suitable memory type!");
-	}
+		// 이번 프레임 조각이 속한 레벨 구간 (작은 레벨부터 순서대로 받으므로 연속)
+		uint32_t firstLevel = textureStreamCopies.back().imageSubresource.mipLevel;
+		uint32_t lastLevel = textureStreamCopies.front().imageSubresource.mipLevel;
 
-	/*
-		[커맨드 버퍼 생성]
-		커맨드 버퍼에 GPU에서 실행할 작업을 전부 기록한뒤 제출한다.
-		GPU는 해당 커맨드 버퍼의 작업을 알아서 실행하고, CPU는 다른 일을 할 수 있게 된다. (병렬 처리)
-	*/
-	void createCommandBuffers() {
-		// 동시에 처리할 프레임 버퍼 수만큼 커맨드 버퍼 생성
-		commandBuffers.resize(MAX_FRAMES_IN_FLIGHT);
+		VkImageMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.image = textureImage;
+		barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		barrier.subresourceRange.baseMipLevel = firstLevel;
+		barrier.subresourceRange.levelCount = lastLevel - firstLevel + 1;
+		barrier.subresourceRange.baseArrayLayer = 0;
+		barrier.subresourceRange.layerCount = 1;
 
-		// 커맨드 버퍼 설정값 준비
-		VkCommandBufferAllocateInfo allocInfo{};
-		allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-		allocInfo.commandPool = commandPool; 								// 커맨드 풀 등록
-		allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;					// 큐에 직접 제출할 수 있는 커맨드 버퍼 설정
-		allocInfo.commandBufferCount = (uint32_t) commandBuffers.size(); 	// 할당할 커맨드 버퍼의 개수
+		// 이전 프레임이 (임시 색 레벨을) 샘플링 중일 수 있으므로 fragment shader 가 끝난 뒤 전환
+		// 이전 프레임에 올린 같은 레벨의 행은 유지해야 하므로 UNDEFINED 가 아닌 현재 레이아웃에서 전환
+		barrier.oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barrier.srcAccessMask = 0;
+		barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		vkCmdPipelineBarrier(commandBuffer,
+			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+			0, nullptr,
+			0, nullptr,
+			1, &barrier);
 
-		// 커맨드 버퍼 할당
-		if (vkAllocateCommandBuffers(device, &allocInfo, commandBuffers.data()) != VK_SUCCESS) {
-			throw std::runtime_error("failed to allocate command buffers!");
-		}
+		vkCmdCopyBufferToImage(commandBuffer, textureStreamBuffers[currentFrame], textureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			static_cast<uint32_t>(textureStreamCopies.size()), textureStreamCopies.data());
+
+		// 복사가 끝나야 이번 프레임 fragment shader 에서 샘플링
+		barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		vkCmdPipelineBarrier(commandBuffer,
+			VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+			0, nullptr,
+			0, nullptr,
+			1, &barrier);
 	}
 
 	/*
@@ -1804,7 +2402,7 @@ private:
 		1. 커맨드 버퍼 기록 시작
 		2. 렌더패스 시작하는 명령 기록
 		3. 파이프라인 설정 명령 기록
-		4. 렌더링 명령 기록
+		4. 렌더링 명령 기록 (기록 스레드가 있으면 3, 4 를 secondary 커맨드 버퍼에 병렬로 기록하고 실행 명령만 기록)
 		5. 렌더 패스 종료 명령 기록
 		6. 커맨드 버퍼 기록 종료
 	*/
@@ -1819,6 +2417,23 @@ private:
 			throw std::runtime_error("failed to begin recording command buffer!");
 		}
 
+		// 렌더 패스 GPU 시간 측정 시작 (이 프레임의 쿼리 2 개를 초기화하고 시작 시각 기록)
+		if (timestampQueryPool != VK_NULL_HANDLE) {
+			vkCmdResetQueryPool(commandBuffer, timestampQueryPool, currentFrame * 2, 2);
+			vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestampQueryPool, currentFrame * 2);
+		}
+
+		// 업로드 큐에서 새로 끝난 (또는 실행 중인) 배치의 리소스 소유권 획득 (제출할 때 타임라인 값 대기)
+		uploadWaitValue = uploadQueue.recordAcquire(commandBuffer);
+
+		// 렌더 패스 전에 이번 프레임 텍스처 스트리밍 조각을 이미지로 복사
+		recordTextureStreamCopies(commandBuffer);
+
+		// 렌더 패스 전에 컴퓨트 컬링으로 이번 프레임 간접 draw 명령 / 개수 기록
+		if (instanceDrawMode == INSTANCE_DRAW_GPU_CULLED) {
+			recordCullDispatch(commandBuffer);
+		}
+
 		// 렌더 패스 정보 지정
 		VkRenderPassBeginInfo renderPassInfo{};
 		renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
@@ -1834,6 +2449,13 @@ private:
 		renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());		// clear color 개수 등록
 		renderPassInfo.pClearValues = clearValues.data();								// clear color 등록 (첨부한 attachment 개수와 같게 등록)
 		
+		// draw 를 기록 스레드 수만큼 secondary 커맨드 버퍼로 나눌지 결정 (스레드 0 개면 primary 에 직접 기록)
+		uint32_t drawUnits = drawUnitCount();
+		frameRecordJobs = 0;
+		if (recordThreadCount > 0) {
+			frameRecordJobs = std::max(1u, std::min(recordThreadCount, (drawUnits + RECORD_MIN_DRAWS_PER_THREAD - 1) / RECORD_MIN_DRAWS_PER_THREAD));
+		}
+
 		/* 
 			[렌더 패스를 시작하는 명령을 기록] 
 			GPU에서 렌더링에 필요한 자원과 설정을 준비 (대략 과정)
@@ -1841,8 +2463,39 @@ private:
 			2. 서브패스 및 attachment 설정 적용
 			3. 렌더링 작업을 위한 컨텍스트 준비 (뷰포트, 시저 등 설정)
 		*/
-		vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+		vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, frameRecordJobs > 0 ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
+
+		// [Drawing 작업을 요청하는 명령 기록]
+		if (frameRecordJobs > 0) {
+			// 워커 스레드가 기록한 secondary 커맨드 버퍼를 구간 순서대로 실행
+			recordSecondaryDraws(imageIndex, drawUnits);
+			vkCmdExecuteCommands(commandBuffer, frameRecordJobs, frameCommandPools.secondaryBuffers(currentFrame));
+		} else {
+			recordDrawState(commandBuffer);
+			recordDraws(commandBuffer, 0, drawUnits);
+		}
+
+		/*
+			[렌더 패스 종료]
+			1. 자원의 정리 및 레이아웃 전환 (최종 작업을 위해 attachment에 정의된 finalLayout 설정)
+			2. Load, Store 작업 (각 attachment에 정해진 load, store 작업 실행)
+			3. 렌더 패스의 종료를 GPU에 알려 자원 재활용 등이 가능해짐
+		*/ 
+		vkCmdEndRenderPass(commandBuffer);
+
+		// 렌더 패스 GPU 시간 측정 끝 (앞선 명령이 모두 끝난 시각)
+		if (timestampQueryPool != VK_NULL_HANDLE) {
+			vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestampQueryPool, currentFrame * 2 + 1);
+		}
+
+		// [커맨드 버퍼 기록 종료]
+		if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
+			throw std::runtime_error("failed to record command buffer!");
+		}
+	}
 
+	// draw 에 필요한 상태 바인딩 (secondary 커맨드 버퍼는 primary 의 상태를 물려받지 않으므로 커맨드 버퍼마다 기록)
+	void recordDrawState(VkCommandBuffer commandBuffer) {
 		//	[사용할 그래픽 파이프 라인을 설정하는 명령 기록]
 		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline);
 
@@ -1867,26 +2520,229 @@ private:
 		VkDeviceSize offsets[] = {0};						// 버텍스 버퍼 메모리의 시작 위치 offset
 		vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets); // 커맨드 버퍼에 버텍스 버퍼 바인딩
 
-		// 인덱스 정보 입력
-		vkCmdBindIndexBuffer(commandBuffer, indexBuffer, 0, VK_INDEX_TYPE_UINT32); // 커맨드 버퍼에 인덱스 버퍼 바인딩 (4번째 매개변수 index 데이터 타입 uint32 설정)
+		// 디스크립터 셋을 커맨드 버퍼에 바인딩 (유니폼 링 / 인스턴스 링에서 이번 프레임 위치를 dynamic offset 으로 지정, 바인딩 번호 순)
+		uint32_t dynamicOffsets[] = {frameUniformOffset, frameInstanceOffset};
+		vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &descriptorSets[currentFrame], 2, dynamicOffsets);
+	}
 
-		// 디스크립터 셋을 커맨드 버퍼에 바인딩
-		vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &descriptorSets[currentFrame], 0, nullptr);
+	// 이번 프레임 draw 단위 수 (기록 스레드에 나눠주는 단위: 서브 메시, separate 방식은 서브 메시 x 인스턴스)
+	uint32_t drawUnitCount() const {
+		if (instanceDrawMode == INSTANCE_DRAW_SEPARATE) {
+			return subMeshCount * frameInstanceCount;
+		}
+		return subMeshCount;
+	}
 
-		// [Drawing 작업을 요청하는 명령 기록]
-		vkCmdDrawIndexed(commandBuffer, static_cast<uint32_t>(indices.size()), 1, 0, 0, 0); // index로 drawing 하는 명령 기록
+	// 이번 프레임을 recordInstancedDraws 로 그리는지 (인스턴스 1 개인 instanced 방식은 메시렛 경로)
+	bool usesInstancedDraws() const {
+		return instanceDrawMode != INSTANCE_DRAW_GPU_CULLED && (instances.size() > 1 || instanceDrawMode != INSTANCE_DRAW_INSTANCED);
+	}
 
-		/*
-			[렌더 패스 종료]
-			1. 자원의 정리 및 레이아웃 전환 (최종 작업을 위해 attachment에 정의된 finalLayout 설정)
-			2. Load, Store 작업 (각 attachment에 정해진 load, store 작업 실행)
-			3. 렌더 패스의 종료를 GPU에 알려 자원 재활용 등이 가능해짐
-		*/ 
-		vkCmdEndRenderPass(commandBuffer);
+	// 이번 프레임을 recordMeshletDraws 로 그리는지 (GPU 컬링 / instanced draw 가 아닌 경우)
+	bool usesMeshletDraws() const {
+		return instanceDrawMode != INSTANCE_DRAW_GPU_CULLED && !usesInstancedDraws();
+	}
 
-		// [커맨드 버퍼 기록 종료]
-		if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
-			throw std::runtime_error("failed to record command buffer!");
+	// draw 단위 [firstUnit, lastUnit) 기록 (draw 방식별 경로)
+	void recordDraws(VkCommandBuffer commandBuffer, uint32_t firstUnit, uint32_t lastUnit) {
+		if (instanceDrawMode == INSTANCE_DRAW_GPU_CULLED) {
+			recordIndirectDraws(commandBuffer, firstUnit, lastUnit);
+		} else if (usesInstancedDraws()) {
+			recordInstancedDraws(commandBuffer, firstUnit, lastUnit);
+		} else {
+			recordMeshletDraws(commandBuffer, firstUnit, lastUnit);
+		}
+	}
+
+	/*
+		[draw 병렬 기록]
+		draw 단위 [0, drawUnits) 를 frameRecordJobs 개 구간으로 나눠 스레드 풀에서 구간마다 secondary 커맨드 버퍼 1 개에 기록
+		1. 구간 j 는 슬롯 j 의 풀에서 할당한 커맨드 버퍼에만 기록 (parallelFor 작업 1 개 = 슬롯 1 개라 같은 풀을 동시에 쓰지 않음)
+		2. 구간마다 파이프라인 / 뷰포트 / 버퍼 / 디스크립터 셋을 다시 바인딩
+		3. primary 는 렌더 패스 안에서 구간 순서대로 실행하므로 draw 순서는 직접 기록과 같음
+		4. 스레드 풀을 텍스처 스트리밍 디코드 / 밉 생성과 같이 쓰지만 parallelFor 는 아직 시작하지 못한 워커를 기다리지 않으므로
+		   워커가 모두 바쁘면 호출 스레드가 구간을 모두 기록 (큐에 밀린 작업 뒤에서 멈추지 않음)
+	*/
+	void recordSecondaryDraws(uint32_t imageIndex, uint32_t drawUnits) {
+		// 이 렌더 패스 / 프레임 버퍼 안에서만 실행되는 secondary 커맨드 버퍼
+		VkCommandBufferInheritanceInfo inheritanceInfo{};
+		inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+		inheritanceInfo.renderPass = renderPass;
+		inheritanceInfo.subpass = 0;
+		inheritanceInfo.framebuffer = swapChainFramebuffers[imageIndex];
+
+		uint32_t jobCount = frameRecordJobs;
+		threadPool.parallelFor(jobCount, [&](uint32_t job) {
+			VkCommandBuffer commandBuffer = frameCommandPools.secondary(currentFrame, job);
+
+			VkCommandBufferBeginInfo beginInfo{};
+			beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+			beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+			beginInfo.pInheritanceInfo = &inheritanceInfo;
+			if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
+				throw std::runtime_error("failed to begin recording secondary command buffer!");
+			}
+
+			recordDrawState(commandBuffer);
+			uint32_t firstUnit = static_cast<uint32_t>(static_cast<uint64_t>(drawUnits) * job / jobCount);
+			uint32_t lastUnit = static_cast<uint32_t>(static_cast<uint64_t>(drawUnits) * (job + 1) / jobCount);
+			recordDraws(commandBuffer, firstUnit, lastUnit);
+
+			if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
+				throw std::runtime_error("failed to record secondary command buffer!");
+			}
+		});
+	}
+
+	// 인덱스 버퍼 바인딩 (index 데이터 타입에 맞는 구간, 폭이 바뀔 때만 다시 바인딩)
+	void bindIndexBuffer(VkCommandBuffer commandBuffer, VkIndexType indexType, VkIndexType& boundIndexType) {
+		if (indexType != boundIndexType) {
+			VkDeviceSize indexOffset = indexType == VK_INDEX_TYPE_UINT16 ? 0 : index32Offset;
+			vkCmdBindIndexBuffer(commandBuffer, indexBuffer, indexOffset, indexType);
+			boundIndexType = indexType;
+		}
+	}
+
+	/*
+		[인스턴스 1 개 draw 기록]
+		서브 메시마다 LOD 선택 (LOD 0 은 컬링을 통과한 메시렛 구간만, 더 거친 LOD 는 구간 전체를 한 번에 그림)
+		draw 는 서브 메시 순서이므로 인덱스 버퍼는 폭이 바뀔 때만 다시 바인딩
+		draw 단위는 서브 메시 (firstSubMesh ~ lastSubMesh 전까지)
+	*/
+	void recordMeshletDraws(VkCommandBuffer commandBuffer, uint32_t firstSubMesh, uint32_t lastSubMesh) {
+		VkIndexType boundIndexType = VK_INDEX_TYPE_MAX_ENUM;
+		size_t drawIndex = std::partition_point(meshletDraws.begin(), meshletDraws.end(),
+			[firstSubMesh](const MeshletDraw& draw) { return draw.subMeshIndex < firstSubMesh; }) - meshletDraws.begin();
+		for (uint32_t i = firstSubMesh; i < lastSubMesh; i++) {
+			const SubMesh& subMesh = subMeshData[i];
+
+			// 이 서브 메시에서 컬링을 통과한 draw 구간 (모두 컬링됐으면 어떤 LOD 도 그리지 않음)
+			size_t firstDraw = drawIndex;
+			while (drawIndex < meshletDraws.size() && meshletDraws[drawIndex].subMeshIndex == i) {
+				drawIndex++;
+			}
+			if (firstDraw == drawIndex) {
+				continue;
+			}
+
+			bindIndexBuffer(commandBuffer, static_cast<VkIndexType>(subMesh.indexType), boundIndexType);
+			vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(VertexQuantization), &subMesh.quantization);
+
+			uint32_t lod = selectMeshLod(subMesh, lodData, meshLodSelectParams);
+			if (lod > 0) {
+				MeshLod meshLod = subMeshLod(subMesh, lod);
+				vkCmdDrawIndexed(commandBuffer, meshLod.indexCount, 1, meshLod.firstIndex, static_cast<int32_t>(subMesh.baseVertex), 0);
+				continue;
+			}
+			for (size_t d = firstDraw; d < drawIndex; d++) {
+				vkCmdDrawIndexed(commandBuffer, meshletDraws[d].indexCount, 1, meshletDraws[d].firstIndex, static_cast<int32_t>(subMesh.baseVertex), 0);
+			}
+		}
+	}
+
+	// 서브 메시 lod 번째 LOD 의 인덱스 구간 (LOD 0 은 서브 메시 원본 구간)
+	MeshLod subMeshLod(const SubMesh& subMesh, uint32_t lod) const {
+		return lod > 0 ? lodData[subMesh.firstLod + lod] : MeshLod{subMesh.firstIndex, subMesh.indexCount, 0.0f};
+	}
+
+	/*
+		[여러 인스턴스 draw 기록]
+		인스턴스 링은 LOD 버킷 순서 (sortInstanceLods) 이므로 서브 메시마다 LOD 별 인스턴스 구간을 instanced draw 1 번씩으로 그림
+		(인스턴스별 변환은 셰이더가 gl_InstanceIndex 로 읽음, CPU 메시렛 컬링은 인스턴스 1 개 기준이라 적용하지 않음)
+		INSTANCE_DRAW_SEPARATE 이면 비교용으로 인스턴스마다 draw 1 번 (firstInstance = 인스턴스 링 위치, LOD 는 같은 버킷 기준)
+		INSTANCE_DRAW_CPU_CULLED 이면 인스턴스 링에 남은 인스턴스만 빽빽하게 기록돼 있으므로 그 수만큼 그림
+		draw 단위는 서브 메시 (separate 방식은 서브 메시 x 인스턴스, 서브 메시가 바뀔 때만 인덱스 버퍼 / 양자화 상수 갱신)
+	*/
+	void recordInstancedDraws(VkCommandBuffer commandBuffer, uint32_t firstUnit, uint32_t lastUnit) {
+		uint32_t instanceCount = frameInstanceCount;
+		if (instanceCount == 0) {
+			return;
+		}
+		VkIndexType boundIndexType = VK_INDEX_TYPE_MAX_ENUM;
+		if (instanceDrawMode == INSTANCE_DRAW_SEPARATE) {
+			uint32_t boundSubMesh = subMeshCount;		// 아직 바인딩한 서브 메시 없음
+			for (uint32_t unit = firstUnit; unit < lastUnit; unit++) {
+				uint32_t i = unit / instanceCount;
+				const SubMesh& subMesh = subMeshData[i];
+				if (i != boundSubMesh) {
+					bindIndexBuffer(commandBuffer, static_cast<VkIndexType>(subMesh.indexType), boundIndexType);
+					vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(VertexQuantization), &subMesh.quantization);
+					boundSubMesh = i;
+				}
+				uint32_t instance = unit % instanceCount;
+				MeshLod meshLod = subMeshLod(subMesh, instanceLodBuckets.lodAt(i, instance));
+				vkCmdDrawIndexed(commandBuffer, meshLod.indexCount, 1, meshLod.firstIndex, static_cast<int32_t>(subMesh.baseVertex), instance);
+			}
+			return;
+		}
+
+		for (uint32_t i = firstUnit; i < lastUnit; i++) {
+			const SubMesh& subMesh = subMeshData[i];
+			bindIndexBuffer(commandBuffer, static_cast<VkIndexType>(subMesh.indexType), boundIndexType);
+			vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(VertexQuantization), &subMesh.quantization);
+			for (uint32_t lod = 0; lod < std::max(subMesh.lodCount, 1u); lod++) {
+				uint32_t firstInstance, lastInstance;
+				instanceLodBuckets.range(i, lod, firstInstance, lastInstance);
+				if (firstInstance == lastInstance) {
+					continue;
+				}
+				MeshLod meshLod = subMeshLod(subMesh, lod);
+				vkCmdDrawIndexed(commandBuffer, meshLod.indexCount, lastInstance - firstInstance, meshLod.firstIndex, static_cast<int32_t>(subMesh.baseVertex), firstInstance);
+			}
+		}
+	}
+
+	/*
+		[GPU 컬링 디스패치 기록]
+		1. 이 프레임의 draw 개수 구간을 0 으로 초기화
+		2. 인스턴스마다 스레드 1 개로 컬링해서 보이는 draw 를 명령 구간에 압축 기록
+		3. 간접 draw 가 명령 / 개수를 읽고, 펜스 대기 후 호스트가 개수를 읽을 수 있도록 베리어
+		(이 프레임 구간을 마지막으로 읽은 draw 는 펜스 대기로 끝났으므로 쓰기 전 베리어는 초기화 → 컴퓨트만 필요)
+	*/
+	void recordCullDispatch(VkCommandBuffer commandBuffer) {
+		VkDeviceSize countOffset = drawCountFrameSize * currentFrame;
+		vkCmdFillBuffer(commandBuffer, drawCountBuffer, countOffset, sizeof(uint32_t) * subMeshCount, 0);
+
+		VkBufferMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.buffer = drawCountBuffer;
+		barrier.offset = countOffset;
+		barrier.size = sizeof(uint32_t) * subMeshCount;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+
+		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, cullPipeline);
+		vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, cullPipelineLayout, 0, 1, &cullDescriptorSets[currentFrame], 1, &frameInstanceOffset);
+		vkCmdPushConstants(commandBuffer, cullPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(GpuCullConstants), &cullConstants);
+		vkCmdDispatch(commandBuffer, (cullConstants.instanceCount + GPU_CULL_GROUP_SIZE - 1) / GPU_CULL_GROUP_SIZE, 1, 1);
+
+		VkMemoryBarrier cullBarrier{};
+		cullBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		cullBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		cullBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_HOST_READ_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &cullBarrier, 0, nullptr, 0, nullptr);
+	}
+
+	/*
+		[GPU 컬링 결과 draw 기록]
+		서브 메시마다 vkCmdDrawIndexedIndirectCount 1 번 (개수는 GPU 가 기록한 값, 기록 비용은 인스턴스 수와 무관)
+		서브 메시 i 의 명령 구간은 [i * maxDrawsPerSubMesh, ...) (maxDrawsPerSubMesh = 이번 프레임 인스턴스 수)
+		draw 단위는 서브 메시 (firstSubMesh ~ lastSubMesh 전까지)
+	*/
+	void recordIndirectDraws(VkCommandBuffer commandBuffer, uint32_t firstSubMesh, uint32_t lastSubMesh) {
+		VkDeviceSize commandOffset = drawCommandFrameSize * currentFrame;
+		VkDeviceSize countOffset = drawCountFrameSize * currentFrame;
+		VkIndexType boundIndexType = VK_INDEX_TYPE_MAX_ENUM;
+		for (uint32_t i = firstSubMesh; i < lastSubMesh; i++) {
+			const SubMesh& subMesh = subMeshData[i];
+			bindIndexBuffer(commandBuffer, static_cast<VkIndexType>(subMesh.indexType), boundIndexType);
+			vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(VertexQuantization), &subMesh.quantization);
+
+			vkCmdDrawIndexedIndirectCount(commandBuffer, drawCommandBuffer, commandOffset + sizeof(VkDrawIndexedIndirectCommand) * cullConstants.maxDrawsPerSubMesh * i,
+										  drawCountBuffer, countOffset + sizeof(uint32_t) * i, cullConstants.maxDrawsPerSubMesh, sizeof(VkDrawIndexedIndirectCommand));
 		}
 	}
 
@@ -1918,27 +2774,271 @@ private:
 				throw std::runtime_error("failed to create synchronization objects for a frame!");
 			}
 		}
+
+		// present 펜스도 signal 상태로 생성 (표시 요청 직전에 초기화)
+		if (presentFenceSupported) {
+			presentFences.resize(MAX_FRAMES_IN_FLIGHT);
+			for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+				if (vkCreateFence(device, &fenceInfo, nullptr, &presentFences[i]) != VK_SUCCESS) {
+					throw std::runtime_error("failed to create synchronization objects for a frame!");
+				}
+			}
+		}
 	}
 
-	// Uniform 변수에 해당하는 값을 구한 후 매핑된 GPU 메모리에 복사
-    void updateUniformBuffer(uint32_t currentImage) {
+	// Uniform 변수에 해당하는 값을 구한 후 유니폼 링의 이번 프레임 영역에 복사
+    void updateUniformBuffer() {
         static auto startTime = std::chrono::high_resolution_clock::now();
 
         auto currentTime = std::chrono::high_resolution_clock::now();
         float time = std::chrono::duration<float, std::chrono::seconds::period>(currentTime - startTime).count();
 
 		// 이번 프레임의 유니폼 변수 값 구하기
-		// 1초에 90도씩 회전하는 model view projection 변환 생성
+		// 1초에 90도씩 회전하는 model 변환 (인스턴스마다 제자리에서 회전)
+		glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), time * glm::radians(90.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+
+		// 카메라는 인스턴스 격자 전체가 보이도록 격자 크기만큼 뒤로 이동 (--cull-check 는 격자 일부가 frustum 밖에 있도록 절반 거리)
+		float cameraScale = 1.0f + instanceGridRadius(static_cast<uint32_t>(instances.size()), INSTANCE_SPACING) * 0.75f;
+		if (options.cullCheck) {
+			cameraScale *= 0.5f;
+		}
         UniformBufferObject ubo{};
-        ubo.model = glm::rotate(glm::mat4(1.0f), time * glm::radians(90.0f), glm::vec3(0.0f, 0.0f, 1.0f));
-        ubo.view = glm::lookAt(glm::vec3(2.0f, 2.0f, 2.0f), glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f));
-        ubo.proj = glm::perspective(glm::radians(45.0f), swapChainExtent.width / (float) swapChainExtent.height, 0.1f, 10.0f);
+        ubo.view = glm::lookAt(glm::vec3(2.0f, 2.0f, 2.0f) * cameraScale, glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+        ubo.proj = glm::perspective(glm::radians(45.0f), swapChainExtent.width / (float) swapChainExtent.height, 0.1f, 10.0f * cameraScale);
         ubo.proj[1][1] *= -1;
 
-		// 유니폼 변수를 매핑된 GPU 메모리에 복사
-        memcpy(uniformBuffersMapped[currentImage], &ubo, sizeof(ubo));
+		// 유니폼 변수를 유니폼 링에 복사하고 바인딩할 dynamic offset 기록
+        frameUniformOffset = uniformRing.push(ubo);
+
+		// 월드 좌표 frustum 평면 (GPU 컬링은 모델 변환을 컴퓨트 셰이더가 인스턴스마다 적용, CPU 컬링은 인스턴스 BVH 에 사용)
+		MeshletCullParams worldCullParams = makeMeshletCullParams(glm::mat4(1.0f), ubo.view, ubo.proj);
+
+		// 월드 좌표 LOD 선택 카메라 (GPU 컬링은 인스턴스 x 서브 메시마다, instanced draw 는 인스턴스 LOD 버킷으로 선택)
+		MeshLodSelectParams worldLodParams = makeMeshLodSelectParams(glm::mat4(1.0f), ubo.view, ubo.proj, (float) swapChainExtent.height, LOD_ERROR_PIXELS);
+
+		// 인스턴스별 변환을 인스턴스 링의 이번 프레임 영역에 직접 기록 (프레임당 할당 1 번)
+		// instanced draw 면 (CPU 컬링이면 남은) 인스턴스를 LOD 버킷 순서로 앞에서부터 기록
+		uint32_t instanceCount = static_cast<uint32_t>(instances.size());
+		void* instanceData = instanceRing.allocate(sizeof(GpuInstance) * instanceCount, frameInstanceOffset);
+		if (usesInstancedDraws()) {
+			if (instanceDrawMode == INSTANCE_DRAW_CPU_CULLED) {
+				instanceBvh.cull(worldCullParams.frustumPlanes, visibleInstances);
+			} else {
+				visibleInstances.resize(instanceCount);
+				std::iota(visibleInstances.begin(), visibleInstances.end(), 0u);
+			}
+			sortInstanceLods(worldLodParams);
+			frameInstanceCount = static_cast<uint32_t>(visibleInstances.size());
+			writeInstances(instances.data(), visibleInstances.data(), frameInstanceCount, rotation, static_cast<GpuInstance*>(instanceData));
+		} else {
+			frameInstanceCount = instanceCount;
+			writeInstances(instances.data(), instanceCount, rotation, static_cast<GpuInstance*>(instanceData));
+		}
+		frameInstanceData = static_cast<const GpuInstance*>(instanceData);
+
+		std::copy(std::begin(worldCullParams.frustumPlanes), std::end(worldCullParams.frustumPlanes), cullConstants.frustumPlanes);
+		cullConstants.instanceCount = instanceCount;
+		cullConstants.subMeshCount = subMeshCount;
+		cullConstants.maxDrawsPerSubMesh = instanceCount;		// 서브 메시 구간을 이번 프레임 인스턴스 수로 빈틈없이 배치
+		cullConstants.lodCamera = glm::vec4(worldLodParams.cameraPosition, worldLodParams.pixelsPerUnit / worldLodParams.errorThreshold);
+
+		// 첫 인스턴스 변환으로 메시렛 컬링용 카메라 정보 갱신 (인스턴스 1 개일 때만 사용)
+		glm::mat4 model = instances[0].model * rotation;
+		meshletCullParams = makeMeshletCullParams(model, ubo.view, ubo.proj);
+		meshLodSelectParams = makeMeshLodSelectParams(model, ubo.view, ubo.proj, (float) swapChainExtent.height, LOD_ERROR_PIXELS);
     }
 
+	/*
+		[인스턴스 LOD 버킷 정렬]
+		visibleInstances 의 인스턴스마다 모든 서브 메시 바운딩 구를 덮는 구까지 모델 좌표 거리를 구하고
+		서브 메시 / LOD 별 연속 구간이 되도록 재배치 (recordInstancedDraws 가 구간마다 instanced draw 1 번)
+	*/
+	void sortInstanceLods(const MeshLodSelectParams& worldLodParams) {
+		instanceLodDistances.resize(instances.size());
+		for (uint32_t i : visibleInstances) {
+			const glm::mat4& model = instances[i].model;
+			float scale = std::max({glm::length(glm::vec3(model[0])), glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))});
+			instanceLodDistances[i] = glm::length(glm::vec3(model[3]) - worldLodParams.cameraPosition) / scale - instanceBoundRadius;
+		}
+		instanceLodBuckets.setCamera(subMeshData, subMeshCount, lodData, worldLodParams);
+		instanceLodBuckets.sort(instanceLodDistances.data(), visibleInstances);
+	}
+
+	/*
+		[렌더 패스 GPU 시간 측정용 timestamp 쿼리 풀 생성]
+		프레임마다 쿼리 2 개 (렌더 패스 시작 / 끝), 그래픽스 큐가 timestamp 를 지원하지 않으면 측정하지 않음
+	*/
+	void createTimestampQueries() {
+		VkPhysicalDeviceProperties properties;
+		vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+		if (!properties.limits.timestampComputeAndGraphics || properties.limits.timestampPeriod <= 0.0f) {
+			std::cout << "[createTimestampQueries] timestamps not supported, GPU time is not measured" << std::endl;
+			return;
+		}
+		timestampPeriod = properties.limits.timestampPeriod;
+
+		VkQueryPoolCreateInfo queryPoolInfo{};
+		queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		queryPoolInfo.queryCount = MAX_FRAMES_IN_FLIGHT * 2;
+
+		if (vkCreateQueryPool(device, &queryPoolInfo, nullptr, &timestampQueryPool) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create timestamp query pool!");
+		}
+		timestampWritten.assign(MAX_FRAMES_IN_FLIGHT, false);
+	}
+
+	// 펜스를 기다린 뒤 이 프레임의 timestamp 2 개를 읽어서 렌더 패스 GPU 시간 (ms) 계산 (기록한 적 없으면 false)
+	bool readFrameTimestamps(double& gpuMs) {
+		if (timestampQueryPool == VK_NULL_HANDLE || !timestampWritten[currentFrame]) {
+			return false;
+		}
+		timestampWritten[currentFrame] = false;
+
+		uint64_t ticks[2];
+		if (vkGetQueryPoolResults(device, timestampQueryPool, currentFrame * 2, 2, sizeof(ticks), ticks, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT) != VK_SUCCESS) {
+			return false;
+		}
+		gpuMs = static_cast<double>(ticks[1] - ticks[0]) * timestampPeriod / 1e6;
+		return true;
+	}
+
+	/*
+		[GPU 컬링 readback 검사 (--cull-check)]
+		펜스를 기다린 프레임의 draw 개수 버퍼를 읽어서 제출할 때 계산한 CPU 기준값 범위 안인지 확인
+		CULL_CHECK_FRAMES 프레임을 비교하면 결과를 출력하고 창을 닫아서 종료 (틀리면 예외)
+	*/
+	void checkCullReadback() {
+		if (!cullReferenceValid[currentFrame]) {
+			return;
+		}
+		cullReferenceValid[currentFrame] = false;
+
+		const uint32_t* drawCounts = reinterpret_cast<const uint32_t*>(static_cast<const uint8_t*>(drawCountAllocation->mapped) + drawCountFrameSize * currentFrame);
+		uint32_t visible = 0;
+		for (uint32_t i = 0; i < subMeshCount; i++) {
+			visible += drawCounts[i];
+		}
+
+		const GpuCullReference& reference = cullReferences[currentFrame];
+		if (visible < reference.minVisible || visible > reference.maxVisible) {
+			std::cerr << "[cullCheck] GPU kept " << visible << " draws, CPU reference " << reference.minVisible << " ~ " << reference.maxVisible << std::endl;
+			throw std::runtime_error("GPU culling draw count does not match the CPU reference!");
+		}
+		uint32_t total = static_cast<uint32_t>(instances.size()) * subMeshCount;
+		if (visible > 0 && visible < total) {
+			cullCheckCulledFrames++;
+		}
+
+		if (++cullCheckFrames == CULL_CHECK_FRAMES) {
+			if (cullCheckCulledFrames == 0) {
+				throw std::runtime_error("GPU culling check did not cull any draws (use more instances)!");
+			}
+			std::cout << "[cullCheck] " << cullCheckFrames << " frames match the CPU reference (last frame: " << visible << " of " << total << " draws survived)" << std::endl;
+			glfwSetWindowShouldClose(window, GLFW_TRUE);
+		}
+	}
+
+	/*
+		[인스턴스 수별 측정 (--instance-sweep)]
+		INSTANCE_SWEEP_COUNTS 마다 InstanceDrawMode 를 차례로 측정 (GPU 컬링을 지원하지 않거나 명령 구간이 모자라면 건너뜀)
+		1. 단계마다 INSTANCE_SWEEP_WARMUP_FRAMES 프레임은 버림 (이전 단계 프레임의 GPU 시간이 섞이지 않도록)
+		2. 이후 INSTANCE_SWEEP_MEASURE_FRAMES 프레임의 CPU 기록 시간 / GPU 시간 평균 출력
+		3. 마지막 단계가 끝나면 창을 닫아서 종료
+	*/
+	void updateInstanceSweep(bool gpuTimeValid) {
+		sweepFrame++;
+		if (sweepFrame > INSTANCE_SWEEP_WARMUP_FRAMES) {
+			sweepRecordMs += frameRecordMs;
+			if (gpuTimeValid) {
+				sweepGpuMs += frameGpuMs;
+				sweepGpuSamples++;
+			}
+		}
+		if (sweepFrame < INSTANCE_SWEEP_WARMUP_FRAMES + INSTANCE_SWEEP_MEASURE_FRAMES) {
+			return;
+		}
+
+		uint32_t instanceCount = static_cast<uint32_t>(instances.size());
+		uint32_t drawCalls = subMeshCount * (instanceDrawMode == INSTANCE_DRAW_SEPARATE ? instanceCount : 1);
+		std::cout << "[instanceSweep] " << instanceCount << " instances, " << INSTANCE_DRAW_MODE_NAMES[instanceDrawMode]
+				  << " (" << drawCalls << " draw calls";
+		if (instanceDrawMode == INSTANCE_DRAW_CPU_CULLED) {
+			std::cout << ", " << frameInstanceCount << " visible";	// 마지막 프레임 기준
+		}
+		std::cout << "): CPU record " << sweepRecordMs / INSTANCE_SWEEP_MEASURE_FRAMES << " ms, GPU ";
+		if (sweepGpuSamples > 0) {
+			std::cout << sweepGpuMs / sweepGpuSamples << " ms" << std::endl;
+		} else {
+			std::cout << "n/a" << std::endl;
+		}
+
+		sweepFrame = 0;
+		sweepRecordMs = 0.0;
+		sweepGpuMs = 0.0;
+		sweepGpuSamples = 0;
+		sweepStep++;
+		if (!applySweepStep()) {
+			glfwSetWindowShouldClose(window, GLFW_TRUE);
+		}
+	}
+
+	/*
+		[기록 스레드 수별 측정 (--record-sweep)]
+		recordSweepThreads 의 스레드 수마다 (0 = primary 에 직접 기록) 커맨드 버퍼 기록 CPU 시간 측정
+		1. 단계마다 INSTANCE_SWEEP_WARMUP_FRAMES 프레임은 버리고 이후 INSTANCE_SWEEP_MEASURE_FRAMES 프레임 평균과 직접 기록 대비 배율 출력
+		2. 인스턴스 기록 / CPU 컬링 시간은 스레드 수와 무관하므로 제외
+		3. 마지막 단계가 끝나면 창을 닫아서 종료
+	*/
+	void updateRecordSweep() {
+		sweepFrame++;
+		if (sweepFrame > INSTANCE_SWEEP_WARMUP_FRAMES) {
+			sweepRecordMs += frameCommandRecordMs;
+		}
+		if (sweepFrame < INSTANCE_SWEEP_WARMUP_FRAMES + INSTANCE_SWEEP_MEASURE_FRAMES) {
+			return;
+		}
+
+		double recordMs = sweepRecordMs / INSTANCE_SWEEP_MEASURE_FRAMES;
+		if (recordSweepStep == 0) {
+			recordSweepBaselineMs = recordMs;
+		}
+		uint32_t instanceCount = static_cast<uint32_t>(instances.size());
+		uint32_t drawCalls = subMeshCount * (instanceDrawMode == INSTANCE_DRAW_SEPARATE ? instanceCount : 1);
+		std::cout << "[recordSweep] " << INSTANCE_DRAW_MODE_NAMES[instanceDrawMode] << " (" << drawCalls << " draw calls), ";
+		if (recordThreadCount == 0) {
+			std::cout << "inline on main thread";
+		} else {
+			std::cout << recordThreadCount << " threads (" << frameRecordJobs << " secondary command buffers)";
+		}
+		std::cout << ": record " << recordMs << " ms, x" << recordSweepBaselineMs / recordMs << " vs inline" << std::endl;
+
+		sweepFrame = 0;
+		sweepRecordMs = 0.0;
+		recordSweepStep++;
+		if (recordSweepStep == recordSweepThreads.size()) {
+			glfwSetWindowShouldClose(window, GLFW_TRUE);
+			return;
+		}
+		recordThreadCount = recordSweepThreads[recordSweepStep];
+	}
+
+	// sweepStep 단계의 인스턴스 수 / draw 방식 적용 (지원하지 않는 방식은 다음 단계로 넘김, 단계가 끝나면 false)
+	bool applySweepStep() {
+		for (; sweepStep < std::size(INSTANCE_SWEEP_COUNTS) * INSTANCE_DRAW_MODE_COUNT; sweepStep++) {
+			InstanceDrawMode mode = static_cast<InstanceDrawMode>(sweepStep % INSTANCE_DRAW_MODE_COUNT);
+			uint32_t instanceCount = INSTANCE_SWEEP_COUNTS[sweepStep / INSTANCE_DRAW_MODE_COUNT];
+			if (mode == INSTANCE_DRAW_GPU_CULLED && !gpuCullFits(instanceCount)) {
+				continue;
+			}
+			makeInstanceGrid(instanceCount, INSTANCE_SPACING, 1, instances);
+			buildInstanceBvh();
+			instanceDrawMode = mode;
+			return true;
+		}
+		return false;
+	}
+
 	/*
 		[다중 Frame 방식으로 그리기]
 		동시에 작업 가능한 최대 Frame 개수만큼 자원을 생성하여 사용 (semaphore, fence, commandBuffer)
@@ -1949,6 +3049,25 @@ private:
 		// [이전 GPU 작업 대기]
 		// 동시에 작업 가능한 최대 Frame 개수만큼 작업 중인 경우 대기 (가장 먼저 시작한 Frame 작업이 끝나서 Fence에 signal을 보내기를 기다림)
 		vkWaitForFences(device, 1, &inFlightFences[currentFrame], VK_TRUE, UINT64_MAX);
+		// present 펜스가 있으면 이 프레임의 표시 요청까지 끝나야 프레임 완료 (이전 스왑 체인을 추가 지연 없이 파괴 가능)
+		if (presentFenceSupported) {
+			vkWaitForFences(device, 1, &presentFences[currentFrame], VK_TRUE, UINT64_MAX);
+		}
+
+		// 이 프레임까지 끝났으므로 그 전에 해제한 GPU 객체 파괴
+		deletionQueue.frameCompleted(currentFrame);
+
+		// 이 프레임이 제출했던 렌더 패스 GPU 시간 읽기
+		bool gpuTimeValid = readFrameTimestamps(frameGpuMs);
+
+		// 이 프레임이 제출했던 GPU 컬링 결과를 CPU 기준값과 비교
+		if (options.cullCheck) {
+			checkCullReadback();
+		}
+
+		// GPU 가 이 프레임의 유니폼 / 인스턴스 링 영역을 다 읽었으므로 처음부터 재사용
+		uniformRing.beginFrame(currentFrame);
+		instanceRing.beginFrame(currentFrame);
  
 		// [작업할 image 준비]
 		// 이번 Frame 에서 사용할 이미지 준비 및 해당 이미지 index 받아오기 (준비가 끝나면 signal 보낼 세마포어 등록)
@@ -1967,17 +3086,36 @@ private:
 			throw std::runtime_error("failed to acquire swap chain image!");
 		}
 
-		// Uniform buffer 업데이트
-		updateUniformBuffer(currentFrame);
+		// Uniform buffer / 인스턴스 버퍼 업데이트 (인스턴스 기록은 CPU 기록 시간에 포함)
+		auto recordStartTime = std::chrono::high_resolution_clock::now();
+		updateUniformBuffer();
+		double instanceWriteMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - recordStartTime).count();
+
+		// [텍스처 스트리밍]
+		// 이번 프레임 예산만큼 밉 레벨 조각을 업로드 버퍼에 복사하고 상주 레벨에 맞게 샘플러 교체
+		updateTextureStream();
+
+		// [메시렛 컬링]
+		// 이번 프레임 카메라 기준으로 보이는 메시렛만 draw 목록에 남김 (커맨드 버퍼 기록 전에 CPU 에서 처리)
+		// 메시렛 경로로 그리는 프레임에만 실행 (instanced / GPU 컬링 경로는 draw 목록을 쓰지 않음)
+		if (usesMeshletDraws()) {
+			cullMeshlets(subMeshData, subMeshCount, meshletData, meshletCullParams, meshletDraws);
+		} else {
+			meshletDraws.clear();
+		}
 
 		// [Fence 초기화]
 		// Fence signal 상태 not signaled 로 초기화
 		vkResetFences(device, 1, &inFlightFences[currentFrame]);
 
 		// [Command Buffer에 명령 기록]
-		// 커맨드 버퍼 초기화 및 명령 기록
-		vkResetCommandBuffer(commandBuffers[currentFrame], /*VkCommandBufferResetFlagBits*/ 0); // 두 번째 매개변수인 Flag 를 0으로 초기화하면 기본 초기화 진행
-		recordCommandBuffer(commandBuffers[currentFrame], imageIndex); // 현재 작업할 image의 index와 commandBuffer를 전송
+		// 이 프레임 펜스를 기다렸으므로 커맨드 버퍼를 하나씩 초기화하지 않고 이 프레임의 커맨드 풀 (primary / 기록 스레드별 secondary) 을 한 번에 초기화
+		frameCommandPools.reset(currentFrame);
+		VkCommandBuffer commandBuffer = frameCommandPools.primary(currentFrame);
+		recordStartTime = std::chrono::high_resolution_clock::now();
+		recordCommandBuffer(commandBuffer, imageIndex); // 현재 작업할 image의 index와 commandBuffer를 전송
+		frameCommandRecordMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - recordStartTime).count();
+		frameRecordMs = instanceWriteMs + frameCommandRecordMs;
 
 		// [렌더링 Command Buffer 제출]
 		// 렌더링 커맨드 버퍼 제출 정보 객체 생성
@@ -1985,15 +3123,24 @@ private:
 		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
 		// 작업 실행 신호를 받을 대기 세마포어 설정 (해당 세마포어가 signal 상태가 되기 전엔 대기)
-		VkSemaphore waitSemaphores[] = {imageAvailableSemaphores[currentFrame]};				
-		VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT}; 	
-		submitInfo.waitSemaphoreCount = 1;														// 대기 세마포어 개수
+		// 새 업로드 배치가 있으면 업로드 큐 타임라인 값도 대기 (획득 베리어의 src 단계에서 대기, binary 세마포어 값은 무시됨)
+		VkSemaphore waitSemaphores[] = {imageAvailableSemaphores[currentFrame], uploadQueue.semaphore()};
+		VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, UploadQueue::ACQUIRE_WAIT_STAGE};
+		uint64_t waitValues[] = {0, uploadWaitValue};
+		VkTimelineSemaphoreSubmitInfo timelineInfo{};
+		timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+		timelineInfo.waitSemaphoreValueCount = 2;
+		timelineInfo.pWaitSemaphoreValues = waitValues;
+		if (uploadWaitValue != 0) {
+			submitInfo.pNext = &timelineInfo;
+		}
+		submitInfo.waitSemaphoreCount = uploadWaitValue != 0 ? 2 : 1;							// 대기 세마포어 개수
 		submitInfo.pWaitSemaphores = waitSemaphores;											// 대기 세마포어 등록
 		submitInfo.pWaitDstStageMask = waitStages;												// 대기할 시점 등록 (그 전까지는 세마포어 상관없이 그냥 진행)	
 
 		// 커맨드 버퍼 등록
 		submitInfo.commandBufferCount = 1;														// 커맨드 버퍼 개수 등록
-		submitInfo.pCommandBuffers = &commandBuffers[currentFrame];								// 커매드 버퍼 등록
+		submitInfo.pCommandBuffers = &commandBuffer;								// 커매드 버퍼 등록
 
 		// 작업이 완료된 후 신호를 보낼 세마포어 설정 (작업이 끝나면 해당 세마포어 signal 상태로 변경)
 		VkSemaphore signalSemaphores[] = {renderFinishedSemaphores[currentFrame]};
@@ -2004,6 +3151,25 @@ private:
 		if (vkQueueSubmit(graphicsQueue, 1, &submitInfo, inFlightFences[currentFrame]) != VK_SUCCESS) {
 			throw std::runtime_error("failed to submit draw command buffer!");
 		}
+		deletionQueue.frameSubmitted(currentFrame);		// 제출 번호 기록 (이후에 해제하는 객체는 다음 제출 프레임이 끝난 뒤 파괴)
+		if (timestampQueryPool != VK_NULL_HANDLE) {
+			timestampWritten[currentFrame] = true;
+		}
+		if (options.cullCheck) {
+			// 제출한 인스턴스 변환과 같은 판정으로 기준값 계산 (펜스 대기 후 readback 과 비교)
+			cullReferences[currentFrame] = countVisibleDraws(frameInstanceData, cullConstants.instanceCount, cullSubMeshes.data(), subMeshCount,
+															 cullConstants.frustumPlanes, CULL_CHECK_TOLERANCE);
+			cullReferenceValid[currentFrame] = true;
+		}
+
+		// 인스턴스 수별 측정 진행 (이번 프레임 CPU 기록 시간, 펜스를 기다린 이전 프레임 GPU 시간)
+		if (options.instanceSweep) {
+			updateInstanceSweep(gpuTimeValid);
+		}
+		// 기록 스레드 수별 측정 진행
+		if (options.recordSweep) {
+			updateRecordSweep();
+		}
 
 		// [프레젠테이션 Command Buffer 제출]
 		// 프레젠테이션 커맨드 버퍼 제출 정보 객체 생성
@@ -2020,6 +3186,16 @@ private:
 		presentInfo.pSwapchains = swapChains;													// 스왑체인 등록
 		presentInfo.pImageIndices = &imageIndex;												// 스왑체인에서 표시할 이미지 핸들 등록
 
+		// 표시 요청이 끝나면 signal 되는 present 펜스 (OUT_OF_DATE 로 거절돼도 signal 됨)
+		VkSwapchainPresentFenceInfoEXT presentFenceInfo{};
+		if (presentFenceSupported) {
+			vkResetFences(device, 1, &presentFences[currentFrame]);
+			presentFenceInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_FENCE_INFO_EXT;
+			presentFenceInfo.swapchainCount = 1;
+			presentFenceInfo.pFences = &presentFences[currentFrame];
+			presentInfo.pNext = &presentFenceInfo;
+		}
+
 		// 프레젠테이션 큐에 이미지 제출
 		result = vkQueuePresentKHR(presentQueue, &presentInfo);
 
@@ -2042,11 +3218,11 @@ private:
 	매개변수로 받은 쉐이더 파일을 shader module로 만들어 줌
 	shader module은 쉐이더 파일을 객체화 한 것임
 	*/ 
-	VkShaderModule createShaderModule(const std::vector<char>& code) {
+	VkShaderModule createShaderModule(const AssetBlob& code) {
 		VkShaderModuleCreateInfo createInfo{};
 		createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-		createInfo.codeSize = code.size();									// 코드 길이 입력
-		createInfo.pCode = reinterpret_cast<const uint32_t*>(code.data());	// 코드 내용 입력
+		createInfo.codeSize = code.size;									// 코드 길이 입력
+		createInfo.pCode = reinterpret_cast<const uint32_t*>(code.data);	// 코드 내용 입력 (4 byte 정렬 필요)
 
 		// 쉐이더 모듈 생성
 		VkShaderModule shaderModule;
@@ -2160,7 +3336,12 @@ private:
         VkPhysicalDeviceFeatures supportedFeatures;
         vkGetPhysicalDeviceFeatures(device, &supportedFeatures);
 
-		return indices.isComplete() && extensionsSupported && swapChainAdequate && supportedFeatures.samplerAnisotropy;
+		// 업로드 큐의 타임라인 세마포어는 Vulkan 1.2 core (1.2 장치는 항상 지원)
+		VkPhysicalDeviceProperties properties;
+		vkGetPhysicalDeviceProperties(device, &properties);
+		bool timelineSupported = properties.apiVersion >= VK_API_VERSION_1_2;
+
+		return indices.isComplete() && extensionsSupported && swapChainAdequate && supportedFeatures.samplerAnisotropy && timelineSupported;
 	}
 
 	// 디바이스가 지원하는 확장 중 
@@ -2186,6 +3367,7 @@ private:
 	/*
 	GPU가 지원하는 큐패밀리 인덱스 가져오기
 	그래픽스 큐패밀리, 프레젠테이션 큐패밀리 인덱스를 저장
+	전송 큐패밀리는 그래픽스를 지원하지 않는 것 중 컴퓨트도 지원하지 않는 (DMA 엔진) 큐패밀리 우선
 	해당 큐패밀리가 없으면 optional 객체에 정보가 empty 상태
 	*/
 	QueueFamilyIndices findQueueFamilies(VkPhysicalDevice device) {
@@ -2199,11 +3381,13 @@ private:
 		std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
 		vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, queueFamilies.data());
 
-		// 그래픽 큐 패밀리 검색
-		int i = 0;
-		for (const auto& queueFamily : queueFamilies) {
+		// 그래픽 큐 패밀리 검색 (전송 큐 패밀리를 찾기 위해 전부 순회)
+		bool dedicatedTransfer = false;
+		for (uint32_t i = 0; i < queueFamilyCount; i++) {
+			const VkQueueFamilyProperties& queueFamily = queueFamilies[i];
+
 			// 그래픽 큐 패밀리 찾기 성공한 경우 indices에 값 생성
-			if (queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT) {
+			if (!indices.graphicsFamily.has_value() && (queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT)) {
 				indices.graphicsFamily = i;
 			}
 
@@ -2212,16 +3396,15 @@ private:
 			vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &presentSupport);
 
 			// 프레젠테이션 큐 패밀리 등록
-			if (presentSupport) {
+			if (!indices.presentFamily.has_value() && presentSupport) {
 				indices.presentFamily = i;
 			}
 
-			// 그래픽 큐 패밀리 찾은 경우 break
-			if (indices.isComplete()) {
-				break;
+			// 전송 큐 패밀리 등록 (그래픽스 미지원, 컴퓨트까지 미지원이면 확정)
+			if ((queueFamily.queueFlags & VK_QUEUE_TRANSFER_BIT) && !(queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT) && !dedicatedTransfer) {
+				indices.transferFamily = i;
+				dedicatedTransfer = !(queueFamily.queueFlags & VK_QUEUE_COMPUTE_BIT);
 			}
-
-			i++;
 		}
 		// 그래픽 큐 패밀리를 못 찾은 경우 값이 없는 채로 반환 됨
 		return indices;
@@ -2241,10 +3424,46 @@ private:
 		if (enableValidationLayers) {
 			extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
 		}
+
+		// present 펜스 (VK_EXT_swapchain_maintenance1) 에 필요한 surface 확장은 지원하는 경우만 추가
+		surfaceMaintenanceEnabled = instanceExtensionSupported(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME)
+			&& instanceExtensionSupported(VK_EXT_SURFACE_MAINTENANCE_1_EXTENSION_NAME);
+		if (surfaceMaintenanceEnabled) {
+			extensions.push_back(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME);
+			extensions.push_back(VK_EXT_SURFACE_MAINTENANCE_1_EXTENSION_NAME);
+		}
 		
 		return extensions;
 	}
 
+	// 인스턴스가 확장 하나를 지원하는지 확인 (선택 확장용)
+	bool instanceExtensionSupported(const char* name) {
+		uint32_t extensionCount;
+		vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, nullptr);
+		std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+		vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, availableExtensions.data());
+		for (const auto& extension : availableExtensions) {
+			if (strcmp(extension.extensionName, name) == 0) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// 디바이스가 확장 하나를 지원하는지 확인 (선택 확장용)
+	bool deviceExtensionSupported(VkPhysicalDevice device, const char* name) {
+		uint32_t extensionCount;
+		vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, nullptr);
+		std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+		vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, availableExtensions.data());
+		for (const auto& extension : availableExtensions) {
+			if (strcmp(extension.extensionName, name) == 0) {
+				return true;
+			}
+		}
+		return false;
+	}
+
 	// 검증 레이어가 사용 가능한 레이어 목록에 있는지 확인
 	bool checkValidationLayerSupport() {
 		// Vulkan 인스턴스에서 사용 가능한 레이어들 목록 생성
@@ -2270,6 +3489,17 @@ private:
 		return true;  // 모든 레이어가 지원되면 true 반환
 	}
 
+	// 에셋 팩의 SPIR-V 구간 (팩에 없으면 개별 파일을 storage 로 읽어서 반환)
+	AssetBlob loadShaderCode(const std::string& path, std::vector<char>& storage) {
+		AssetBlob code;
+		if (!assetPack.find(path, ASSET_TYPE_SHADER, code)) {
+			storage = readFile(generatedAssetPath(path));
+			code.data = reinterpret_cast<const uint8_t*>(storage.data());
+			code.size = storage.size();
+		}
+		return code;
+	}
+
 	// shader 파일인 SPIR-V 파일을 바이너리 형태로 읽어오는 함수
 	static std::vector<char> readFile(const std::string& filename) {
 		std::ifstream file(filename, std::ios::ate | std::ios::binary);
@@ -2301,11 +3531,46 @@ private:
 	}
 };
 
-int main() {
+/*
+	명령행 옵션 파싱
+	--instances N : 모델 N 개를 격자로 배치해서 instanced draw 로 그림 (1 ~ MAX_INSTANCES)
+	--instance-sweep : 인스턴스 1 ~ 100000 개에서 CPU 기록 시간 / GPU 시간을 측정하고 종료
+	--no-gpu-cull : 컴퓨트 컬링 + 간접 draw 대신 CPU BVH 컬링 + instanced draw 사용
+	--cull-check : GPU 컬링 후 남은 draw 수를 CPU 기준값과 비교하고 종료 (예: --instances 10000 --cull-check, lavapipe 에서도 실행 가능)
+	--record-threads N : draw 를 N 개 스레드가 secondary 커맨드 버퍼로 나눠 기록 (0 이면 메인 스레드가 primary 에 직접 기록, 기본: 모든 스레드)
+	--record-sweep : 인스턴스마다 draw 1 번으로 그리면서 기록 스레드 0, 1, 2, 4, ... 개의 커맨드 기록 시간을 측정하고 종료 (예: --instances 10000 --record-sweep)
+*/
+RenderOptions parseOptions(int argc, char** argv) {
+	RenderOptions options;
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		if (arg == "--instances" && i + 1 < argc) {
+			options.instanceCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (arg == "--instance-sweep") {
+			options.instanceSweep = true;
+		} else if (arg == "--no-gpu-cull") {
+			options.gpuCulling = false;
+		} else if (arg == "--cull-check") {
+			options.cullCheck = true;
+		} else if (arg == "--record-threads" && i + 1 < argc) {
+			options.recordThreads = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (arg == "--record-sweep") {
+			options.recordSweep = true;
+		} else {
+			throw std::runtime_error("unknown option: " + arg);
+		}
+	}
+	if (options.instanceSweep && options.recordSweep) {
+		throw std::runtime_error("--instance-sweep and --record-sweep cannot be used together!");
+	}
+	return options;
+}
+
+int main(int argc, char** argv) {
 	HelloTriangleApplication app;
 
 	try {
-		app.run();
+		app.run(parseOptions(argc, argv));
 	} catch (const std::exception& e) {
 		std::cerr << e.what() << std::endl;
 		return EXIT_FAILURE;
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+	[읽기 전용 메모리 매핑 파일]
+	파일 내용을 프로세스 주소 공간에 그대로 매핑한다.
+	read()로 버퍼에 복사하지 않고 OS 페이지 캐시를 직접 참조하므로
+	스테이징 버퍼로 바로 memcpy 할 수 있다.
+*/
+class MappedFile {
+public:
+	MappedFile() = default;
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	MappedFile(MappedFile&& other) noexcept;
+	MappedFile& operator=(MappedFile&& other) noexcept;
+
+	// 파일 매핑 (실패시 false 반환)
+	bool open(const std::string& path);
+	// 매핑 해제
+	void close();
+
+	// [offset, offset + size) 구간을 페이지 캐시로 미리 읽도록 OS 에 요청 (비동기, 실패해도 무시)
+	void prefetch(size_t offset, size_t size) const;
+
+	bool isOpen() const { return mappedData != nullptr; }
+	const uint8_t* data() const { return mappedData; }
+	size_t size() const { return mappedSize; }
+
+private:
+	const uint8_t* mappedData = nullptr;
+	size_t mappedSize = 0;
+
+#ifdef _WIN32
+	void* fileHandle = nullptr;
+	void* mappingHandle = nullptr;
+#else
+	int fileDescriptor = -1;
+#endif
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "vertex.h"
+#include "vertex_layout.h"
+
+#include <cstdint>
+#include <vector>
+
+/*
+	[서브 메시]
+	여러 mesh를 하나의 vertex / index 버퍼에 합쳤을 때
+	각 mesh가 병합 버퍼의 어느 구간을 쓰는지 기록한다.
+	vkCmdDrawIndexed(indexCount, 1, firstIndex, baseVertex, 0) 으로 바로 그릴 수 있다.
+*/
+struct SubMesh {
+	uint32_t baseVertex;		// 병합 vertex 버퍼에서 이 mesh의 첫 정점 위치 (인덱스는 이 값 기준 상대값)
+	uint32_t vertexCount;		// 이 mesh의 정점 개수
+	uint32_t firstIndex;		// 병합 index 버퍼에서 이 mesh의 첫 인덱스 위치 (인코딩 후에는 indexType 별 배열 기준)
+	uint32_t indexCount;		// 이 mesh의 인덱스 개수
+	uint32_t materialIndex;		// aiScene 의 material 인덱스
+	uint32_t indexType;			// 업로드용 인덱스 폭 (VK_INDEX_TYPE_UINT16 / VK_INDEX_TYPE_UINT32)
+	VertexQuantization quantization;	// GpuVertex → pos / texCoord 복원 변환 (draw 마다 push constant 로 전달)
+	uint32_t firstMeshlet;		// 이 mesh의 첫 메시렛 위치 (메시렛을 만들지 않았으면 meshletCount 0)
+	uint32_t meshletCount;		// 이 mesh의 메시렛 개수
+	uint32_t firstLod;			// 이 mesh의 첫 LOD 위치 (LOD 를 만들지 않았으면 lodCount 0)
+	uint32_t lodCount;			// LOD 개수 (LOD 0 = 원본 인덱스 구간 포함)
+	glm::vec3 center;			// LOD 선택용 바운딩 구 중심 (모델 좌표)
+	float radius;				// LOD 선택용 바운딩 구 반지름
+};
+
+/*
+	[LOD]
+	서브 메시를 단순화한 인덱스 구간 (정점은 원본과 공유하고 인덱스만 다름)
+	원본 인덱스와 같은 indexType 배열에 이어서 저장되므로 같은 인덱스 버퍼 / baseVertex 로 그린다.
+*/
+struct MeshLod {
+	uint32_t firstIndex;		// 서브 메시 indexType 별 인덱스 배열에서 첫 인덱스 위치
+	uint32_t indexCount;		// 인덱스 개수
+	float error;				// 원본 대비 최대 기하 오차 (모델 좌표 거리, LOD 0 은 0)
+};
+
+/*
+	[메시렛]
+	서브 메시 안의 작은 삼각형 클러스터 (정점 64 개 / 삼각형 124 개 이하)
+	메시렛의 삼각형은 인덱스 배열에서 연속된 구간이므로 vkCmdDrawIndexed 1 번으로 그릴 수 있고,
+	바운딩 구와 법선 콘으로 frustum / backface 컬링을 클러스터 단위로 한다. (모두 서브 메시의 모델 좌표 기준)
+*/
+struct Meshlet {
+	glm::vec3 center;			// 바운딩 구 중심
+	float radius;				// 바운딩 구 반지름
+	glm::vec3 coneApex;			// 법선 콘 꼭짓점 (카메라 → 꼭짓점 방향으로 backface 판정)
+	float coneCutoff;			// sin(콘 반각) (1 이면 콘이 너무 넓어 backface 컬링 안 함)
+	glm::vec3 coneAxis;			// 법선 콘 축 (정규화)
+	uint32_t firstIndex;		// 서브 메시 indexType 별 인덱스 배열에서 첫 인덱스 위치
+	uint32_t indexCount;		// 인덱스 개수 (삼각형 수 * 3)
+	uint32_t vertexCount;		// 사용하는 고유 정점 수
+};
+
+// CPU 측 모델 데이터 (모든 mesh가 병합된 정점 / 인덱스 배열 + 서브 메시 목록)
+struct MeshData {
+	std::vector<Vertex> vertices;			// 후처리용 float 정점
+	std::vector<GpuVertex> gpuVertices;		// 업로드용 정점 (후처리 마지막에 vertices 를 인코딩)
+	std::vector<uint32_t> indices;			// 후처리용 인덱스 (인코딩 후 비워짐)
+	std::vector<uint16_t> gpuIndices16;		// 업로드용 16bit 인덱스
+	std::vector<uint32_t> gpuIndices32;		// 업로드용 32bit 인덱스
+	std::vector<SubMesh> subMeshes;
+	std::vector<Meshlet> meshlets;			// 서브 메시 순서대로 저장된 메시렛 (SubMesh::firstMeshlet 기준)
+	std::vector<MeshLod> lods;				// 서브 메시 순서대로 저장된 LOD (SubMesh::firstLod 기준)
+};
+
+// 임포트 후처리 단계 (메시 캐시 키에 그대로 저장되므로 4 byte 필드만 사용)
+enum MeshProcessFlagBits : uint32_t {
+	MESH_PROCESS_WELD_VERTICES = 0x1,	// 중복 정점 병합
+	MESH_PROCESS_VERTEX_CACHE = 0x2,	// 정점 캐시 재사용을 위한 삼각형 재정렬 (Tipsify)
+	MESH_PROCESS_OVERDRAW = 0x4,		// overdraw 감소를 위한 삼각형 클러스터 정렬
+	MESH_PROCESS_VERTEX_FETCH = 0x8,	// 정점을 첫 사용 순서로 재배치
+	MESH_PROCESS_MESHLETS = 0x10,		// 컬링용 메시렛 생성 (서브 메시 인덱스를 메시렛 순서로 재배치)
+	MESH_PROCESS_LODS = 0x20,			// 단순화한 LOD 인덱스 구간 생성
+};
+
+// 임포트 후처리 설정
+struct MeshProcessOptions {
+	uint32_t flags = 0;					// MeshProcessFlagBits 조합
+	float weldEpsilon = 0.0f;			// 정점 병합 허용 오차 (0 이면 완전히 같은 정점만 병합)
+	float overdrawThreshold = 1.05f;	// overdraw 정렬 클러스터 분할 기준 (클수록 overdraw 감소, ACMR 증가)
+};
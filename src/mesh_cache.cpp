@@ -0,0 +1,250 @@
+#include "mesh_cache.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+const uint32_t MESH_CACHE_MAGIC = 0x4853454D; // "MESH"
+const uint64_t MESH_CACHE_ALIGNMENT = 16;
+
+// 캐시 파일에 저장되는 배열 종류
+enum MeshCacheSectionType {
+	MESH_CACHE_SECTION_VERTICES,
+	MESH_CACHE_SECTION_INDICES16,
+	MESH_CACHE_SECTION_INDICES32,
+	MESH_CACHE_SECTION_SUBMESHES,
+	MESH_CACHE_SECTION_MESHLETS,
+	MESH_CACHE_SECTION_LODS,
+	MESH_CACHE_SECTION_COUNT
+};
+
+// 섹션 1개의 위치와 원소 정보
+struct MeshCacheSection {
+	uint64_t offset;				// 파일 시작 기준 위치 (16 byte 정렬)
+	uint32_t count;					// 원소 개수
+	uint32_t stride;				// 원소 1개의 크기 (구조체 레이아웃이 바뀌면 무효화)
+};
+
+// 캐시 파일 맨 앞에 위치하는 헤더
+struct MeshCacheHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t importFlags;			// aiProcess_* 플래그
+	uint32_t sourcePathLength;		// 헤더 뒤에 오는 원본 경로 문자열 길이
+	uint64_t sourceSize;			// 원본 파일 크기
+	int64_t sourceModifiedTime;		// 원본 파일 수정 시간
+	uint64_t fileSize;				// 잘린 파일 검출용 전체 크기
+	MeshProcessOptions processOptions;	// 후처리 설정
+	MeshCacheSection sections[MESH_CACHE_SECTION_COUNT];
+};
+
+// 섹션별 원소 크기
+const uint32_t SECTION_STRIDES[MESH_CACHE_SECTION_COUNT] = {
+	sizeof(GpuVertex),
+	sizeof(uint16_t),
+	sizeof(uint32_t),
+	sizeof(SubMesh),
+	sizeof(Meshlet),
+	sizeof(MeshLod)
+};
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) {
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+MeshCacheKey makeMeshCacheKey(const std::string& sourcePath, uint32_t importFlags, const MeshProcessOptions& processOptions) {
+	std::error_code ec;
+	MeshCacheKey key;
+	key.sourcePath = sourcePath;
+	key.importFlags = importFlags;
+	key.processOptions = processOptions;
+	key.sourceSize = static_cast<uint64_t>(std::filesystem::file_size(sourcePath, ec));
+	if (ec) {
+		throw std::runtime_error("failed to stat model file!");
+	}
+	key.sourceModifiedTime = static_cast<int64_t>(std::filesystem::last_write_time(sourcePath, ec).time_since_epoch().count());
+	if (ec) {
+		throw std::runtime_error("failed to stat model file!");
+	}
+	return key;
+}
+
+MeshCacheKey makePackedMeshCacheKey(const std::string& sourcePath, uint32_t importFlags, const MeshProcessOptions& processOptions) {
+	MeshCacheKey key;
+	key.sourcePath = sourcePath;
+	key.importFlags = importFlags;
+	key.processOptions = processOptions;
+	return key;
+}
+
+std::string meshCachePath(const std::string& sourcePath) {
+	return sourcePath + ".meshcache";
+}
+
+bool MeshCache::open(const std::string& cachePath, const MeshCacheKey& key) {
+	close();
+
+	if (!file.open(cachePath)) {
+		return false;
+	}
+	if (!parse(file.data(), file.size(), key)) {
+		close();
+		return false;
+	}
+	return true;
+}
+
+bool MeshCache::open(const uint8_t* data, size_t size, const MeshCacheKey& key) {
+	close();
+
+	if (!parse(data, size, key)) {
+		close();
+		return false;
+	}
+	return true;
+}
+
+bool MeshCache::parse(const uint8_t* data, size_t size, const MeshCacheKey& key) {
+	// 헤더 검증 (형식, 버전, 원본 파일 정보가 하나라도 다르면 오래된 캐시)
+	MeshCacheHeader header;
+	if (size < sizeof(header)) {
+		return false;
+	}
+	memcpy(&header, data, sizeof(header));
+
+	bool valid = header.magic == MESH_CACHE_MAGIC
+		&& header.version == MESH_CACHE_VERSION
+		&& header.importFlags == key.importFlags
+		&& memcmp(&header.processOptions, &key.processOptions, sizeof(MeshProcessOptions)) == 0
+		&& header.sourceSize == key.sourceSize
+		&& header.sourceModifiedTime == key.sourceModifiedTime
+		&& header.fileSize == size
+		&& header.sourcePathLength == key.sourcePath.size()
+		&& sizeof(header) + header.sourcePathLength <= size
+		&& memcmp(data + sizeof(header), key.sourcePath.data(), key.sourcePath.size()) == 0;
+
+	// 섹션 검증 (원소 크기, 정렬, 데이터 범위)
+	for (uint32_t i = 0; valid && i < MESH_CACHE_SECTION_COUNT; i++) {
+		const MeshCacheSection& section = header.sections[i];
+		valid = section.stride == SECTION_STRIDES[i]
+			&& section.offset % MESH_CACHE_ALIGNMENT == 0
+			&& section.offset + uint64_t(section.count) * section.stride <= size;
+	}
+
+	if (!valid) {
+		return false;
+	}
+
+	// 매핑된 메모리를 그대로 배열로 사용
+	vertexData = reinterpret_cast<const GpuVertex*>(data + header.sections[MESH_CACHE_SECTION_VERTICES].offset);
+	index16Data = reinterpret_cast<const uint16_t*>(data + header.sections[MESH_CACHE_SECTION_INDICES16].offset);
+	index32Data = reinterpret_cast<const uint32_t*>(data + header.sections[MESH_CACHE_SECTION_INDICES32].offset);
+	subMeshData = reinterpret_cast<const SubMesh*>(data + header.sections[MESH_CACHE_SECTION_SUBMESHES].offset);
+	meshletData = reinterpret_cast<const Meshlet*>(data + header.sections[MESH_CACHE_SECTION_MESHLETS].offset);
+	lodData = reinterpret_cast<const MeshLod*>(data + header.sections[MESH_CACHE_SECTION_LODS].offset);
+	numVertices = header.sections[MESH_CACHE_SECTION_VERTICES].count;
+	numIndices16 = header.sections[MESH_CACHE_SECTION_INDICES16].count;
+	numIndices32 = header.sections[MESH_CACHE_SECTION_INDICES32].count;
+	numSubMeshes = header.sections[MESH_CACHE_SECTION_SUBMESHES].count;
+	numMeshlets = header.sections[MESH_CACHE_SECTION_MESHLETS].count;
+	numLods = header.sections[MESH_CACHE_SECTION_LODS].count;
+	return true;
+}
+
+void MeshCache::close() {
+	file.close();
+	vertexData = nullptr;
+	index16Data = nullptr;
+	index32Data = nullptr;
+	subMeshData = nullptr;
+	meshletData = nullptr;
+	lodData = nullptr;
+	numVertices = 0;
+	numIndices16 = 0;
+	numIndices32 = 0;
+	numSubMeshes = 0;
+	numMeshlets = 0;
+	numLods = 0;
+}
+
+bool MeshCache::write(const std::string& cachePath, const MeshCacheKey& key, const MeshData& meshData) {
+	std::vector<uint8_t> bytes;
+	serialize(key, meshData, bytes);
+
+	// 쓰는 도중 종료되어도 깨진 캐시가 남지 않도록 임시 파일에 먼저 기록
+	std::string tempPath = cachePath + ".tmp";
+	{
+		std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+		if (!out.is_open()) {
+			return false;
+		}
+		out.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+		if (!out.good()) {
+			return false;
+		}
+	}
+
+	std::error_code ec;
+	std::filesystem::rename(tempPath, cachePath, ec);
+	if (ec) {
+		std::filesystem::remove(tempPath, ec);
+		return false;
+	}
+	return true;
+}
+
+void MeshCache::serialize(const MeshCacheKey& key, const MeshData& meshData, std::vector<uint8_t>& bytes) {
+	// 섹션별 원본 데이터
+	const void* sectionData[MESH_CACHE_SECTION_COUNT] = {
+		meshData.gpuVertices.data(),
+		meshData.gpuIndices16.data(),
+		meshData.gpuIndices32.data(),
+		meshData.subMeshes.data(),
+		meshData.meshlets.data(),
+		meshData.lods.data()
+	};
+	const size_t sectionCounts[MESH_CACHE_SECTION_COUNT] = {
+		meshData.gpuVertices.size(),
+		meshData.gpuIndices16.size(),
+		meshData.gpuIndices32.size(),
+		meshData.subMeshes.size(),
+		meshData.meshlets.size(),
+		meshData.lods.size()
+	};
+
+	MeshCacheHeader header{};
+	header.magic = MESH_CACHE_MAGIC;
+	header.version = MESH_CACHE_VERSION;
+	header.importFlags = key.importFlags;
+	header.processOptions = key.processOptions;
+	header.sourcePathLength = static_cast<uint32_t>(key.sourcePath.size());
+	header.sourceSize = key.sourceSize;
+	header.sourceModifiedTime = key.sourceModifiedTime;
+
+	// 섹션 배치 (헤더 + 경로 문자열 뒤에 16 byte 정렬로 차례대로 배치)
+	uint64_t offset = sizeof(header) + header.sourcePathLength;
+	for (uint32_t i = 0; i < MESH_CACHE_SECTION_COUNT; i++) {
+		offset = alignUp(offset, MESH_CACHE_ALIGNMENT);
+		header.sections[i].offset = offset;
+		header.sections[i].count = static_cast<uint32_t>(sectionCounts[i]);
+		header.sections[i].stride = SECTION_STRIDES[i];
+		offset += uint64_t(sectionCounts[i]) * SECTION_STRIDES[i];
+	}
+	header.fileSize = offset;
+
+	// 헤더 + 경로 문자열 + 섹션 데이터 (정렬 패딩은 0)
+	bytes.assign(header.fileSize, 0);
+	memcpy(bytes.data(), &header, sizeof(header));
+	memcpy(bytes.data() + sizeof(header), key.sourcePath.data(), key.sourcePath.size());
+	for (uint32_t i = 0; i < MESH_CACHE_SECTION_COUNT; i++) {
+		size_t sectionSize = sectionCounts[i] * SECTION_STRIDES[i];
+		if (sectionSize > 0) {
+			memcpy(bytes.data() + header.sections[i].offset, sectionData[i], sectionSize);
+		}
+	}
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "mapped_file.h"
+#include "mesh.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+	[바이너리 메시 캐시]
+	Assimp로 파싱한 최종 GpuVertex / 16bit, 32bit index / 서브 메시 / 메시렛 배열을 GPU 업로드 레이아웃 그대로 파일에 저장한다.
+	다음 실행부터는 파일을 메모리 매핑만 하면 되므로 .obj 텍스트 파싱을 건너뛸 수 있다.
+
+	파일 구성
+	1. MeshCacheHeader (버전, 원본 파일 정보, 섹션 테이블)
+	2. 원본 파일 경로 문자열
+	3. 섹션 데이터 (GpuVertex 배열, 16bit / 32bit index 배열, SubMesh 배열, Meshlet 배열, MeshLod 배열 / 각각 16 byte 정렬)
+*/
+
+// 캐시 형식이 바뀌면 올려서 이전 캐시를 자동으로 무효화
+const uint32_t MESH_CACHE_VERSION = 8;
+
+// 캐시 유효성 판단에 쓰는 키 (원본 경로, 크기, 수정 시간, 임포트 플래그, 후처리 설정)
+struct MeshCacheKey {
+	std::string sourcePath;
+	uint64_t sourceSize = 0;
+	int64_t sourceModifiedTime = 0;
+	uint32_t importFlags = 0;
+	MeshProcessOptions processOptions;
+};
+
+// 원본 파일의 현재 상태로 캐시 키 생성 (원본 파일이 없으면 예외 발생)
+MeshCacheKey makeMeshCacheKey(const std::string& sourcePath, uint32_t importFlags, const MeshProcessOptions& processOptions);
+
+// 에셋 팩에 넣는 캐시 키 (원본 파일 크기 / 수정 시간 제외, 팩은 빌드에서 원본이 바뀔 때 다시 생성)
+MeshCacheKey makePackedMeshCacheKey(const std::string& sourcePath, uint32_t importFlags, const MeshProcessOptions& processOptions);
+
+// 원본 경로에 대응하는 캐시 파일 경로
+std::string meshCachePath(const std::string& sourcePath);
+
+class MeshCache {
+public:
+	// 캐시 파일을 매핑하고 키가 일치하는지 확인 (없거나 오래된 캐시면 false)
+	bool open(const std::string& cachePath, const MeshCacheKey& key);
+	// 이미 매핑된 메모리 (에셋 팩 등) 의 캐시 데이터 사용 (data 는 close 전까지 유효해야 함, 16 byte 정렬)
+	bool open(const uint8_t* data, size_t size, const MeshCacheKey& key);
+	// 매핑 해제
+	void close();
+
+	// 임시 파일에 쓴 뒤 교체하여 캐시 파일 생성 (실패시 false)
+	static bool write(const std::string& cachePath, const MeshCacheKey& key, const MeshData& meshData);
+	// 캐시 파일 내용을 메모리로 직렬화
+	static void serialize(const MeshCacheKey& key, const MeshData& meshData, std::vector<uint8_t>& bytes);
+
+	bool isOpen() const { return file.isOpen(); }
+	const GpuVertex* vertices() const { return vertexData; }
+	uint32_t vertexCount() const { return numVertices; }
+	const uint16_t* indices16() const { return index16Data; }
+	uint32_t index16Count() const { return numIndices16; }
+	const uint32_t* indices32() const { return index32Data; }
+	uint32_t index32Count() const { return numIndices32; }
+	const SubMesh* subMeshes() const { return subMeshData; }
+	uint32_t subMeshCount() const { return numSubMeshes; }
+	const Meshlet* meshlets() const { return meshletData; }
+	uint32_t meshletCount() const { return numMeshlets; }
+	const MeshLod* lods() const { return lodData; }
+	uint32_t lodCount() const { return numLods; }
+
+private:
+	// 헤더 / 섹션 검증 후 배열 위치 설정
+	bool parse(const uint8_t* data, size_t size, const MeshCacheKey& key);
+
+	MappedFile file;
+	const GpuVertex* vertexData = nullptr;
+	const uint16_t* index16Data = nullptr;
+	const uint32_t* index32Data = nullptr;
+	const SubMesh* subMeshData = nullptr;
+	const Meshlet* meshletData = nullptr;
+	const MeshLod* lodData = nullptr;
+	uint32_t numVertices = 0;
+	uint32_t numIndices16 = 0;
+	uint32_t numIndices32 = 0;
+	uint32_t numSubMeshes = 0;
+	uint32_t numMeshlets = 0;
+	uint32_t numLods = 0;
+};
@@ -0,0 +1,143 @@
+#include "mesh_index.h"
+
+#include <vector>
+
+namespace {
+
+const uint32_t NOT_IN_CHUNK = UINT32_MAX;
+
+// 16bit 청크 (삼각형 구간 + 청크 안에서 사용하는 원본 정점 목록)
+struct IndexChunk {
+	uint32_t firstIndex;				// 원본 서브 메시 기준 첫 인덱스
+	uint32_t indexCount;
+	std::vector<uint32_t> vertices;		// 청크 정점 번호 → 원본 정점 번호 (청크 안 첫 사용 순서)
+	std::vector<uint16_t> indices;		// 청크 정점 번호 기준 인덱스
+};
+
+/*
+	삼각형 순서대로 청크에 넣다가 고유 정점 수가 MAX_INDEX16_VERTICES 를 넘으면 새 청크 시작
+	청크 경계에 걸친 정점은 양쪽 청크에 복사된다.
+*/
+void splitIndex16Chunks(const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount, std::vector<IndexChunk>& chunks) {
+	chunks.clear();
+	std::vector<uint32_t> chunkVertex(vertexCount, NOT_IN_CHUNK);	// 원본 정점 → 현재 청크 정점 번호
+	std::vector<uint32_t> chunkId(vertexCount, NOT_IN_CHUNK);		// chunkVertex 가 유효한 청크 번호
+
+	for (uint32_t i = 0; i + 2 < indexCount; i += 3) {
+		uint32_t currentChunk = static_cast<uint32_t>(chunks.size()) - 1;
+
+		// 이 삼각형이 새로 추가하는 정점 수
+		uint32_t newVertices = 0;
+		for (uint32_t k = 0; k < 3; k++) {
+			uint32_t v = indices[i + k];
+			bool duplicated = (k > 0 && indices[i + k] == indices[i]) || (k > 1 && indices[i + k] == indices[i + 1]);
+			if ((chunks.empty() || chunkId[v] != currentChunk) && !duplicated) {
+				newVertices++;
+			}
+		}
+
+		if (chunks.empty() || chunks.back().vertices.size() + newVertices > MAX_INDEX16_VERTICES) {
+			chunks.push_back({i, 0, {}, {}});
+			currentChunk = static_cast<uint32_t>(chunks.size()) - 1;
+		}
+
+		IndexChunk& chunk = chunks.back();
+		for (uint32_t k = 0; k < 3; k++) {
+			uint32_t v = indices[i + k];
+			if (chunkId[v] != currentChunk) {
+				chunkId[v] = currentChunk;
+				chunkVertex[v] = static_cast<uint32_t>(chunk.vertices.size());
+				chunk.vertices.push_back(v);
+			}
+			chunk.indices.push_back(static_cast<uint16_t>(chunkVertex[v]));
+		}
+		chunk.indexCount += 3;
+	}
+}
+
+} // namespace
+
+MeshIndexStats encodeGpuIndices(MeshData& meshData) {
+	MeshIndexStats stats;
+	stats.subMeshCountBefore = static_cast<uint32_t>(meshData.subMeshes.size());
+
+	std::vector<SubMesh> index16SubMeshes;
+	std::vector<SubMesh> index32SubMeshes;
+	std::vector<Vertex> vertices;
+	std::vector<GpuVertex> gpuVertices;
+	std::vector<IndexChunk> chunks;
+	vertices.reserve(meshData.vertices.size());
+	gpuVertices.reserve(meshData.gpuVertices.size());
+	meshData.gpuIndices16.clear();
+	meshData.gpuIndices32.clear();
+
+	// 서브 메시 정점 구간을 새 정점 배열 끝에 복사하고 새 baseVertex 반환
+	auto copyVertices = [&](uint32_t baseVertex, uint32_t vertexCount) {
+		uint32_t newBaseVertex = static_cast<uint32_t>(gpuVertices.size());
+		vertices.insert(vertices.end(), meshData.vertices.begin() + baseVertex, meshData.vertices.begin() + baseVertex + vertexCount);
+		gpuVertices.insert(gpuVertices.end(), meshData.gpuVertices.begin() + baseVertex, meshData.gpuVertices.begin() + baseVertex + vertexCount);
+		return newBaseVertex;
+	};
+
+	for (const SubMesh& subMesh : meshData.subMeshes) {
+		const uint32_t* indices = meshData.indices.data() + subMesh.firstIndex;
+
+		// 1. 정점 수가 적으면 그대로 16bit
+		if (subMesh.vertexCount <= MAX_INDEX16_VERTICES) {
+			SubMesh result = subMesh;
+			result.baseVertex = copyVertices(subMesh.baseVertex, subMesh.vertexCount);
+			result.firstIndex = static_cast<uint32_t>(meshData.gpuIndices16.size());
+			result.indexType = VK_INDEX_TYPE_UINT16;
+			meshData.gpuIndices16.insert(meshData.gpuIndices16.end(), indices, indices + subMesh.indexCount);
+			index16SubMeshes.push_back(result);
+			continue;
+		}
+
+		// 2. 16bit 청크로 분할 (줄어드는 인덱스 크기가 복사되는 경계 정점 크기보다 클 때만)
+		splitIndex16Chunks(indices, subMesh.indexCount, subMesh.vertexCount, chunks);
+		size_t chunkVertexCount = 0;
+		for (const IndexChunk& chunk : chunks) {
+			chunkVertexCount += chunk.vertices.size();
+		}
+		size_t duplicatedVertices = chunkVertexCount > subMesh.vertexCount ? chunkVertexCount - subMesh.vertexCount : 0;
+		size_t savedIndexBytes = size_t(subMesh.indexCount) * (sizeof(uint32_t) - sizeof(uint16_t));
+		if (savedIndexBytes > duplicatedVertices * sizeof(GpuVertex)) {
+			for (const IndexChunk& chunk : chunks) {
+				SubMesh result = subMesh;
+				result.baseVertex = static_cast<uint32_t>(gpuVertices.size());
+				result.vertexCount = static_cast<uint32_t>(chunk.vertices.size());
+				result.firstIndex = static_cast<uint32_t>(meshData.gpuIndices16.size());
+				result.indexCount = chunk.indexCount;
+				result.indexType = VK_INDEX_TYPE_UINT16;
+				for (uint32_t v : chunk.vertices) {
+					vertices.push_back(meshData.vertices[subMesh.baseVertex + v]);
+					gpuVertices.push_back(meshData.gpuVertices[subMesh.baseVertex + v]);
+				}
+				meshData.gpuIndices16.insert(meshData.gpuIndices16.end(), chunk.indices.begin(), chunk.indices.end());
+				index16SubMeshes.push_back(result);
+			}
+			stats.splitSubMeshCount++;
+			stats.duplicatedVertexCount += static_cast<uint32_t>(duplicatedVertices);
+			continue;
+		}
+
+		// 3. 32bit 유지
+		SubMesh result = subMesh;
+		result.baseVertex = copyVertices(subMesh.baseVertex, subMesh.vertexCount);
+		result.firstIndex = static_cast<uint32_t>(meshData.gpuIndices32.size());
+		result.indexType = VK_INDEX_TYPE_UINT32;
+		meshData.gpuIndices32.insert(meshData.gpuIndices32.end(), indices, indices + subMesh.indexCount);
+		index32SubMeshes.push_back(result);
+	}
+
+	stats.index16SubMeshCount = static_cast<uint32_t>(index16SubMeshes.size());
+	stats.index32SubMeshCount = static_cast<uint32_t>(index32SubMeshes.size());
+
+	// 16bit 서브 메시 → 32bit 서브 메시 순서
+	meshData.subMeshes = std::move(index16SubMeshes);
+	meshData.subMeshes.insert(meshData.subMeshes.end(), index32SubMeshes.begin(), index32SubMeshes.end());
+	meshData.vertices.swap(vertices);
+	meshData.gpuVertices.swap(gpuVertices);
+	std::vector<uint32_t>().swap(meshData.indices);
+	return stats;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "mesh.h"
+
+/*
+	[인덱스 인코딩]
+	서브 메시마다 인덱스 폭(16 / 32bit)을 골라 업로드용 인덱스 배열로 변환한다.
+	1. 정점 수가 65536 이하인 서브 메시는 16bit
+	2. 더 큰 서브 메시는 삼각형 순서대로 고유 정점이 65536 개 이하인 청크로 나눠 16bit 로 만든다.
+	   청크마다 사용하는 정점을 따로 복사하므로 청크 경계의 정점은 중복된다.
+	   줄어드는 인덱스 크기가 중복 정점 크기보다 작으면 32bit 로 유지
+	3. 서브 메시를 16bit → 32bit 순서로 정렬 (인덱스 버퍼 바인딩을 최대 2번으로)
+	인코딩 후 SubMesh::firstIndex 는 indexType 별 배열 기준이 되고 meshData.indices 는 비워진다.
+	정점 배열(vertices / gpuVertices)은 새 서브 메시 순서대로 다시 채워지며, 청크는 원본의 복원 변환을 그대로 공유한다.
+*/
+
+// 인덱스 인코딩 결과
+struct MeshIndexStats {
+	uint32_t subMeshCountBefore = 0;
+	uint32_t index16SubMeshCount = 0;	// 16bit 서브 메시 수 (분할된 청크 포함)
+	uint32_t index32SubMeshCount = 0;	// 32bit 서브 메시 수
+	uint32_t splitSubMeshCount = 0;		// 16bit 청크로 나눈 원본 서브 메시 수
+	uint32_t duplicatedVertexCount = 0;	// 청크 경계에서 복사된 정점 수
+};
+
+// 16bit 인덱스로 표현 가능한 최대 정점 수
+const uint32_t MAX_INDEX16_VERTICES = 65536;
+
+// meshData.indices → gpuIndices16 / gpuIndices32 변환
+MeshIndexStats encodeGpuIndices(MeshData& meshData);
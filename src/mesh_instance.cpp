@@ -0,0 +1,50 @@
+#include "mesh_instance.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cmath>
+
+namespace {
+
+// 격자 한 변의 인스턴스 수
+uint32_t gridSide(uint32_t count) {
+	uint32_t side = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+	return side > 0 ? side : 1;
+}
+
+} // namespace
+
+void makeInstanceGrid(uint32_t count, float spacing, uint32_t materialCount, std::vector<GpuInstance>& instances) {
+	instances.resize(count);
+	uint32_t side = gridSide(count);
+	float origin = -0.5f * spacing * static_cast<float>(side - 1);
+	for (uint32_t i = 0; i < count; i++) {
+		glm::vec3 position(origin + spacing * static_cast<float>(i % side), origin + spacing * static_cast<float>(i / side), 0.0f);
+		GpuInstance& instance = instances[i];
+		instance.model = glm::translate(glm::mat4(1.0f), position);
+		instance.materialIndex = materialCount > 0 ? i % materialCount : 0;
+		instance.padding[0] = instance.padding[1] = instance.padding[2] = 0;
+	}
+}
+
+float instanceGridRadius(uint32_t count, float spacing) {
+	float halfExtent = 0.5f * spacing * static_cast<float>(gridSide(count) - 1);
+	return halfExtent * std::sqrt(2.0f);
+}
+
+void writeInstances(const GpuInstance* instances, uint32_t count, const glm::mat4& transform, GpuInstance* dst) {
+	for (uint32_t i = 0; i < count; i++) {
+		dst[i].model = instances[i].model * transform;
+		dst[i].materialIndex = instances[i].materialIndex;
+		dst[i].padding[0] = dst[i].padding[1] = dst[i].padding[2] = 0;
+	}
+}
+
+void writeInstances(const GpuInstance* instances, const uint32_t* indices, uint32_t count, const glm::mat4& transform, GpuInstance* dst) {
+	for (uint32_t i = 0; i < count; i++) {
+		const GpuInstance& instance = instances[indices[i]];
+		dst[i].model = instance.model * transform;
+		dst[i].materialIndex = instance.materialIndex;
+		dst[i].padding[0] = dst[i].padding[1] = dst[i].padding[2] = 0;
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+/*
+	[메시 인스턴스]
+	같은 메시를 여러 번 그릴 때 인스턴스마다의 변환 / 머티리얼 번호를 storage buffer 에 모아두고
+	서브 메시마다 draw 1 번 (instanceCount) 으로 그린다. 정점 셰이더는 gl_InstanceIndex 로 인스턴스 데이터를 읽음
+	1. 인스턴스 배치는 CPU 배열에 두고 매 프레임 프레임별 링 영역에 공통 변환을 곱해서 기록 (writeInstances)
+	2. 머티리얼 번호는 셰이더의 인스턴스 데이터에 같이 올림 (머티리얼 테이블이 생기면 사용)
+*/
+
+// 셰이더 InstanceData (std430: mat4 + uvec4) 와 같은 배치
+struct GpuInstance {
+	glm::mat4 model;
+	uint32_t materialIndex;
+	uint32_t padding[3];
+};
+
+static_assert(sizeof(GpuInstance) == 80, "GpuInstance must match the std430 InstanceData layout");
+
+// count 개 인스턴스를 xy 평면 정사각 격자에 spacing 간격으로 배치 (격자 중심이 원점, 머티리얼 번호는 materialCount 로 순환)
+void makeInstanceGrid(uint32_t count, float spacing, uint32_t materialCount, std::vector<GpuInstance>& instances);
+
+// makeInstanceGrid 배치를 모두 덮는 원점 기준 반지름 (인스턴스 1 개면 0)
+float instanceGridRadius(uint32_t count, float spacing);
+
+// instances 의 model 에 transform 을 곱해서 dst 에 기록 (dst 는 매핑된 링 영역, 순서대로 한 번만 씀)
+void writeInstances(const GpuInstance* instances, uint32_t count, const glm::mat4& transform, GpuInstance* dst);
+// indices 가 가리키는 인스턴스만 같은 방식으로 dst 앞에서부터 빽빽하게 기록 (CPU 컬링 결과 기록용)
+void writeInstances(const GpuInstance* instances, const uint32_t* indices, uint32_t count, const glm::mat4& transform, GpuInstance* dst);
@@ -0,0 +1,646 @@
+#include "mesh_lod.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+const uint32_t NO_VERTEX = UINT32_MAX;
+
+// 열린 경계 / seam 모서리 보존 가중치 (클수록 외곽선이 덜 무너짐)
+const double BORDER_WEIGHT = 10.0;
+
+// 단순화 후 이전 LOD 의 이 비율보다 많이 남으면 더 줄일 수 없는 것으로 보고 체인 중단
+const float LOD_STALL_RATIO = 0.85f;
+
+// 이보다 적은 삼각형으로는 줄이지 않음
+const uint32_t MIN_LOD_TRIANGLES = 8;
+
+// 정점 종류 (합칠 수 있는 방향 결정)
+enum VertexKind : uint8_t {
+	VERTEX_MANIFOLD,	// 내부 정점 (인접한 어느 정점으로든 합칠 수 있음)
+	VERTEX_BORDER,		// 열린 경계 정점 (경계 모서리를 따라서만)
+	VERTEX_SEAM,		// 같은 위치에 정점이 2 개인 texCoord seam (짝 정점과 함께 seam 모서리를 따라서만)
+	VERTEX_LOCKED		// 3 개 이상의 정점이 겹치는 위치 (합치지 않음)
+};
+
+/*
+	[Quadric]
+	평면까지 거리 제곱의 합을 대칭 행렬로 누적 (Garland / Heckbert)
+	error(p) = pᵀAp + 2bᵀp + c 를 weight 로 나눠 평균 거리 제곱으로 사용
+*/
+struct Quadric {
+	double a00 = 0.0, a01 = 0.0, a02 = 0.0, a11 = 0.0, a12 = 0.0, a22 = 0.0;
+	double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+	double c = 0.0;
+	double weight = 0.0;
+
+	// 평면 (normal · p + distance = 0) 추가
+	void addPlane(const glm::vec3& normal, float distance, double w) {
+		double nx = normal.x;
+		double ny = normal.y;
+		double nz = normal.z;
+		a00 += w * nx * nx;
+		a01 += w * nx * ny;
+		a02 += w * nx * nz;
+		a11 += w * ny * ny;
+		a12 += w * ny * nz;
+		a22 += w * nz * nz;
+		b0 += w * nx * distance;
+		b1 += w * ny * distance;
+		b2 += w * nz * distance;
+		c += w * distance * distance;
+		weight += w;
+	}
+
+	void add(const Quadric& other) {
+		a00 += other.a00;
+		a01 += other.a01;
+		a02 += other.a02;
+		a11 += other.a11;
+		a12 += other.a12;
+		a22 += other.a22;
+		b0 += other.b0;
+		b1 += other.b1;
+		b2 += other.b2;
+		c += other.c;
+		weight += other.weight;
+	}
+
+	// p 로 옮겼을 때 평균 거리 제곱
+	double error(const glm::vec3& p) const {
+		double x = p.x;
+		double y = p.y;
+		double z = p.z;
+		double result = a00 * x * x + a11 * y * y + a22 * z * z
+			+ 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z)
+			+ 2.0 * (b0 * x + b1 * y + b2 * z) + c;
+		return weight > 0.0 ? std::max(result, 0.0) / weight : 0.0;
+	}
+};
+
+// 모서리 합치기 후보 (u → v, seam 이면 짝 정점 u2 → v2 도 함께)
+struct Collapse {
+	uint32_t u;
+	uint32_t v;
+	uint32_t u2;
+	uint32_t v2;
+	double error;
+};
+
+uint64_t edgeKey(uint32_t a, uint32_t b) {
+	return (uint64_t(a) << 32) | b;
+}
+
+/*
+	[메시 단순화]
+	정점 종류와 quadric 은 LOD 0 에서 한 번 계산하고 LOD 체인 전체에서 누적해서 사용한다. (오차가 원본 기준으로 유지됨)
+	한 번의 pass 에서 오차가 작은 순서로 서로 겹치지 않는 collapse 를 모아 적용하고, 목표 인덱스 수에 도달할 때까지 반복
+*/
+class MeshSimplifier {
+public:
+	MeshSimplifier(const Vertex* vertices, uint32_t vertexCount, const std::vector<uint32_t>& indices)
+		: vertices(vertices), vertexCount(vertexCount) {
+		buildPositions();
+		buildTopology(indices);
+
+		// 정점 종류 (열린 모서리를 가진 정점은 경계 또는 seam)
+		std::vector<bool> open(vertexCount, false);
+		for (size_t i = 0; i < indices.size(); i += 3) {
+			for (uint32_t k = 0; k < 3; k++) {
+				uint32_t a = indices[i + k];
+				uint32_t b = indices[i + (k + 1) % 3];
+				if (isOpen(a, b)) {
+					open[a] = true;
+					open[b] = true;
+				}
+			}
+		}
+		kinds.resize(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; v++) {
+			uint32_t sharedCount = positionOffsets[positionId[v] + 1] - positionOffsets[positionId[v]];
+			if (sharedCount > 2 || (sharedCount == 2 && !open[v])) {
+				kinds[v] = VERTEX_LOCKED;
+			} else if (sharedCount == 2) {
+				kinds[v] = VERTEX_SEAM;
+			} else {
+				kinds[v] = open[v] ? VERTEX_BORDER : VERTEX_MANIFOLD;
+			}
+		}
+
+		// 삼각형 평면 (면적 가중) + 열린 모서리에 수직인 평면 (경계 보존)
+		quadrics.resize(vertexCount);
+		for (size_t i = 0; i < indices.size(); i += 3) {
+			const glm::vec3& p0 = vertices[indices[i + 0]].pos;
+			const glm::vec3& p1 = vertices[indices[i + 1]].pos;
+			const glm::vec3& p2 = vertices[indices[i + 2]].pos;
+			glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+			float length = glm::length(normal);
+			if (length <= 0.0f) {
+				continue;
+			}
+			normal /= length;
+			double area = length * 0.5;
+			for (uint32_t k = 0; k < 3; k++) {
+				quadrics[indices[i + k]].addPlane(normal, -glm::dot(normal, p0), area);
+			}
+
+			for (uint32_t k = 0; k < 3; k++) {
+				uint32_t a = indices[i + k];
+				uint32_t b = indices[i + (k + 1) % 3];
+				if (!isOpen(a, b)) {
+					continue;
+				}
+				glm::vec3 edge = vertices[b].pos - vertices[a].pos;
+				float edgeLength = glm::length(edge);
+				if (edgeLength <= 0.0f) {
+					continue;
+				}
+				glm::vec3 edgeNormal = glm::normalize(glm::cross(edge, normal));
+				double w = double(edgeLength) * edgeLength * BORDER_WEIGHT;
+				quadrics[a].addPlane(edgeNormal, -glm::dot(edgeNormal, vertices[a].pos), w);
+				quadrics[b].addPlane(edgeNormal, -glm::dot(edgeNormal, vertices[b].pos), w);
+			}
+		}
+	}
+
+	// indices 를 targetIndexCount 이하로 줄임 (오차가 maxError 를 넘는 collapse 는 하지 않음), 적용한 최대 오차 반환
+	float simplify(std::vector<uint32_t>& indices, size_t targetIndexCount, float maxError) {
+		double maxErrorSquared = double(maxError) * maxError;
+		double resultError = 0.0;
+		std::vector<Collapse> collapses;
+		std::vector<bool> touched(vertexCount);
+		std::vector<uint32_t> remap(vertexCount);
+
+		while (indices.size() > targetIndexCount) {
+			buildTopology(indices);
+			collectCollapses(indices, collapses);
+			std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.error < b.error; });
+
+			// 오차가 작은 순서로 서로 겹치지 않는 collapse 적용 (한 pass 에서 정점은 한 번만 움직임)
+			std::iota(remap.begin(), remap.end(), 0);
+			std::fill(touched.begin(), touched.end(), false);
+			size_t removeTarget = (indices.size() - targetIndexCount) / 3;
+			size_t removed = 0;
+			uint32_t applied = 0;
+			for (const Collapse& collapse : collapses) {
+				if (collapse.error > maxErrorSquared) {
+					break;
+				}
+				bool seam = collapse.u2 != NO_VERTEX;
+				if (touched[collapse.u] || touched[collapse.v] || (seam && (touched[collapse.u2] || touched[collapse.v2]))) {
+					continue;
+				}
+				if (hasFlip(indices, collapse.u, collapse.v) || (seam && hasFlip(indices, collapse.u2, collapse.v2))) {
+					continue;
+				}
+
+				applyCollapse(collapse.u, collapse.v, remap, touched);
+				removed += sharedTriangleCount(indices, collapse.u, collapse.v);
+				if (seam) {
+					applyCollapse(collapse.u2, collapse.v2, remap, touched);
+					removed += sharedTriangleCount(indices, collapse.u2, collapse.v2);
+				}
+				resultError = std::max(resultError, collapse.error);
+				applied++;
+				if (removed >= removeTarget) {
+					break;
+				}
+			}
+			if (applied == 0) {
+				break;
+			}
+
+			// 인덱스 갱신 후 면적이 없어진 삼각형 제거
+			size_t write = 0;
+			for (size_t i = 0; i < indices.size(); i += 3) {
+				uint32_t a = remap[indices[i + 0]];
+				uint32_t b = remap[indices[i + 1]];
+				uint32_t c = remap[indices[i + 2]];
+				if (a != b && b != c && a != c) {
+					indices[write++] = a;
+					indices[write++] = b;
+					indices[write++] = c;
+				}
+			}
+			indices.resize(write);
+		}
+		return static_cast<float>(std::sqrt(resultError));
+	}
+
+private:
+	const Vertex* vertices;
+	uint32_t vertexCount;
+	std::vector<uint32_t> positionId;			// 정점 → 위치 번호 (pos 가 같은 정점은 같은 번호)
+	std::vector<uint32_t> positionOffsets;		// 위치별 정점 목록 (CSR 형식)
+	std::vector<uint32_t> positionVertices;
+	std::vector<VertexKind> kinds;
+	std::vector<Quadric> quadrics;
+	std::unordered_set<uint64_t> edges;			// 현재 인덱스의 방향 있는 모서리
+	std::vector<uint32_t> adjacencyOffsets;		// 정점별 인접 삼각형 목록 (CSR 형식, 현재 인덱스 기준)
+	std::vector<uint32_t> adjacency;
+
+	// pos 가 같은 정점끼리 위치 번호 부여
+	void buildPositions() {
+		std::vector<uint32_t> sortedVertices(vertexCount);
+		std::iota(sortedVertices.begin(), sortedVertices.end(), 0);
+		std::sort(sortedVertices.begin(), sortedVertices.end(), [this](uint32_t a, uint32_t b) {
+			const glm::vec3& pa = vertices[a].pos;
+			const glm::vec3& pb = vertices[b].pos;
+			return pa.x < pb.x || (pa.x == pb.x && (pa.y < pb.y || (pa.y == pb.y && pa.z < pb.z)));
+		});
+
+		positionId.resize(vertexCount);
+		positionOffsets.assign(1, 0);
+		for (uint32_t i = 0; i < vertexCount; i++) {
+			if (i > 0 && vertices[sortedVertices[i]].pos != vertices[sortedVertices[i - 1]].pos) {
+				positionOffsets.push_back(i);
+			}
+			positionId[sortedVertices[i]] = static_cast<uint32_t>(positionOffsets.size()) - 1;
+		}
+		positionOffsets.push_back(vertexCount);
+		positionVertices = std::move(sortedVertices);
+	}
+
+	// 현재 인덱스의 모서리 집합과 정점별 인접 삼각형 목록
+	void buildTopology(const std::vector<uint32_t>& indices) {
+		edges.clear();
+		edges.reserve(indices.size());
+		adjacencyOffsets.assign(vertexCount + 1, 0);
+		for (size_t i = 0; i < indices.size(); i += 3) {
+			for (uint32_t k = 0; k < 3; k++) {
+				edges.insert(edgeKey(indices[i + k], indices[i + (k + 1) % 3]));
+				adjacencyOffsets[indices[i + k] + 1]++;
+			}
+		}
+		for (uint32_t v = 0; v < vertexCount; v++) {
+			adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+		}
+		adjacency.resize(indices.size());
+		std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+		for (size_t i = 0; i < indices.size(); i++) {
+			adjacency[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+		}
+	}
+
+	bool hasEdge(uint32_t a, uint32_t b) const {
+		return edges.count(edgeKey(a, b)) > 0;
+	}
+
+	// 한쪽 방향 삼각형만 있는 모서리 (열린 경계 또는 seam)
+	bool isOpen(uint32_t a, uint32_t b) const {
+		return hasEdge(a, b) != hasEdge(b, a);
+	}
+
+	// seam 정점의 같은 위치 짝 정점
+	uint32_t seamTwin(uint32_t v) const {
+		uint32_t first = positionOffsets[positionId[v]];
+		return positionVertices[first] == v ? positionVertices[first + 1] : positionVertices[first];
+	}
+
+	// u → v 가 가능한지 확인하고 seam 이면 짝 collapse (u2 → v2) 계산
+	bool canCollapse(uint32_t u, uint32_t v, uint32_t& u2, uint32_t& v2) const {
+		u2 = NO_VERTEX;
+		v2 = NO_VERTEX;
+		if (positionId[u] == positionId[v]) {
+			return false;
+		}
+
+		switch (kinds[u]) {
+		case VERTEX_MANIFOLD:
+			return true;
+		case VERTEX_BORDER:
+			return isOpen(u, v);
+		case VERTEX_SEAM:
+			if (!isOpen(u, v) || kinds[v] == VERTEX_MANIFOLD || kinds[v] == VERTEX_BORDER) {
+				return false;
+			}
+			// 짝 정점도 v 위치의 다른 정점으로 seam 모서리를 따라 이동해야 함
+			u2 = seamTwin(u);
+			for (uint32_t i = positionOffsets[positionId[v]]; i < positionOffsets[positionId[v] + 1]; i++) {
+				uint32_t candidate = positionVertices[i];
+				if (candidate != v && isOpen(u2, candidate)) {
+					v2 = candidate;
+					return true;
+				}
+			}
+			return false;
+		default:
+			return false;
+		}
+	}
+
+	// 모든 모서리에서 오차가 작은 방향의 collapse 후보 수집
+	void collectCollapses(const std::vector<uint32_t>& indices, std::vector<Collapse>& collapses) const {
+		collapses.clear();
+		for (size_t i = 0; i < indices.size(); i += 3) {
+			for (uint32_t k = 0; k < 3; k++) {
+				uint32_t a = indices[i + k];
+				uint32_t b = indices[i + (k + 1) % 3];
+				// 양쪽 삼각형이 있는 모서리는 한 번만
+				if (a > b && hasEdge(b, a)) {
+					continue;
+				}
+
+				Collapse best{NO_VERTEX, NO_VERTEX, NO_VERTEX, NO_VERTEX, std::numeric_limits<double>::max()};
+				for (uint32_t direction = 0; direction < 2; direction++) {
+					uint32_t u = direction == 0 ? a : b;
+					uint32_t v = direction == 0 ? b : a;
+					uint32_t u2;
+					uint32_t v2;
+					if (!canCollapse(u, v, u2, v2)) {
+						continue;
+					}
+					Quadric quadric = quadrics[u];
+					if (u2 != NO_VERTEX) {
+						quadric.add(quadrics[u2]);
+					}
+					double error = quadric.error(vertices[v].pos);
+					if (error < best.error) {
+						best = {u, v, u2, v2, error};
+					}
+				}
+				if (best.u != NO_VERTEX) {
+					collapses.push_back(best);
+				}
+			}
+		}
+	}
+
+	// u 를 v 위치로 옮겼을 때 뒤집히는 삼각형이 있는지 (v 를 포함한 삼각형은 없어지므로 제외)
+	bool hasFlip(const std::vector<uint32_t>& indices, uint32_t u, uint32_t v) const {
+		for (uint32_t a = adjacencyOffsets[u]; a < adjacencyOffsets[u + 1]; a++) {
+			const uint32_t* triangle = indices.data() + adjacency[a] * 3;
+			if (triangle[0] == v || triangle[1] == v || triangle[2] == v) {
+				continue;
+			}
+
+			glm::vec3 before[3];
+			glm::vec3 after[3];
+			for (uint32_t k = 0; k < 3; k++) {
+				before[k] = vertices[triangle[k]].pos;
+				after[k] = triangle[k] == u ? vertices[v].pos : before[k];
+			}
+			glm::vec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+			glm::vec3 normalAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+			if (glm::dot(normalBefore, normalAfter) <= 0.0f) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// u 와 v 를 모두 포함하는 (collapse 로 없어지는) 삼각형 수
+	uint32_t sharedTriangleCount(const std::vector<uint32_t>& indices, uint32_t u, uint32_t v) const {
+		uint32_t count = 0;
+		for (uint32_t a = adjacencyOffsets[u]; a < adjacencyOffsets[u + 1]; a++) {
+			const uint32_t* triangle = indices.data() + adjacency[a] * 3;
+			if (triangle[0] == v || triangle[1] == v || triangle[2] == v) {
+				count++;
+			}
+		}
+		return count;
+	}
+
+	void applyCollapse(uint32_t u, uint32_t v, std::vector<uint32_t>& remap, std::vector<bool>& touched) {
+		remap[u] = v;
+		quadrics[v].add(quadrics[u]);
+		touched[u] = true;
+		touched[v] = true;
+	}
+};
+
+// 서브 메시 1 개의 LOD 체인 (LOD 1 부터, 단계별 인덱스 + 누적 오차)
+struct SubMeshLods {
+	std::vector<std::vector<uint32_t>> levels;
+	std::vector<float> errors;
+};
+
+// 서브 메시 정점의 바운딩 구 (Ritter)
+void computeSubMeshSphere(const Vertex* vertices, uint32_t vertexCount, SubMesh& subMesh) {
+	subMesh.center = glm::vec3(0.0f);
+	subMesh.radius = 0.0f;
+	if (vertexCount == 0) {
+		return;
+	}
+
+	auto farthest = [&](const glm::vec3& from) {
+		glm::vec3 result = from;
+		float maxDistance = -1.0f;
+		for (uint32_t v = 0; v < vertexCount; v++) {
+			float distance = glm::dot(vertices[v].pos - from, vertices[v].pos - from);
+			if (distance > maxDistance) {
+				maxDistance = distance;
+				result = vertices[v].pos;
+			}
+		}
+		return result;
+	};
+	glm::vec3 a = farthest(vertices[0].pos);
+	glm::vec3 b = farthest(a);
+
+	glm::vec3 center = (a + b) * 0.5f;
+	float radius = glm::length(b - a) * 0.5f;
+	for (uint32_t v = 0; v < vertexCount; v++) {
+		float distance = glm::length(vertices[v].pos - center);
+		if (distance > radius) {
+			float newRadius = (radius + distance) * 0.5f;
+			center += (vertices[v].pos - center) * ((newRadius - radius) / distance);
+			radius = newRadius;
+		}
+	}
+	subMesh.center = center;
+	subMesh.radius = radius;
+}
+
+// 이전 LOD 를 MESH_LOD_REDUCTION 비율 목표로 단순화하며 체인 생성 (더 줄지 않으면 중단)
+template <typename IndexType>
+void buildSubMeshLods(const Vertex* vertices, const SubMesh& subMesh, const IndexType* indices, SubMeshLods& result) {
+	std::vector<uint32_t> current(indices, indices + subMesh.indexCount);
+	MeshSimplifier simplifier(vertices, subMesh.vertexCount, current);
+	float maxError = MESH_LOD_MAX_ERROR * subMesh.radius;
+	float error = 0.0f;
+
+	for (uint32_t level = 1; level < MAX_MESH_LODS; level++) {
+		size_t targetIndexCount = static_cast<size_t>(current.size() / 3 * MESH_LOD_REDUCTION) * 3;
+		if (targetIndexCount < MIN_LOD_TRIANGLES * 3) {
+			break;
+		}
+		size_t previousIndexCount = current.size();
+		error = std::max(error, simplifier.simplify(current, targetIndexCount, maxError));
+		if (current.size() > previousIndexCount * LOD_STALL_RATIO) {
+			break;
+		}
+		result.levels.push_back(current);
+		result.errors.push_back(error);
+	}
+}
+
+// LOD 인덱스를 서브 메시 indexType 배열 끝에 추가하고 시작 위치 반환
+template <typename IndexType>
+uint32_t appendLodIndices(std::vector<IndexType>& output, const std::vector<uint32_t>& indices) {
+	uint32_t firstIndex = static_cast<uint32_t>(output.size());
+	for (uint32_t index : indices) {
+		output.push_back(static_cast<IndexType>(index));
+	}
+	return firstIndex;
+}
+
+} // namespace
+
+MeshLodStats buildMeshLods(MeshData& meshData, ThreadPool* pool) {
+	// 서브 메시별로 병렬 생성 (인덱스 배열 추가는 순서를 지키기 위해 나중에 한 번에)
+	std::vector<SubMeshLods> results(meshData.subMeshes.size());
+	parallelFor(pool, static_cast<uint32_t>(meshData.subMeshes.size()), [&meshData, &results](uint32_t i) {
+		SubMesh& subMesh = meshData.subMeshes[i];
+		const Vertex* vertices = meshData.vertices.data() + subMesh.baseVertex;
+		computeSubMeshSphere(vertices, subMesh.vertexCount, subMesh);
+		if (subMesh.indexType == VK_INDEX_TYPE_UINT16) {
+			buildSubMeshLods(vertices, subMesh, meshData.gpuIndices16.data() + subMesh.firstIndex, results[i]);
+		} else {
+			buildSubMeshLods(vertices, subMesh, meshData.gpuIndices32.data() + subMesh.firstIndex, results[i]);
+		}
+	});
+
+	MeshLodStats stats;
+	meshData.lods.clear();
+	for (size_t i = 0; i < meshData.subMeshes.size(); i++) {
+		SubMesh& subMesh = meshData.subMeshes[i];
+		const SubMeshLods& result = results[i];
+		subMesh.firstLod = static_cast<uint32_t>(meshData.lods.size());
+		subMesh.lodCount = 0;
+
+		// LOD 0 = 원본 구간, LOD 1.. = 인덱스 배열 끝에 추가한 구간
+		uint32_t triangleCount = subMesh.indexCount / 3;
+		stats.triangleCounts[0] += triangleCount;
+		if (!result.levels.empty()) {
+			meshData.lods.push_back({subMesh.firstIndex, subMesh.indexCount, 0.0f});
+			for (size_t level = 0; level < result.levels.size(); level++) {
+				const std::vector<uint32_t>& indices = result.levels[level];
+				uint32_t firstIndex = subMesh.indexType == VK_INDEX_TYPE_UINT16
+					? appendLodIndices(meshData.gpuIndices16, indices)
+					: appendLodIndices(meshData.gpuIndices32, indices);
+				meshData.lods.push_back({firstIndex, static_cast<uint32_t>(indices.size()), result.errors[level]});
+			}
+			subMesh.lodCount = static_cast<uint32_t>(result.levels.size()) + 1;
+		}
+
+		for (uint32_t level = 1; level < MAX_MESH_LODS; level++) {
+			if (level < subMesh.lodCount) {
+				triangleCount = meshData.lods[subMesh.firstLod + level].indexCount / 3;
+				stats.maxErrors[level] = std::max(stats.maxErrors[level], meshData.lods[subMesh.firstLod + level].error);
+			}
+			stats.triangleCounts[level] += triangleCount;
+		}
+		stats.levelCount = std::max(stats.levelCount, std::max(subMesh.lodCount, 1u));
+	}
+	return stats;
+}
+
+MeshLodSelectParams makeMeshLodSelectParams(const glm::mat4& model, const glm::mat4& view, const glm::mat4& proj,
+											 float viewportHeight, float errorThreshold) {
+	// 오차와 카메라 거리가 모두 모델 좌표 기준이므로 (거리 1 에서의) 투영 배율만 있으면 됨
+	MeshLodSelectParams params;
+	params.cameraPosition = glm::vec3(glm::inverse(view * model)[3]);
+	params.pixelsPerUnit = std::fabs(proj[1][1]) * viewportHeight * 0.5f;
+	params.errorThreshold = errorThreshold;
+	return params;
+}
+
+uint32_t selectMeshLod(const SubMesh& subMesh, const MeshLod* lods, const MeshLodSelectParams& params) {
+	if (subMesh.lodCount == 0) {
+		return 0;
+	}
+
+	// 바운딩 구에서 가장 가까운 점까지 거리 (카메라가 구 안에 있으면 LOD 0)
+	float distance = glm::length(subMesh.center - params.cameraPosition) - subMesh.radius;
+	if (distance <= 0.0f) {
+		return 0;
+	}
+
+	for (uint32_t lod = subMesh.lodCount - 1; lod > 0; lod--) {
+		if (lods[subMesh.firstLod + lod].error / distance * params.pixelsPerUnit <= params.errorThreshold) {
+			return lod;
+		}
+	}
+	return 0;
+}
+
+void InstanceLodBuckets::setCamera(const SubMesh* subMeshes, uint32_t subMeshCount, const MeshLod* lods, const MeshLodSelectParams& params) {
+	// selectMeshLod 는 error / distance * pixelsPerUnit <= errorThreshold 인 가장 거친 LOD → LOD l 이상은 distance >= (l 이상 전환 거리의 최솟값)
+	float lodScale = params.pixelsPerUnit / params.errorThreshold;
+	std::vector<float> thresholds(static_cast<size_t>(subMeshCount) * MAX_MESH_LODS, INFINITY);
+	boundaries.clear();
+	for (uint32_t s = 0; s < subMeshCount; s++) {
+		const SubMesh& subMesh = subMeshes[s];
+		float threshold = INFINITY;
+		for (uint32_t lod = std::min(subMesh.lodCount, MAX_MESH_LODS); lod-- > 1;) {
+			threshold = std::min(threshold, lods[subMesh.firstLod + lod].error * lodScale);
+			thresholds[s * MAX_MESH_LODS + lod] = threshold;
+			boundaries.push_back(threshold);
+		}
+	}
+	std::sort(boundaries.begin(), boundaries.end());
+	boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+	// 전환 거리가 경계 j 이면 1 + (j + 1) 번 버킷부터 그 LOD 이상 (없는 LOD 는 마지막 버킷 다음 = 빈 구간)
+	uint32_t endKey = static_cast<uint32_t>(boundaries.size()) + 2;
+	lodKeys.assign(thresholds.size(), endKey);
+	for (uint32_t s = 0; s < subMeshCount; s++) {
+		lodKeys[s * MAX_MESH_LODS] = 0;
+		for (uint32_t lod = 1; lod < MAX_MESH_LODS; lod++) {
+			float threshold = thresholds[s * MAX_MESH_LODS + lod];
+			if (threshold != INFINITY) {
+				lodKeys[s * MAX_MESH_LODS + lod] = static_cast<uint32_t>(std::lower_bound(boundaries.begin(), boundaries.end(), threshold) - boundaries.begin()) + 2;
+			}
+		}
+	}
+}
+
+uint32_t InstanceLodBuckets::bucketOf(float distance) const {
+	if (!(distance > 0.0f)) {
+		return 0;
+	}
+	return static_cast<uint32_t>(std::upper_bound(boundaries.begin(), boundaries.end(), distance) - boundaries.begin()) + 1;
+}
+
+void InstanceLodBuckets::sort(const float* distances, std::vector<uint32_t>& indices) {
+	uint32_t bucketCount = static_cast<uint32_t>(boundaries.size()) + 2;
+	bucketStarts.assign(bucketCount + 1, 0);
+	keys.resize(indices.size());
+	for (size_t i = 0; i < indices.size(); i++) {
+		keys[i] = bucketOf(distances[indices[i]]);
+		bucketStarts[keys[i] + 1]++;
+	}
+	std::partial_sum(bucketStarts.begin(), bucketStarts.end(), bucketStarts.begin());
+
+	// 버킷 안에서는 원래 순서 유지 (CPU 컬링 결과의 공간 순서)
+	sorted.resize(indices.size());
+	bucketNext.assign(bucketStarts.begin(), bucketStarts.end() - 1);
+	for (size_t i = 0; i < indices.size(); i++) {
+		sorted[bucketNext[keys[i]]++] = indices[i];
+	}
+	indices.swap(sorted);
+}
+
+void InstanceLodBuckets::range(uint32_t subMesh, uint32_t lod, uint32_t& first, uint32_t& last) const {
+	const uint32_t* subMeshKeys = &lodKeys[subMesh * MAX_MESH_LODS];
+	first = bucketStarts[subMeshKeys[lod]];
+	last = lod + 1 < MAX_MESH_LODS ? bucketStarts[subMeshKeys[lod + 1]] : bucketStarts.back();
+	last = std::max(first, last);
+}
+
+uint32_t InstanceLodBuckets::lodAt(uint32_t subMesh, uint32_t position) const {
+	const uint32_t* subMeshKeys = &lodKeys[subMesh * MAX_MESH_LODS];
+	for (uint32_t lod = MAX_MESH_LODS - 1; lod > 0; lod--) {
+		if (position >= bucketStarts[subMeshKeys[lod]]) {
+			return lod;
+		}
+	}
+	return 0;
+}
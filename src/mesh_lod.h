@@ -0,0 +1,87 @@
+#pragma once
+
+#include "mesh.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+class ThreadPool;
+
+/*
+	[LOD 생성 / 선택]
+	1. buildMeshLods : 서브 메시마다 이전 LOD 를 절반 목표로 단순화해서 LOD 체인을 만든다. (quadric error metric)
+	                   모서리를 기존 정점 중 하나로 합치는 방식이라 정점은 그대로 공유하고 인덱스만 새로 생긴다.
+	                   열린 경계는 경계를 따라서만, texCoord seam 은 양쪽 정점 쌍을 함께 합쳐서 틈이 생기지 않게 한다.
+	2. selectMeshLod : 카메라 거리에서 LOD 오차가 화면에 차지하는 픽셀 수가 허용치 이하인 가장 거친 LOD 선택
+	인덱스 인코딩(16 / 32bit) 이후에 실행하고, LOD 인덱스는 서브 메시 indexType 배열 끝에 이어서 저장한다.
+*/
+
+// 서브 메시당 최대 LOD 수 (LOD 0 포함)
+const uint32_t MAX_MESH_LODS = 5;
+
+// LOD 단계마다 목표 삼각형 비율
+const float MESH_LOD_REDUCTION = 0.5f;
+
+// 허용 단순화 오차 (서브 메시 바운딩 구 반지름 대비)
+const float MESH_LOD_MAX_ERROR = 0.05f;
+
+// LOD 생성 결과 (LOD 단계별 전체 서브 메시 합계)
+struct MeshLodStats {
+	uint32_t levelCount = 0;						// 가장 긴 LOD 체인 길이
+	uint32_t triangleCounts[MAX_MESH_LODS] = {};	// 단계별 삼각형 수 (해당 단계가 없는 서브 메시는 마지막 LOD 로 계산)
+	float maxErrors[MAX_MESH_LODS] = {};			// 단계별 최대 오차 (모델 좌표 거리)
+};
+
+// LOD 선택에 쓰는 카메라 정보 (서브 메시의 모델 좌표 기준)
+struct MeshLodSelectParams {
+	glm::vec3 cameraPosition;
+	float pixelsPerUnit;			// 거리 1 에서 모델 좌표 길이 1 이 차지하는 픽셀 수
+	float errorThreshold;			// 허용 화면 오차 (픽셀)
+};
+
+// 서브 메시별 바운딩 구 + LOD 체인 생성 (인덱스 인코딩 이후 호출)
+MeshLodStats buildMeshLods(MeshData& meshData, ThreadPool* pool);
+
+// 모델 / 뷰 / 투영 행렬과 뷰포트 높이로 LOD 선택 정보 계산
+MeshLodSelectParams makeMeshLodSelectParams(const glm::mat4& model, const glm::mat4& view, const glm::mat4& proj,
+											 float viewportHeight, float errorThreshold);
+
+// 화면 오차가 허용치 이하인 가장 거친 LOD 번호 (LOD 가 없으면 0)
+uint32_t selectMeshLod(const SubMesh& subMesh, const MeshLod* lods, const MeshLodSelectParams& params);
+
+/*
+	[인스턴스 LOD 버킷]
+	여러 인스턴스를 instanced draw 로 그릴 때 인스턴스별 LOD 를 고르고 같은 LOD 인스턴스를 연속 구간으로 모은다.
+	1. 인스턴스마다 모든 서브 메시 바운딩 구를 덮는 구까지의 거리 (모델 좌표) 하나만 사용
+	   → 서브 메시마다 고르는 LOD 가 이 거리에 대해 단조 증가하므로 거리 순서로 모으면 서브 메시 / LOD 별 구간이 연속
+	2. 모든 서브 메시의 LOD 전환 거리를 정렬한 경계로 인스턴스를 계수 정렬 (비교 정렬 없이 인스턴스마다 경계 이진 탐색 1 번)
+	3. 서브 메시 s 를 LOD l 로 그리는 인스턴스는 정렬 순서 [first, last) → instanced draw 1 번 (firstInstance = first)
+	거리 하한을 쓰므로 selectMeshLod 와 같거나 더 세밀한 LOD 를 고른다.
+*/
+class InstanceLodBuckets {
+public:
+	// 이번 프레임 서브 메시별 LOD 전환 거리 계산 (params 는 월드 좌표 카메라, 모델 행렬 대신 단위 행렬로 만든 값)
+	void setCamera(const SubMesh* subMeshes, uint32_t subMeshCount, const MeshLod* lods, const MeshLodSelectParams& params);
+
+	// indices 를 LOD 버킷 순서로 재배치 (distances[인스턴스 번호]: 인스턴스 바운딩 구까지 모델 좌표 거리, 0 이하면 LOD 0)
+	void sort(const float* distances, std::vector<uint32_t>& indices);
+
+	// 정렬 순서에서 서브 메시 subMesh 를 lod 로 그리는 구간 [first, last) (비어 있으면 first == last)
+	void range(uint32_t subMesh, uint32_t lod, uint32_t& first, uint32_t& last) const;
+
+	// 정렬 순서 position 번째 인스턴스가 서브 메시 subMesh 에 쓰는 LOD
+	uint32_t lodAt(uint32_t subMesh, uint32_t position) const;
+
+private:
+	std::vector<float> boundaries;			// 정렬된 LOD 전환 거리 (중복 제거)
+	std::vector<uint32_t> lodKeys;			// 서브 메시 x MAX_MESH_LODS: 이 LOD 이상을 고르는 가장 작은 버킷 번호
+	std::vector<uint32_t> bucketStarts;		// 버킷별 정렬 순서 시작 위치 (마지막 값은 인스턴스 수)
+	std::vector<uint32_t> keys;				// sort 작업용 (인스턴스별 버킷, 버킷별 다음 기록 위치, 정렬 결과)
+	std::vector<uint32_t> bucketNext;
+	std::vector<uint32_t> sorted;
+
+	// 거리가 속하는 버킷 (0: 카메라가 바운딩 구 안, 1 + 거리 이하인 경계 수)
+	uint32_t bucketOf(float distance) const;
+};
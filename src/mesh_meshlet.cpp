@@ -0,0 +1,495 @@
+#include "mesh_meshlet.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+const uint32_t NOT_IN_MESHLET = UINT32_MAX;
+const uint32_t NO_TRIANGLE = UINT32_MAX;
+
+// 콘 반각이 이보다 넓으면 (법선 최소 내적이 이하이면) backface 컬링이 거의 성립하지 않으므로 콘을 만들지 않음
+const float MIN_CONE_DOT = 0.1f;
+
+// 메시렛 평균 법선과 내적이 이보다 작은 삼각형은 다음 메시렛으로 넘김 (콘이 넓어지지 않도록)
+const float MESHLET_NORMAL_DOT = 0.7f;
+
+// 바운딩 구 포함 검사 허용 오차 (반지름 대비)
+const float SPHERE_EPSILON = 1e-4f;
+
+// 생성 중인 메시렛 (정점 목록 + 삼각형 목록)
+struct MeshletBuilder {
+	std::vector<uint32_t> vertices;			// 서브 메시 정점 번호
+	std::vector<uint32_t> positions;		// 정점 위치 번호 (후보 삼각형 탐색용, 중복 없음)
+	std::vector<uint32_t> triangles;		// 서브 메시 삼각형 번호
+	glm::vec3 centroidSum = glm::vec3(0.0f);
+	glm::vec3 normalSum = glm::vec3(0.0f);
+};
+
+// Ritter 바운딩 구 (가장 먼 두 점으로 초기 구를 만들고 밖에 있는 점마다 확장)
+void computeBoundingSphere(const Vertex* vertices, const std::vector<uint32_t>& meshletVertices, Meshlet& meshlet) {
+	glm::vec3 start = vertices[meshletVertices[0]].pos;
+	glm::vec3 a = start;
+	glm::vec3 b = start;
+	float maxDistance = -1.0f;
+	for (uint32_t v : meshletVertices) {
+		float distance = glm::dot(vertices[v].pos - start, vertices[v].pos - start);
+		if (distance > maxDistance) {
+			maxDistance = distance;
+			a = vertices[v].pos;
+		}
+	}
+	maxDistance = -1.0f;
+	for (uint32_t v : meshletVertices) {
+		float distance = glm::dot(vertices[v].pos - a, vertices[v].pos - a);
+		if (distance > maxDistance) {
+			maxDistance = distance;
+			b = vertices[v].pos;
+		}
+	}
+
+	glm::vec3 center = (a + b) * 0.5f;
+	float radius = glm::length(b - a) * 0.5f;
+	for (uint32_t v : meshletVertices) {
+		float distance = glm::length(vertices[v].pos - center);
+		if (distance > radius) {
+			float newRadius = (radius + distance) * 0.5f;
+			center += (vertices[v].pos - center) * ((newRadius - radius) / distance);
+			radius = newRadius;
+		}
+	}
+
+	meshlet.center = center;
+	meshlet.radius = radius;
+}
+
+/*
+	[법선 콘]
+	축 = 삼각형 법선 평균, 반각 = 축과 가장 많이 벌어진 법선의 각도
+	꼭짓점은 모든 삼각형 평면의 뒤쪽에 오도록 축을 따라 바운딩 구 중심에서 물러난 위치
+	카메라 → 꼭짓점 방향과 축의 내적이 sin(반각) 이상이면 모든 삼각형이 뒷면
+*/
+void computeNormalCone(const std::vector<glm::vec3>& triangleNormals, const std::vector<glm::vec3>& triangleCorners,
+					   const std::vector<uint32_t>& meshletTriangles, Meshlet& meshlet) {
+	meshlet.coneApex = meshlet.center;
+	meshlet.coneAxis = glm::vec3(0.0f, 0.0f, 1.0f);
+	meshlet.coneCutoff = 1.0f;
+
+	glm::vec3 normalSum(0.0f);
+	for (uint32_t t : meshletTriangles) {
+		normalSum += triangleNormals[t];
+	}
+	float axisLength = glm::length(normalSum);
+	if (axisLength <= 0.0f) {
+		return;
+	}
+	glm::vec3 axis = normalSum / axisLength;
+
+	// 축과 가장 많이 벌어진 법선 (면적이 0인 삼각형은 제외)
+	float minDot = 1.0f;
+	for (uint32_t t : meshletTriangles) {
+		if (triangleNormals[t] != glm::vec3(0.0f)) {
+			minDot = std::min(minDot, glm::dot(axis, triangleNormals[t]));
+		}
+	}
+	if (minDot <= MIN_CONE_DOT) {
+		meshlet.coneAxis = axis;
+		return;
+	}
+
+	// 모든 삼각형 평면 뒤로 꼭짓점을 보내는 최대 거리
+	float maxT = 0.0f;
+	for (uint32_t t : meshletTriangles) {
+		if (triangleNormals[t] == glm::vec3(0.0f)) {
+			continue;
+		}
+		float distance = glm::dot(meshlet.center - triangleCorners[t], triangleNormals[t]);
+		maxT = std::max(maxT, distance / glm::dot(axis, triangleNormals[t]));
+	}
+
+	meshlet.coneApex = meshlet.center - axis * maxT;
+	meshlet.coneAxis = axis;
+	meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+}
+
+/*
+	[서브 메시 1 개의 메시렛 생성]
+	1. 현재 메시렛과 정점 위치를 공유하는 삼각형 중 평균 법선과 방향이 비슷하고,
+	   새 정점이 가장 적고, 메시렛 중심에 가장 가까운 삼각형 추가
+	2. 남은 후보가 모두 다른 방향을 향하면 메시렛을 닫고 그 삼각형에서 새 메시렛 시작 (콘이 좁아야 backface 컬링 가능)
+	3. 공유하는 삼각형이 없으면 원래 순서에서 다음 삼각형 추가 (Tipsify / overdraw 정렬 순서라 공간적으로 가까움)
+	4. 정점 / 삼각형 제한에 걸리면 메시렛을 닫고 바운딩 정보 계산
+	인덱스는 메시렛 순서로 indices 에 다시 기록하고, 메시렛 firstIndex 는 firstIndex(서브 메시 시작 위치) 기준으로 계산
+*/
+template <typename IndexType>
+void buildSubMeshMeshlets(const Vertex* vertices, uint32_t vertexCount, IndexType* indices, uint32_t indexCount,
+						  uint32_t firstIndex, std::vector<Meshlet>& meshlets) {
+	uint32_t triangleCount = indexCount / 3;
+	if (triangleCount == 0) {
+		return;
+	}
+
+	// 위치가 같은 정점을 하나로 묶은 번호 (texCoord 경계로 나뉜 정점도 인접한 것으로 취급)
+	std::vector<uint32_t> sortedVertices(vertexCount);
+	std::iota(sortedVertices.begin(), sortedVertices.end(), 0);
+	std::sort(sortedVertices.begin(), sortedVertices.end(), [vertices](uint32_t a, uint32_t b) {
+		const glm::vec3& pa = vertices[a].pos;
+		const glm::vec3& pb = vertices[b].pos;
+		return pa.x < pb.x || (pa.x == pb.x && (pa.y < pb.y || (pa.y == pb.y && pa.z < pb.z)));
+	});
+	std::vector<uint32_t> positionId(vertexCount);
+	uint32_t positionCount = 0;
+	for (uint32_t i = 0; i < vertexCount; i++) {
+		if (i > 0 && vertices[sortedVertices[i]].pos != vertices[sortedVertices[i - 1]].pos) {
+			positionCount++;
+		}
+		positionId[sortedVertices[i]] = positionCount;
+	}
+	positionCount++;
+
+	// 위치별 인접 삼각형 목록 (CSR 형식)
+	std::vector<uint32_t> adjacencyOffsets(positionCount + 1, 0);
+	for (uint32_t i = 0; i < indexCount; i++) {
+		adjacencyOffsets[positionId[indices[i]] + 1]++;
+	}
+	for (uint32_t p = 0; p < positionCount; p++) {
+		adjacencyOffsets[p + 1] += adjacencyOffsets[p];
+	}
+	std::vector<uint32_t> adjacency(indexCount);
+	std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+	for (uint32_t i = 0; i < indexCount; i++) {
+		adjacency[cursor[positionId[indices[i]]]++] = i / 3;
+	}
+
+	// 삼각형별 중심 / 단위 법선 / 첫 꼭짓점
+	std::vector<glm::vec3> triangleCentroids(triangleCount);
+	std::vector<glm::vec3> triangleNormals(triangleCount);
+	std::vector<glm::vec3> triangleCorners(triangleCount);
+	for (uint32_t t = 0; t < triangleCount; t++) {
+		const glm::vec3& p0 = vertices[indices[t * 3 + 0]].pos;
+		const glm::vec3& p1 = vertices[indices[t * 3 + 1]].pos;
+		const glm::vec3& p2 = vertices[indices[t * 3 + 2]].pos;
+		glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+		float area = glm::length(normal);
+		triangleCentroids[t] = (p0 + p1 + p2) / 3.0f;
+		triangleNormals[t] = area > 0.0f ? normal / area : glm::vec3(0.0f);
+		triangleCorners[t] = p0;
+	}
+
+	std::vector<IndexType> reordered;
+	reordered.reserve(indexCount);
+	std::vector<bool> emitted(triangleCount, false);
+	std::vector<uint32_t> meshletSlot(vertexCount, NOT_IN_MESHLET);
+	std::vector<bool> positionInMeshlet(positionCount, false);
+	MeshletBuilder builder;
+	uint32_t seedCursor = 0;
+
+	// 삼각형을 추가하면 새로 늘어나는 정점 수
+	auto newVertexCount = [&](uint32_t t) {
+		uint32_t count = 0;
+		for (uint32_t k = 0; k < 3; k++) {
+			uint32_t v = indices[t * 3 + k];
+			bool repeated = (k > 0 && v == indices[t * 3]) || (k > 1 && v == indices[t * 3 + 1]);
+			if (meshletSlot[v] == NOT_IN_MESHLET && !repeated) {
+				count++;
+			}
+		}
+		return count;
+	};
+
+	// 삼각형이 메시렛 평균 법선(normal)과 비슷한 방향인지 (빈 메시렛 / 면적 0 삼각형은 항상 true)
+	auto isFacing = [&](uint32_t t, const glm::vec3& normal) {
+		return normal == glm::vec3(0.0f) || triangleNormals[t] == glm::vec3(0.0f) || glm::dot(normal, triangleNormals[t]) >= MESHLET_NORMAL_DOT;
+	};
+
+	// 현재 메시렛을 닫고 바운딩 정보 계산
+	auto finishMeshlet = [&]() {
+		Meshlet meshlet{};
+		meshlet.firstIndex = firstIndex + static_cast<uint32_t>(reordered.size());
+		meshlet.indexCount = static_cast<uint32_t>(builder.triangles.size()) * 3;
+		meshlet.vertexCount = static_cast<uint32_t>(builder.vertices.size());
+		for (uint32_t t : builder.triangles) {
+			reordered.insert(reordered.end(), indices + t * 3, indices + t * 3 + 3);
+		}
+		computeBoundingSphere(vertices, builder.vertices, meshlet);
+		computeNormalCone(triangleNormals, triangleCorners, builder.triangles, meshlet);
+		meshlets.push_back(meshlet);
+
+		for (uint32_t v : builder.vertices) {
+			meshletSlot[v] = NOT_IN_MESHLET;
+		}
+		for (uint32_t p : builder.positions) {
+			positionInMeshlet[p] = false;
+		}
+		builder.vertices.clear();
+		builder.positions.clear();
+		builder.triangles.clear();
+		builder.centroidSum = glm::vec3(0.0f);
+		builder.normalSum = glm::vec3(0.0f);
+	};
+
+	for (uint32_t emittedCount = 0; emittedCount < triangleCount; emittedCount++) {
+		// 1. 메시렛 정점을 공유하는 삼각형 중 가장 좋은 후보
+		uint32_t best = NO_TRIANGLE;
+		bool bestFacing = false;
+		uint32_t bestNewVertices = 4;
+		float bestDistance = std::numeric_limits<float>::max();
+		glm::vec3 center = builder.triangles.empty() ? glm::vec3(0.0f) : builder.centroidSum / static_cast<float>(builder.triangles.size());
+		glm::vec3 normal = builder.normalSum == glm::vec3(0.0f) ? glm::vec3(0.0f) : glm::normalize(builder.normalSum);
+		for (uint32_t p : builder.positions) {
+			for (uint32_t a = adjacencyOffsets[p]; a < adjacencyOffsets[p + 1]; a++) {
+				uint32_t t = adjacency[a];
+				if (emitted[t]) {
+					continue;
+				}
+				uint32_t newVertices = newVertexCount(t);
+				if (builder.vertices.size() + newVertices > MAX_MESHLET_VERTICES) {
+					continue;
+				}
+				bool facing = isFacing(t, normal);
+				glm::vec3 offset = triangleCentroids[t] - center;
+				float distance = glm::dot(offset, offset);
+				if (best == NO_TRIANGLE || (facing && !bestFacing)
+					|| (facing == bestFacing && (newVertices < bestNewVertices || (newVertices == bestNewVertices && distance < bestDistance)))) {
+					best = t;
+					bestFacing = facing;
+					bestNewVertices = newVertices;
+					bestDistance = distance;
+				}
+			}
+		}
+
+		// 2. 남은 후보가 모두 다른 방향을 향하면 메시렛을 닫고 그 삼각형에서 새로 시작
+		if (best != NO_TRIANGLE && !bestFacing) {
+			finishMeshlet();
+		}
+
+		// 3. 후보가 없으면 원래 순서의 다음 삼각형 (들어가지 않거나 다른 방향이면 메시렛을 닫고 새로 시작)
+		if (best == NO_TRIANGLE) {
+			while (emitted[seedCursor]) {
+				seedCursor++;
+			}
+			best = seedCursor;
+			if (builder.vertices.size() + newVertexCount(best) > MAX_MESHLET_VERTICES || !isFacing(best, normal)) {
+				finishMeshlet();
+			}
+		}
+
+		// 삼각형 추가
+		for (uint32_t k = 0; k < 3; k++) {
+			uint32_t v = indices[best * 3 + k];
+			if (meshletSlot[v] == NOT_IN_MESHLET) {
+				meshletSlot[v] = static_cast<uint32_t>(builder.vertices.size());
+				builder.vertices.push_back(v);
+			}
+			if (!positionInMeshlet[positionId[v]]) {
+				positionInMeshlet[positionId[v]] = true;
+				builder.positions.push_back(positionId[v]);
+			}
+		}
+		builder.triangles.push_back(best);
+		builder.centroidSum += triangleCentroids[best];
+		builder.normalSum += triangleNormals[best];
+		emitted[best] = true;
+
+		// 4. 삼각형 제한에 걸리면 메시렛 닫기
+		if (builder.triangles.size() == MAX_MESHLET_TRIANGLES) {
+			finishMeshlet();
+		}
+	}
+	if (!builder.triangles.empty()) {
+		finishMeshlet();
+	}
+
+	std::copy(reordered.begin(), reordered.end(), indices);
+}
+
+// 메시렛 1 개 검사 (정점 / 삼각형 제한, 고유 정점 수, 바운딩 구 포함)
+template <typename IndexType>
+bool validateMeshlet(const Vertex* vertices, uint32_t vertexCount, const IndexType* indices, const Meshlet& meshlet, std::vector<uint32_t>& seen) {
+	if (meshlet.indexCount == 0 || meshlet.indexCount % 3 != 0 || meshlet.indexCount / 3 > MAX_MESHLET_TRIANGLES
+		|| meshlet.vertexCount > MAX_MESHLET_VERTICES) {
+		return false;
+	}
+
+	uint32_t uniqueVertices = 0;
+	float tolerance = meshlet.radius * SPHERE_EPSILON + SPHERE_EPSILON;
+	for (uint32_t i = meshlet.firstIndex; i < meshlet.firstIndex + meshlet.indexCount; i++) {
+		uint32_t v = indices[i];
+		if (v >= vertexCount) {
+			return false;
+		}
+		if (seen[v] != meshlet.firstIndex) {
+			seen[v] = meshlet.firstIndex;
+			uniqueVertices++;
+		}
+		if (glm::length(vertices[v].pos - meshlet.center) > meshlet.radius + tolerance) {
+			return false;
+		}
+	}
+	return uniqueVertices == meshlet.vertexCount;
+}
+
+// 정규화된 평면 (법선 길이로 나눠서 거리 단위를 맞춤)
+glm::vec4 normalizePlane(const glm::vec4& plane) {
+	return plane / glm::length(glm::vec3(plane));
+}
+
+} // namespace
+
+MeshletStats buildMeshlets(MeshData& meshData, ThreadPool* pool) {
+	// 서브 메시별로 병렬 생성 (각 서브 메시는 자기 인덱스 구간만 다시 기록)
+	std::vector<std::vector<Meshlet>> subMeshMeshlets(meshData.subMeshes.size());
+	parallelFor(pool, static_cast<uint32_t>(meshData.subMeshes.size()), [&meshData, &subMeshMeshlets](uint32_t i) {
+		const SubMesh& subMesh = meshData.subMeshes[i];
+		const Vertex* vertices = meshData.vertices.data() + subMesh.baseVertex;
+		if (subMesh.indexType == VK_INDEX_TYPE_UINT16) {
+			buildSubMeshMeshlets(vertices, subMesh.vertexCount, meshData.gpuIndices16.data() + subMesh.firstIndex, subMesh.indexCount,
+								 subMesh.firstIndex, subMeshMeshlets[i]);
+		} else {
+			buildSubMeshMeshlets(vertices, subMesh.vertexCount, meshData.gpuIndices32.data() + subMesh.firstIndex, subMesh.indexCount,
+								 subMesh.firstIndex, subMeshMeshlets[i]);
+		}
+	});
+
+	// 서브 메시 순서대로 합치기
+	MeshletStats stats;
+	meshData.meshlets.clear();
+	uint64_t vertexSum = 0;
+	uint64_t triangleSum = 0;
+	for (size_t i = 0; i < meshData.subMeshes.size(); i++) {
+		SubMesh& subMesh = meshData.subMeshes[i];
+		subMesh.firstMeshlet = static_cast<uint32_t>(meshData.meshlets.size());
+		subMesh.meshletCount = static_cast<uint32_t>(subMeshMeshlets[i].size());
+		for (const Meshlet& meshlet : subMeshMeshlets[i]) {
+			vertexSum += meshlet.vertexCount;
+			triangleSum += meshlet.indexCount / 3;
+			if (meshlet.coneCutoff < 1.0f) {
+				stats.coneMeshletCount++;
+			}
+		}
+		meshData.meshlets.insert(meshData.meshlets.end(), subMeshMeshlets[i].begin(), subMeshMeshlets[i].end());
+	}
+
+	stats.meshletCount = static_cast<uint32_t>(meshData.meshlets.size());
+	if (stats.meshletCount > 0) {
+		stats.averageVertices = static_cast<float>(vertexSum) / stats.meshletCount;
+		stats.averageTriangles = static_cast<float>(triangleSum) / stats.meshletCount;
+	}
+	return stats;
+}
+
+bool validateMeshlets(const MeshData& meshData) {
+	std::vector<uint32_t> seen;
+	for (const SubMesh& subMesh : meshData.subMeshes) {
+		if (subMesh.meshletCount == 0) {
+			continue;
+		}
+		if (subMesh.firstMeshlet + subMesh.meshletCount > meshData.meshlets.size()) {
+			return false;
+		}
+
+		// 메시렛 구간이 서브 메시 인덱스 구간을 순서대로 빈틈 없이 덮어야 함
+		seen.assign(subMesh.vertexCount, UINT32_MAX);
+		const Vertex* vertices = meshData.vertices.data() + subMesh.baseVertex;
+		uint32_t nextIndex = subMesh.firstIndex;
+		for (uint32_t m = subMesh.firstMeshlet; m < subMesh.firstMeshlet + subMesh.meshletCount; m++) {
+			const Meshlet& meshlet = meshData.meshlets[m];
+			if (meshlet.firstIndex != nextIndex) {
+				return false;
+			}
+			bool valid = subMesh.indexType == VK_INDEX_TYPE_UINT16
+				? validateMeshlet(vertices, subMesh.vertexCount, meshData.gpuIndices16.data(), meshlet, seen)
+				: validateMeshlet(vertices, subMesh.vertexCount, meshData.gpuIndices32.data(), meshlet, seen);
+			if (!valid) {
+				return false;
+			}
+			nextIndex += meshlet.indexCount;
+		}
+		if (nextIndex != subMesh.firstIndex + subMesh.indexCount) {
+			return false;
+		}
+	}
+	return true;
+}
+
+MeshletCullParams makeMeshletCullParams(const glm::mat4& model, const glm::mat4& view, const glm::mat4& proj) {
+	// clip = proj * view * model 의 행으로 모델 좌표 기준 frustum 평면 추출 (Gribb / Hartmann)
+	glm::mat4 clip = proj * view * model;
+	glm::vec4 rows[4];
+	for (int r = 0; r < 4; r++) {
+		rows[r] = glm::vec4(clip[0][r], clip[1][r], clip[2][r], clip[3][r]);
+	}
+
+	MeshletCullParams params;
+	params.frustumPlanes[0] = normalizePlane(rows[3] + rows[0]);	// left
+	params.frustumPlanes[1] = normalizePlane(rows[3] - rows[0]);	// right
+	params.frustumPlanes[2] = normalizePlane(rows[3] + rows[1]);	// bottom
+	params.frustumPlanes[3] = normalizePlane(rows[3] - rows[1]);	// top
+	params.frustumPlanes[4] = normalizePlane(rows[2]);				// near (depth 0 ~ 1)
+	params.frustumPlanes[5] = normalizePlane(rows[3] - rows[2]);	// far
+
+	// 카메라 위치 (view * model 역행렬의 원점)
+	params.cameraPosition = glm::vec3(glm::inverse(view * model)[3]);
+	return params;
+}
+
+MeshletCullStats cullMeshlets(const SubMesh* subMeshes, uint32_t subMeshCount, const Meshlet* meshlets,
+							  const MeshletCullParams& params, std::vector<MeshletDraw>& draws) {
+	MeshletCullStats stats;
+	draws.clear();
+
+	for (uint32_t i = 0; i < subMeshCount; i++) {
+		const SubMesh& subMesh = subMeshes[i];
+		if (subMesh.meshletCount == 0) {
+			draws.push_back({i, subMesh.firstIndex, subMesh.indexCount});
+			stats.triangleCount += subMesh.indexCount / 3;
+			continue;
+		}
+
+		for (uint32_t m = subMesh.firstMeshlet; m < subMesh.firstMeshlet + subMesh.meshletCount; m++) {
+			const Meshlet& meshlet = meshlets[m];
+			uint32_t triangles = meshlet.indexCount / 3;
+			stats.meshletCount++;
+			stats.triangleCount += triangles;
+
+			// frustum 컬링 (바운딩 구가 평면 하나라도 완전히 바깥이면 제외)
+			bool outside = false;
+			for (const glm::vec4& plane : params.frustumPlanes) {
+				if (glm::dot(glm::vec3(plane), meshlet.center) + plane.w < -meshlet.radius) {
+					outside = true;
+					break;
+				}
+			}
+			if (outside) {
+				stats.frustumCulledTriangles += triangles;
+				continue;
+			}
+
+			// backface 콘 컬링
+			if (meshlet.coneCutoff < 1.0f) {
+				glm::vec3 direction = meshlet.coneApex - params.cameraPosition;
+				float length = glm::length(direction);
+				if (length > 0.0f && glm::dot(direction, meshlet.coneAxis) >= meshlet.coneCutoff * length) {
+					stats.backfaceCulledTriangles += triangles;
+					continue;
+				}
+			}
+
+			// 이전 draw 와 인덱스 구간이 이어지면 합침
+			stats.visibleMeshletCount++;
+			if (!draws.empty() && draws.back().subMeshIndex == i && draws.back().firstIndex + draws.back().indexCount == meshlet.firstIndex) {
+				draws.back().indexCount += meshlet.indexCount;
+			} else {
+				draws.push_back({i, meshlet.firstIndex, meshlet.indexCount});
+			}
+		}
+	}
+
+	stats.drawCount = static_cast<uint32_t>(draws.size());
+	return stats;
+}
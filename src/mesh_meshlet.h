@@ -0,0 +1,68 @@
+#pragma once
+
+#include "mesh.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+class ThreadPool;
+
+/*
+	[메시렛 생성 / 컬링]
+	서브 메시를 작은 클러스터(Meshlet)로 나눠 물체 단위보다 세밀하게 컬링한다.
+	1. buildMeshlets  : 이미 넣은 정점을 공유하는 삼각형부터 (새 정점이 적은 순 → 중심에 가까운 순) 클러스터를 키우고,
+	                    서브 메시 인덱스를 메시렛 순서로 다시 기록한 뒤 메시렛별 바운딩 구 / 법선 콘 계산
+	2. cullMeshlets   : 매 프레임 frustum 밖이거나 모든 삼각형이 카메라 반대쪽을 향하는 메시렛을 제외하고,
+	                    인덱스 구간이 이어지는 메시렛은 draw 1 번으로 합침
+	인덱스 인코딩(16 / 32bit) 이후에 실행하므로 메시렛이 16bit 청크 경계를 넘지 않는다.
+*/
+
+// 메시렛 1 개의 최대 정점 / 삼각형 수
+const uint32_t MAX_MESHLET_VERTICES = 64;
+const uint32_t MAX_MESHLET_TRIANGLES = 124;
+
+// 메시렛 생성 결과
+struct MeshletStats {
+	uint32_t meshletCount = 0;
+	float averageVertices = 0.0f;		// 메시렛당 평균 정점 수
+	float averageTriangles = 0.0f;		// 메시렛당 평균 삼각형 수
+	uint32_t coneMeshletCount = 0;		// backface 컬링이 가능한 (콘이 충분히 좁은) 메시렛 수
+};
+
+// 메시렛 컬링에 쓰는 카메라 정보 (서브 메시의 모델 좌표 기준)
+struct MeshletCullParams {
+	glm::vec4 frustumPlanes[6];			// 안쪽을 향하는 정규화된 평면 (xyz: 법선, w: 원점까지 거리)
+	glm::vec3 cameraPosition;
+};
+
+// draw 1 번으로 그리는 인덱스 구간 (이어지는 메시렛을 합친 범위)
+struct MeshletDraw {
+	uint32_t subMeshIndex;
+	uint32_t firstIndex;				// 서브 메시 indexType 별 인덱스 배열 기준
+	uint32_t indexCount;
+};
+
+// 컬링 결과 (삼각형 단위)
+struct MeshletCullStats {
+	uint32_t meshletCount = 0;
+	uint32_t visibleMeshletCount = 0;
+	uint32_t triangleCount = 0;
+	uint32_t frustumCulledTriangles = 0;
+	uint32_t backfaceCulledTriangles = 0;
+	uint32_t drawCount = 0;
+};
+
+// 서브 메시별 메시렛 생성 (인덱스 인코딩 이후 호출)
+MeshletStats buildMeshlets(MeshData& meshData, ThreadPool* pool);
+
+// 메시렛이 서브 메시 인덱스 구간을 빈틈 / 겹침 없이 덮고, 정점 / 삼각형 제한과 바운딩 구를 지키는지 검사
+bool validateMeshlets(const MeshData& meshData);
+
+// 모델 / 뷰 / 투영 행렬로 모델 좌표 기준 컬링 정보 계산 (투영은 depth 0 ~ 1 기준)
+MeshletCullParams makeMeshletCullParams(const glm::mat4& model, const glm::mat4& view, const glm::mat4& proj);
+
+// 보이는 메시렛을 draws 에 기록 (메시렛이 없는 서브 메시는 통째로 draw)
+MeshletCullStats cullMeshlets(const SubMesh* subMeshes, uint32_t subMeshCount, const Meshlet* meshlets,
+							  const MeshletCullParams& params, std::vector<MeshletDraw>& draws);
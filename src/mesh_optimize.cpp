@@ -0,0 +1,347 @@
+#include "mesh_optimize.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+const uint32_t INVALID_VERTEX = UINT32_MAX;
+
+// 정점별 인접 삼각형 목록 (CSR 형식: triangles[offsets[v] .. offsets[v + 1]])
+struct TriangleAdjacency {
+	std::vector<uint32_t> offsets;
+	std::vector<uint32_t> triangles;
+};
+
+void buildAdjacency(const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount, TriangleAdjacency& adjacency) {
+	adjacency.offsets.assign(vertexCount + 1, 0);
+	for (uint32_t i = 0; i < indexCount; i++) {
+		adjacency.offsets[indices[i] + 1]++;
+	}
+	for (uint32_t v = 0; v < vertexCount; v++) {
+		adjacency.offsets[v + 1] += adjacency.offsets[v];
+	}
+
+	std::vector<uint32_t> cursor(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+	adjacency.triangles.resize(indexCount);
+	for (uint32_t i = 0; i < indexCount; i++) {
+		adjacency.triangles[cursor[indices[i]]++] = i / 3;
+	}
+}
+
+/*
+	[FIFO 정점 캐시 시뮬레이터]
+	정점이 캐시에 들어간 시각(미스 횟수 기준)을 기록해서 timestamp - 기록 시각 < cacheSize 이면 히트.
+	reset 은 timestamp 를 cacheSize 만큼 건너뛰는 것으로 처리 (배열 초기화 불필요)
+*/
+struct VertexCacheSimulator {
+	std::vector<uint32_t> cacheTime;
+	uint32_t cacheSize;
+	uint32_t timestamp;
+
+	VertexCacheSimulator(uint32_t vertexCount, uint32_t cacheSize)
+		: cacheTime(vertexCount, 0), cacheSize(cacheSize), timestamp(cacheSize + 1) {}
+
+	// 정점 1개 참조 (미스면 1 반환)
+	uint32_t access(uint32_t vertex) {
+		if (timestamp - cacheTime[vertex] > cacheSize) {
+			cacheTime[vertex] = timestamp++;
+			return 1;
+		}
+		return 0;
+	}
+
+	// 삼각형 1개 참조 (미스 수 반환)
+	uint32_t accessTriangle(const uint32_t* triangle) {
+		return access(triangle[0]) + access(triangle[1]) + access(triangle[2]);
+	}
+
+	void reset() {
+		timestamp += cacheSize + 1;
+	}
+};
+
+// 살아있는 삼각형이 남은 정점 찾기 (dead-end 스택 → 정점 번호 순으로 탐색)
+uint32_t skipDeadEnd(const std::vector<uint32_t>& liveTriangles, std::vector<uint32_t>& deadEnd, uint32_t& cursor, uint32_t vertexCount) {
+	while (!deadEnd.empty()) {
+		uint32_t vertex = deadEnd.back();
+		deadEnd.pop_back();
+		if (liveTriangles[vertex] > 0) {
+			return vertex;
+		}
+	}
+	for (; cursor < vertexCount; cursor++) {
+		if (liveTriangles[cursor] > 0) {
+			return cursor;
+		}
+	}
+	return INVALID_VERTEX;
+}
+
+/*
+	[Tipsify] (Sander et al. 2007, "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw")
+	팬(fan) 정점 주변의 삼각형을 모두 출력한 뒤, 출력한 정점 중 캐시에 남아있을 정점을 다음 팬 정점으로 고른다.
+	다음 팬 정점이 없어 dead-end 로 건너뛴 위치를 클러스터 경계(hardBoundaries, 삼각형 번호)로 기록한다.
+*/
+void tipsify(const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount, uint32_t cacheSize,
+			 uint32_t* output, std::vector<uint32_t>& hardBoundaries) {
+	uint32_t triangleCount = indexCount / 3;
+	hardBoundaries.clear();
+	if (triangleCount == 0) {
+		return;
+	}
+
+	TriangleAdjacency adjacency;
+	buildAdjacency(indices, indexCount, vertexCount, adjacency);
+
+	std::vector<uint32_t> liveTriangles(vertexCount);
+	for (uint32_t v = 0; v < vertexCount; v++) {
+		liveTriangles[v] = adjacency.offsets[v + 1] - adjacency.offsets[v];
+	}
+
+	std::vector<int32_t> cacheTime(vertexCount, 0);
+	std::vector<bool> emitted(triangleCount, false);
+	std::vector<uint32_t> deadEnd;
+	std::vector<uint32_t> candidates;
+	deadEnd.reserve(indexCount);
+
+	int32_t timestamp = static_cast<int32_t>(cacheSize) + 1;
+	uint32_t cursor = 0;
+	uint32_t outputCount = 0;
+
+	uint32_t fanning = skipDeadEnd(liveTriangles, deadEnd, cursor, vertexCount);
+	hardBoundaries.push_back(0);
+
+	while (fanning != INVALID_VERTEX) {
+		candidates.clear();
+
+		// 팬 정점 주변의 남은 삼각형 모두 출력
+		for (uint32_t i = adjacency.offsets[fanning]; i < adjacency.offsets[fanning + 1]; i++) {
+			uint32_t triangle = adjacency.triangles[i];
+			if (emitted[triangle]) {
+				continue;
+			}
+
+			for (uint32_t k = 0; k < 3; k++) {
+				uint32_t v = indices[triangle * 3 + k];
+				output[outputCount++] = v;
+				deadEnd.push_back(v);
+				candidates.push_back(v);
+				liveTriangles[v]--;
+				if (timestamp - cacheTime[v] > static_cast<int32_t>(cacheSize)) {
+					cacheTime[v] = timestamp++;
+				}
+			}
+			emitted[triangle] = true;
+		}
+
+		// 다음 팬 정점 선택 (남은 삼각형을 다 출력해도 캐시에 남아있을 정점 중 가장 오래된 정점)
+		uint32_t next = INVALID_VERTEX;
+		int32_t bestPriority = -1;
+		for (uint32_t v : candidates) {
+			if (liveTriangles[v] == 0) {
+				continue;
+			}
+			int32_t priority = 0;
+			int32_t age = timestamp - cacheTime[v];
+			if (age + 2 * static_cast<int32_t>(liveTriangles[v]) <= static_cast<int32_t>(cacheSize)) {
+				priority = age;
+			}
+			if (priority > bestPriority) {
+				bestPriority = priority;
+				next = v;
+			}
+		}
+
+		if (next == INVALID_VERTEX) {
+			next = skipDeadEnd(liveTriangles, deadEnd, cursor, vertexCount);
+			if (next != INVALID_VERTEX) {
+				hardBoundaries.push_back(outputCount / 3);
+			}
+		}
+		fanning = next;
+	}
+}
+
+/*
+	[overdraw 감소 정렬]
+	1. Tipsify 클러스터를 다시 잘게 나눔 (클러스터 앞부분의 누적 ACMR 이 클러스터 전체 ACMR * threshold 이하가 되는 지점마다)
+	2. 클러스터마다 면적 가중 중심점과 평균 법선을 구해 dot(중심점 - 메시 중심점, 법선) 이 큰 순서로 정렬
+	   (메시 바깥쪽을 향한 클러스터를 먼저 그려서 뒤쪽 면이 depth test 에서 일찍 걸러지도록)
+*/
+void reorderOverdraw(const Vertex* vertices, uint32_t vertexCount, uint32_t* indices, uint32_t indexCount,
+					 const std::vector<uint32_t>& hardBoundaries, uint32_t cacheSize, float threshold) {
+	uint32_t triangleCount = indexCount / 3;
+	if (triangleCount == 0) {
+		return;
+	}
+
+	// 1. 소프트 경계 추가
+	std::vector<uint32_t> boundaries;
+	VertexCacheSimulator cache(vertexCount, cacheSize);
+	for (size_t c = 0; c < hardBoundaries.size(); c++) {
+		uint32_t start = hardBoundaries[c];
+		uint32_t end = c + 1 < hardBoundaries.size() ? hardBoundaries[c + 1] : triangleCount;
+
+		uint32_t clusterMisses = 0;
+		cache.reset();
+		for (uint32_t t = start; t < end; t++) {
+			clusterMisses += cache.accessTriangle(indices + t * 3);
+		}
+		float clusterThreshold = threshold * clusterMisses / float(end - start);
+
+		boundaries.push_back(start);
+		uint32_t runningMisses = 0;
+		uint32_t runningTriangles = 0;
+		cache.reset();
+		for (uint32_t t = start; t < end; t++) {
+			runningMisses += cache.accessTriangle(indices + t * 3);
+			runningTriangles++;
+			if (t + 1 < end && runningMisses <= clusterThreshold * runningTriangles) {
+				boundaries.push_back(t + 1);
+				runningMisses = 0;
+				runningTriangles = 0;
+				cache.reset();
+			}
+		}
+	}
+
+	// 2. 클러스터별 정렬 키 계산
+	struct Cluster {
+		uint32_t start;
+		uint32_t end;
+		glm::vec3 centroid;
+		glm::vec3 normal;
+		float sortKey;
+	};
+	std::vector<Cluster> clusters(boundaries.size());
+
+	glm::vec3 meshCentroid(0.0f);
+	float meshArea = 0.0f;
+	for (size_t c = 0; c < boundaries.size(); c++) {
+		Cluster& cluster = clusters[c];
+		cluster.start = boundaries[c];
+		cluster.end = c + 1 < boundaries.size() ? boundaries[c + 1] : triangleCount;
+		cluster.centroid = glm::vec3(0.0f);
+		cluster.normal = glm::vec3(0.0f);
+
+		float clusterArea = 0.0f;
+		for (uint32_t t = cluster.start; t < cluster.end; t++) {
+			const glm::vec3& p0 = vertices[indices[t * 3]].pos;
+			const glm::vec3& p1 = vertices[indices[t * 3 + 1]].pos;
+			const glm::vec3& p2 = vertices[indices[t * 3 + 2]].pos;
+			glm::vec3 areaNormal = glm::cross(p1 - p0, p2 - p0);	// 길이 = 면적 * 2
+			float area = glm::length(areaNormal);
+
+			cluster.centroid += (p0 + p1 + p2) * (area / 3.0f);
+			cluster.normal += areaNormal;
+			clusterArea += area;
+		}
+
+		meshCentroid += cluster.centroid;
+		meshArea += clusterArea;
+		cluster.centroid = clusterArea > 0.0f ? cluster.centroid / clusterArea : vertices[indices[cluster.start * 3]].pos;
+		float normalLength = glm::length(cluster.normal);
+		cluster.normal = normalLength > 0.0f ? cluster.normal / normalLength : glm::vec3(0.0f);
+	}
+	if (meshArea > 0.0f) {
+		meshCentroid = meshCentroid / meshArea;
+	}
+
+	for (Cluster& cluster : clusters) {
+		cluster.sortKey = glm::dot(cluster.centroid - meshCentroid, cluster.normal);
+	}
+	std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& a, const Cluster& b) {
+		return a.sortKey > b.sortKey;
+	});
+
+	// 3. 정렬된 클러스터 순서로 인덱스 다시 기록
+	std::vector<uint32_t> source(indices, indices + indexCount);
+	uint32_t outputCount = 0;
+	for (const Cluster& cluster : clusters) {
+		uint32_t count = (cluster.end - cluster.start) * 3;
+		std::copy(source.begin() + cluster.start * 3, source.begin() + cluster.start * 3 + count, indices + outputCount);
+		outputCount += count;
+	}
+}
+
+// 정점을 첫 사용 순서로 재배치 (참조되지 않는 정점은 뒤쪽에 원래 순서대로)
+void reorderVertexFetch(Vertex* vertices, uint32_t vertexCount, uint32_t* indices, uint32_t indexCount) {
+	std::vector<uint32_t> remap(vertexCount, INVALID_VERTEX);
+	uint32_t nextVertex = 0;
+	for (uint32_t i = 0; i < indexCount; i++) {
+		uint32_t& newIndex = remap[indices[i]];
+		if (newIndex == INVALID_VERTEX) {
+			newIndex = nextVertex++;
+		}
+		indices[i] = newIndex;
+	}
+	for (uint32_t v = 0; v < vertexCount; v++) {
+		if (remap[v] == INVALID_VERTEX) {
+			remap[v] = nextVertex++;
+		}
+	}
+
+	std::vector<Vertex> source(vertices, vertices + vertexCount);
+	for (uint32_t v = 0; v < vertexCount; v++) {
+		vertices[remap[v]] = source[v];
+	}
+}
+
+} // namespace
+
+VertexCacheStats analyzeVertexCache(const MeshData& meshData, uint32_t cacheSize) {
+	VertexCacheStats stats;
+	uint64_t misses = 0;
+	uint64_t triangles = 0;
+	uint64_t vertices = 0;
+
+	for (const SubMesh& subMesh : meshData.subMeshes) {
+		VertexCacheSimulator cache(subMesh.vertexCount, cacheSize);
+		const uint32_t* indices = meshData.indices.data() + subMesh.firstIndex;
+		for (uint32_t i = 0; i + 2 < subMesh.indexCount; i += 3) {
+			misses += cache.accessTriangle(indices + i);
+		}
+		triangles += subMesh.indexCount / 3;
+		vertices += subMesh.vertexCount;
+	}
+
+	stats.acmr = triangles > 0 ? float(misses) / triangles : 0.0f;
+	stats.atvr = vertices > 0 ? float(misses) / vertices : 0.0f;
+	return stats;
+}
+
+void optimizeVertexCache(MeshData& meshData, ThreadPool* pool) {
+	parallelFor(pool, static_cast<uint32_t>(meshData.subMeshes.size()), [&meshData](uint32_t i) {
+		const SubMesh& subMesh = meshData.subMeshes[i];
+		uint32_t* indices = meshData.indices.data() + subMesh.firstIndex;
+
+		std::vector<uint32_t> source(indices, indices + subMesh.indexCount);
+		std::vector<uint32_t> hardBoundaries;
+		tipsify(source.data(), subMesh.indexCount, subMesh.vertexCount, VERTEX_CACHE_SIZE, indices, hardBoundaries);
+	});
+}
+
+void optimizeOverdraw(MeshData& meshData, float threshold, ThreadPool* pool) {
+	parallelFor(pool, static_cast<uint32_t>(meshData.subMeshes.size()), [&meshData, threshold](uint32_t i) {
+		const SubMesh& subMesh = meshData.subMeshes[i];
+		uint32_t* indices = meshData.indices.data() + subMesh.firstIndex;
+
+		// 클러스터 경계를 얻기 위해 Tipsify 를 다시 실행 (이미 정렬된 순서면 결과는 거의 같음)
+		std::vector<uint32_t> source(indices, indices + subMesh.indexCount);
+		std::vector<uint32_t> hardBoundaries;
+		tipsify(source.data(), subMesh.indexCount, subMesh.vertexCount, VERTEX_CACHE_SIZE, indices, hardBoundaries);
+
+		reorderOverdraw(meshData.vertices.data() + subMesh.baseVertex, subMesh.vertexCount, indices, subMesh.indexCount,
+						hardBoundaries, VERTEX_CACHE_SIZE, threshold);
+	});
+}
+
+void optimizeVertexFetch(MeshData& meshData, ThreadPool* pool) {
+	parallelFor(pool, static_cast<uint32_t>(meshData.subMeshes.size()), [&meshData](uint32_t i) {
+		const SubMesh& subMesh = meshData.subMeshes[i];
+		reorderVertexFetch(meshData.vertices.data() + subMesh.baseVertex, subMesh.vertexCount,
+						   meshData.indices.data() + subMesh.firstIndex, subMesh.indexCount);
+	});
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "mesh.h"
+
+#include <cstdint>
+
+class ThreadPool;
+
+/*
+	[인덱스 / 정점 순서 최적화]
+	GPU 성능에 영향을 주는 순서를 서브 메시 단위로 다시 정렬한다. (삼각형 / 정점 집합은 그대로)
+	1. optimizeVertexCache  : Tipsify 로 삼각형 순서를 바꿔 post-transform 정점 캐시 재사용률 향상
+	2. optimizeOverdraw     : Tipsify 결과를 클러스터로 나누고 바깥쪽을 향한 클러스터부터 그리도록 정렬 (overdraw 감소)
+	3. optimizeVertexFetch  : 인덱스가 처음 참조하는 순서대로 정점 배열을 다시 배치 (정점 fetch 지역성 향상)
+	실행 순서는 1 → 2 → 3 (2는 1의 결과를 사용)
+*/
+
+// 시뮬레이션에 쓰는 FIFO 정점 캐시 크기
+const uint32_t VERTEX_CACHE_SIZE = 16;
+
+// 정점 캐시 효율
+struct VertexCacheStats {
+	float acmr = 0.0f;		// 삼각형당 정점 셰이더 실행 횟수 (0.5 ~ 3.0, 낮을수록 좋음)
+	float atvr = 0.0f;		// 정점당 정점 셰이더 실행 횟수 (1.0 이 최적)
+};
+
+// FIFO 캐시를 시뮬레이션해서 전체 서브 메시의 ACMR / ATVR 계산
+VertexCacheStats analyzeVertexCache(const MeshData& meshData, uint32_t cacheSize = VERTEX_CACHE_SIZE);
+
+// 서브 메시별 Tipsify 삼각형 재정렬
+void optimizeVertexCache(MeshData& meshData, ThreadPool* pool);
+
+// 서브 메시별 overdraw 감소 정렬
+// threshold: 클러스터를 자르는 누적 ACMR 비율 (클수록 클러스터가 잘게 나뉘어 overdraw 는 줄고 ACMR 은 증가)
+void optimizeOverdraw(MeshData& meshData, float threshold, ThreadPool* pool);
+
+// 서브 메시별 정점을 첫 사용 순서로 재배치하고 인덱스 갱신
+void optimizeVertexFetch(MeshData& meshData, ThreadPool* pool);
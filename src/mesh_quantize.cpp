@@ -0,0 +1,88 @@
+#include "mesh_quantize.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// 범위 크기 (0 이면 나눗셈을 피하기 위해 1)
+float rangeScale(float minValue, float maxValue) {
+	float scale = maxValue - minValue;
+	return scale > 0.0f ? scale : 1.0f;
+}
+
+// 서브 메시 정점 범위로 복원 변환 계산
+VertexQuantization computeQuantization(const Vertex* vertices, uint32_t vertexCount) {
+	if (!GpuVertex::quantized || vertexCount == 0) {
+		return identityQuantization();
+	}
+
+	glm::vec3 minPos(std::numeric_limits<float>::max());
+	glm::vec3 maxPos(-std::numeric_limits<float>::max());
+	glm::vec2 minTexCoord(std::numeric_limits<float>::max());
+	glm::vec2 maxTexCoord(-std::numeric_limits<float>::max());
+	for (uint32_t i = 0; i < vertexCount; i++) {
+		for (int c = 0; c < 3; c++) {
+			minPos[c] = std::min(minPos[c], vertices[i].pos[c]);
+			maxPos[c] = std::max(maxPos[c], vertices[i].pos[c]);
+		}
+		for (int c = 0; c < 2; c++) {
+			minTexCoord[c] = std::min(minTexCoord[c], vertices[i].texCoord[c]);
+			maxTexCoord[c] = std::max(maxTexCoord[c], vertices[i].texCoord[c]);
+		}
+	}
+
+	VertexQuantization quantization;
+	quantization.positionOffset = glm::vec4(minPos[0], minPos[1], minPos[2], 0.0f);
+	quantization.positionScale = glm::vec4(rangeScale(minPos[0], maxPos[0]), rangeScale(minPos[1], maxPos[1]),
+										   rangeScale(minPos[2], maxPos[2]), 1.0f);
+	quantization.texCoordTransform = glm::vec4(minTexCoord[0], minTexCoord[1],
+											   rangeScale(minTexCoord[0], maxTexCoord[0]), rangeScale(minTexCoord[1], maxTexCoord[1]));
+	return quantization;
+}
+
+} // namespace
+
+void encodeGpuVertices(MeshData& meshData, ThreadPool* pool) {
+	meshData.gpuVertices.resize(meshData.vertices.size());
+
+	parallelFor(pool, static_cast<uint32_t>(meshData.subMeshes.size()), [&meshData](uint32_t i) {
+		SubMesh& subMesh = meshData.subMeshes[i];
+		const Vertex* vertices = meshData.vertices.data() + subMesh.baseVertex;
+		GpuVertex* gpuVertices = meshData.gpuVertices.data() + subMesh.baseVertex;
+
+		subMesh.quantization = computeQuantization(vertices, subMesh.vertexCount);
+		for (uint32_t v = 0; v < subMesh.vertexCount; v++) {
+			gpuVertices[v] = GpuVertex::encode(vertices[v], subMesh.quantization);
+		}
+	});
+}
+
+VertexQuantizationError measureQuantizationError(const MeshData& meshData) {
+	VertexQuantizationError error;
+	if (!GpuVertex::quantized) {
+		return error;
+	}
+
+	for (const SubMesh& subMesh : meshData.subMeshes) {
+		const VertexQuantization& quantization = subMesh.quantization;
+		for (uint32_t v = subMesh.baseVertex; v < subMesh.baseVertex + subMesh.vertexCount; v++) {
+			const Vertex& reference = meshData.vertices[v];
+			Vertex decoded = GpuVertex::decode(meshData.gpuVertices[v], quantization);
+
+			for (int c = 0; c < 3; c++) {
+				float diff = std::fabs(decoded.pos[c] - reference.pos[c]);
+				error.maxPositionError = std::max(error.maxPositionError, diff);
+				error.maxPositionSteps = std::max(error.maxPositionSteps, diff / quantization.positionScale[c] * 65535.0f);
+			}
+			for (int c = 0; c < 2; c++) {
+				float diff = std::fabs(decoded.texCoord[c] - reference.texCoord[c]);
+				error.maxTexCoordError = std::max(error.maxTexCoordError, diff);
+				error.maxTexCoordSteps = std::max(error.maxTexCoordSteps, diff / quantization.texCoordTransform[c + 2] * 65535.0f);
+			}
+		}
+	}
+	return error;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "mesh.h"
+
+class ThreadPool;
+
+/*
+	[정점 인코딩]
+	후처리가 끝난 float 정점(vertices)을 GpuVertex 레이아웃(gpuVertices)으로 변환한다.
+	양자화 레이아웃이면 서브 메시마다 pos / texCoord 범위로 복원 변환(VertexQuantization)을 계산하고,
+	복원 결과가 float 원본과 양자화 간격의 절반 이내로 일치하는지 검사할 수 있다.
+*/
+
+// 양자화 오차 (float 원본 대비 최대 오차, 단위: 양자화 간격)
+struct VertexQuantizationError {
+	float maxPositionError = 0.0f;		// 최대 pos 오차 (모델 좌표)
+	float maxPositionSteps = 0.0f;		// 최대 pos 오차 / 양자화 간격 (반올림이므로 0.5 이하여야 함)
+	float maxTexCoordError = 0.0f;		// 최대 texCoord 오차
+	float maxTexCoordSteps = 0.0f;		// 최대 texCoord 오차 / 양자화 간격
+};
+
+// 양자화 간격 대비 허용 오차 (반올림 0.5 + float 연산 오차)
+const float QUANTIZATION_ERROR_BOUND = 0.5f + 1e-2f;
+
+// 서브 메시별 복원 변환 계산 후 vertices → gpuVertices 인코딩
+void encodeGpuVertices(MeshData& meshData, ThreadPool* pool);
+
+// gpuVertices 를 복원해서 vertices 와 비교
+VertexQuantizationError measureQuantizationError(const MeshData& meshData);
@@ -0,0 +1,136 @@
+#include "mesh_weld.h"
+#include "thread_pool.h"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+const uint32_t EMPTY_SLOT = UINT32_MAX;
+
+// Vertex 를 구성하는 float 개수 (pos 3 + color 3 + texCoord 2)
+const uint32_t VERTEX_KEY_SIZE = sizeof(Vertex) / sizeof(float);
+static_assert(sizeof(Vertex) == VERTEX_KEY_SIZE * sizeof(float), "Vertex must consist of floats only");
+
+// 해시 / 비교에 쓰는 정점 키
+struct VertexKey {
+	uint32_t values[VERTEX_KEY_SIZE];
+
+	bool operator==(const VertexKey& other) const {
+		return memcmp(values, other.values, sizeof(values)) == 0;
+	}
+};
+
+// 정점 → 키 변환 (exact: float 비트 패턴, epsilon: 격자 좌표)
+VertexKey makeVertexKey(const Vertex& vertex, float inverseEpsilon) {
+	float components[VERTEX_KEY_SIZE];
+	memcpy(components, &vertex, sizeof(components));
+
+	VertexKey key;
+	for (uint32_t i = 0; i < VERTEX_KEY_SIZE; i++) {
+		if (inverseEpsilon > 0.0f) {
+			key.values[i] = static_cast<uint32_t>(static_cast<int32_t>(std::lround(components[i] * inverseEpsilon)));
+		} else {
+			float value = components[i] == 0.0f ? 0.0f : components[i];
+			memcpy(&key.values[i], &value, sizeof(value));
+		}
+	}
+	return key;
+}
+
+// 키 해시 (32bit 값마다 곱셈 + 회전으로 섞음)
+uint32_t hashVertexKey(const VertexKey& key) {
+	uint32_t hash = 2166136261u;
+	for (uint32_t i = 0; i < VERTEX_KEY_SIZE; i++) {
+		uint32_t k = key.values[i] * 0xcc9e2d51u;
+		k = (k << 15) | (k >> 17);
+		hash ^= k * 0x1b873593u;
+		hash = ((hash << 13) | (hash >> 19)) * 5 + 0xe6546b64u;
+	}
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bu;
+	hash ^= hash >> 13;
+	return hash;
+}
+
+// 정점 수의 2배 이상인 2의 거듭제곱 (load factor 0.5 이하 유지)
+uint32_t tableCapacity(uint32_t vertexCount) {
+	uint32_t capacity = 16;
+	while (capacity < vertexCount * 2) {
+		capacity <<= 1;
+	}
+	return capacity;
+}
+
+// 서브 메시 1개 병합: 고유 정점은 uniqueVertices 에, 인덱스는 제자리에서 다시 매핑
+void weldSubMesh(const Vertex* vertices, uint32_t vertexCount, uint32_t* indices, uint32_t indexCount,
+				 float inverseEpsilon, std::vector<Vertex>& uniqueVertices) {
+	uint32_t capacity = tableCapacity(vertexCount);
+	uint32_t mask = capacity - 1;
+	std::vector<uint32_t> table(capacity, EMPTY_SLOT);	// 고유 정점 번호
+	std::vector<VertexKey> uniqueKeys;
+	std::vector<uint32_t> remap(vertexCount);			// 원래 정점 번호 → 고유 정점 번호
+	uniqueKeys.reserve(vertexCount);
+	uniqueVertices.clear();
+	uniqueVertices.reserve(vertexCount);
+
+	for (uint32_t i = 0; i < vertexCount; i++) {
+		VertexKey key = makeVertexKey(vertices[i], inverseEpsilon);
+
+		// 빈 칸이나 같은 키를 찾을 때까지 선형 탐색
+		uint32_t slot = hashVertexKey(key) & mask;
+		while (table[slot] != EMPTY_SLOT && !(uniqueKeys[table[slot]] == key)) {
+			slot = (slot + 1) & mask;
+		}
+
+		if (table[slot] == EMPTY_SLOT) {
+			table[slot] = static_cast<uint32_t>(uniqueVertices.size());
+			uniqueKeys.push_back(key);
+			uniqueVertices.push_back(vertices[i]);
+		}
+		remap[i] = table[slot];
+	}
+
+	for (uint32_t i = 0; i < indexCount; i++) {
+		indices[i] = remap[indices[i]];
+	}
+}
+
+} // namespace
+
+MeshWeldStats weldVertices(MeshData& meshData, float epsilon, ThreadPool* pool) {
+	MeshWeldStats stats;
+	stats.vertexCountBefore = static_cast<uint32_t>(meshData.vertices.size());
+
+	float inverseEpsilon = epsilon > 0.0f ? 1.0f / epsilon : 0.0f;
+	uint32_t subMeshCount = static_cast<uint32_t>(meshData.subMeshes.size());
+
+	// 1. 서브 메시별 병합 (인덱스는 서브 메시 구간마다 독립이므로 병렬 처리 가능)
+	std::vector<std::vector<Vertex>> uniqueVertices(subMeshCount);
+	parallelFor(pool, subMeshCount, [&](uint32_t i) {
+		const SubMesh& subMesh = meshData.subMeshes[i];
+		weldSubMesh(meshData.vertices.data() + subMesh.baseVertex, subMesh.vertexCount,
+					meshData.indices.data() + subMesh.firstIndex, subMesh.indexCount,
+					inverseEpsilon, uniqueVertices[i]);
+	});
+
+	// 2. 줄어든 정점 배열로 다시 채우고 baseVertex 갱신
+	uint32_t totalVertices = 0;
+	for (uint32_t i = 0; i < subMeshCount; i++) {
+		totalVertices += static_cast<uint32_t>(uniqueVertices[i].size());
+	}
+
+	std::vector<Vertex> vertices;
+	vertices.reserve(totalVertices);
+	for (uint32_t i = 0; i < subMeshCount; i++) {
+		SubMesh& subMesh = meshData.subMeshes[i];
+		subMesh.baseVertex = static_cast<uint32_t>(vertices.size());
+		subMesh.vertexCount = static_cast<uint32_t>(uniqueVertices[i].size());
+		vertices.insert(vertices.end(), uniqueVertices[i].begin(), uniqueVertices[i].end());
+	}
+	meshData.vertices.swap(vertices);
+
+	stats.vertexCountAfter = totalVertices;
+	return stats;
+}
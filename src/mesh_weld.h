@@ -0,0 +1,25 @@
+#pragma once
+
+#include "mesh.h"
+
+#include <cstdint>
+
+class ThreadPool;
+
+/*
+	[정점 병합 (weld)]
+	OBJ 임포트 결과는 face 꼭짓점마다 정점이 따로 만들어져 pos / color / texCoord가 같은 정점이 많다.
+	서브 메시마다 Vertex 전체를 해시해서 같은 정점을 하나로 합치고 인덱스를 다시 매핑한다.
+	1. epsilon == 0 : 비트 단위로 같은 정점만 병합 (-0.0 과 0.0 은 같은 값으로 취급)
+	2. epsilon > 0  : 각 성분을 epsilon 간격 격자로 양자화해서 같은 칸에 들어온 정점 병합
+	해시 테이블은 정점 수의 2배 이상 2의 거듭제곱 크기로 한 번에 할당하는 open addressing(linear probing) 방식
+*/
+
+// 병합 전후 정점 수
+struct MeshWeldStats {
+	uint32_t vertexCountBefore = 0;
+	uint32_t vertexCountAfter = 0;
+};
+
+// meshData의 서브 메시별 정점 병합 (pool이 있으면 서브 메시 단위로 병렬 처리)
+MeshWeldStats weldVertices(MeshData& meshData, float epsilon, ThreadPool* pool);
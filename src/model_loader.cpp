@@ -0,0 +1,314 @@
+#include "model_loader.h"
+#include "mesh_index.h"
+#include "mesh_lod.h"
+#include "mesh_meshlet.h"
+#include "mesh_optimize.h"
+#include "mesh_quantize.h"
+#include "mesh_weld.h"
+#include "obj_loader.h"
+#include "thread_pool.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// 작업 1개가 처리하는 정점 / face 개수 (정점 하나짜리 큰 mesh도 여러 스레드로 나뉘도록)
+const uint32_t MESH_CHUNK_SIZE = 16384;
+
+// 네이티브 OBJ 로더가 그대로 재현하는 임포트 플래그 (다른 플래그가 있으면 Assimp 사용)
+const uint32_t OBJ_LOADER_IMPORT_FLAGS = aiProcess_Triangulate | aiProcess_FlipUVs;
+
+// mesh 일부 구간의 변환 작업
+struct MeshChunk {
+	const aiMesh* mesh;
+	uint32_t subMeshIndex;			// 출력할 서브 메시 (사전 패스 이후 확정)
+	uint32_t first;					// mesh 내 시작 정점 / face
+	uint32_t count;					// 처리할 정점 / face 개수
+	uint32_t outputOffset;			// 서브 메시 구간 내 출력 시작 위치 (face 청크는 삼각형 수 누적으로 계산)
+	uint32_t triangleCount;			// face 청크의 삼각형 수
+};
+
+// node 트리를 순회하며 그릴 mesh 인덱스 수집 (여러 node가 공유하는 mesh는 한 번만)
+void collectMeshes(const aiNode* node, std::vector<uint32_t>& meshIndices, std::vector<bool>& visited) {
+	for (uint32_t i = 0; i < node->mNumMeshes; i++) {
+		uint32_t meshIndex = node->mMeshes[i];
+		if (!visited[meshIndex]) {
+			visited[meshIndex] = true;
+			meshIndices.push_back(meshIndex);
+		}
+	}
+
+	// 자식 노드 처리
+	for (uint32_t i = 0; i < node->mNumChildren; i++) {
+		collectMeshes(node->mChildren[i], meshIndices, visited);
+	}
+}
+
+// mesh를 MESH_CHUNK_SIZE 단위로 나눈 청크 목록 추가
+void splitChunks(const aiMesh* mesh, uint32_t elementCount, std::vector<MeshChunk>& chunks) {
+	for (uint32_t first = 0; first < elementCount; first += MESH_CHUNK_SIZE) {
+		MeshChunk chunk{};
+		chunk.mesh = mesh;
+		chunk.first = first;
+		chunk.count = std::min(MESH_CHUNK_SIZE, elementCount - first);
+		chunks.push_back(chunk);
+	}
+}
+
+// 정점 청크 변환 (pos, texCoord, color)
+void convertVertices(const MeshChunk& chunk, Vertex* output) {
+	const aiMesh* mesh = chunk.mesh;
+	const aiVector3D* texCoords = mesh->mTextureCoords[0];
+	for (uint32_t i = 0; i < chunk.count; i++) {
+		uint32_t src = chunk.first + i;
+		Vertex& v = output[i];
+		v.pos = glm::vec3(mesh->mVertices[src].x, mesh->mVertices[src].y, mesh->mVertices[src].z);
+		v.texCoord = texCoords ? glm::vec2(texCoords[src].x, texCoords[src].y) : glm::vec2(0.0f, 0.0f);
+		v.color = {1.0f, 1.0f, 1.0f};
+	}
+}
+
+// face 청크 변환 (삼각형 face만, 인덱스는 mesh 기준 상대값)
+void convertFaces(const MeshChunk& chunk, uint32_t* output) {
+	const aiMesh* mesh = chunk.mesh;
+	uint32_t count = 0;
+	for (uint32_t i = chunk.first; i < chunk.first + chunk.count; i++) {
+		const aiFace& face = mesh->mFaces[i];
+		if (face.mNumIndices != 3) {
+			continue;
+		}
+		output[count++] = face.mIndices[0];
+		output[count++] = face.mIndices[1];
+		output[count++] = face.mIndices[2];
+	}
+}
+
+// 확장자가 .obj 인지 (대소문자 무시)
+bool isObjPath(const std::string& path) {
+	if (path.size() < 4) {
+		return false;
+	}
+	std::string extension = path.substr(path.size() - 4);
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	return extension == ".obj";
+}
+
+} // namespace
+
+void buildMeshData(const aiScene* scene, MeshData& meshData, ThreadPool* pool) {
+	// 그릴 mesh 목록 수집
+	std::vector<uint32_t> meshIndices;
+	std::vector<bool> visited(scene->mNumMeshes, false);
+	collectMeshes(scene->mRootNode, meshIndices, visited);
+
+	// 청크 분할
+	std::vector<MeshChunk> faceChunks;
+	for (uint32_t meshIndex : meshIndices) {
+		const aiMesh* mesh = scene->mMeshes[meshIndex];
+		splitChunks(mesh, mesh->mNumFaces, faceChunks);
+	}
+
+	// 1. face 청크별 삼각형 수 계산 (병렬)
+	parallelFor(pool, static_cast<uint32_t>(faceChunks.size()), [&faceChunks](uint32_t i) {
+		MeshChunk& chunk = faceChunks[i];
+		uint32_t triangleCount = 0;
+		for (uint32_t f = chunk.first; f < chunk.first + chunk.count; f++) {
+			if (chunk.mesh->mFaces[f].mNumIndices == 3) {
+				triangleCount++;
+			}
+		}
+		chunk.triangleCount = triangleCount;
+	});
+
+	// 2. 서브 메시 구간 및 청크별 출력 위치 계산 (삼각형이 없는 mesh는 제외)
+	meshData = MeshData();
+	meshData.subMeshes.reserve(meshIndices.size());
+	std::vector<MeshChunk> vertexChunks;
+	std::vector<MeshChunk> indexChunks;
+	indexChunks.reserve(faceChunks.size());
+
+	uint32_t totalVertices = 0;
+	uint32_t totalIndices = 0;
+	size_t chunkIndex = 0;
+	for (uint32_t meshIndex : meshIndices) {
+		const aiMesh* mesh = scene->mMeshes[meshIndex];
+
+		// 이 mesh의 face 청크에 출력 위치 부여
+		uint32_t subMeshIndex = static_cast<uint32_t>(meshData.subMeshes.size());
+		uint32_t meshIndexCount = 0;
+		size_t firstIndexChunk = indexChunks.size();
+		for (; chunkIndex < faceChunks.size() && faceChunks[chunkIndex].mesh == mesh; chunkIndex++) {
+			MeshChunk chunk = faceChunks[chunkIndex];
+			if (chunk.triangleCount == 0) {
+				continue;
+			}
+			chunk.subMeshIndex = subMeshIndex;
+			chunk.outputOffset = meshIndexCount;
+			meshIndexCount += chunk.triangleCount * 3;
+			indexChunks.push_back(chunk);
+		}
+		if (meshIndexCount == 0) {
+			indexChunks.resize(firstIndexChunk);
+			continue;
+		}
+
+		SubMesh subMesh{};
+		subMesh.baseVertex = totalVertices;
+		subMesh.vertexCount = mesh->mNumVertices;
+		subMesh.firstIndex = totalIndices;
+		subMesh.indexCount = meshIndexCount;
+		subMesh.materialIndex = mesh->mMaterialIndex;
+		meshData.subMeshes.push_back(subMesh);
+
+		// 정점 청크 (출력 위치 = 청크 시작 정점)
+		size_t firstVertexChunk = vertexChunks.size();
+		splitChunks(mesh, mesh->mNumVertices, vertexChunks);
+		for (size_t i = firstVertexChunk; i < vertexChunks.size(); i++) {
+			vertexChunks[i].subMeshIndex = subMeshIndex;
+			vertexChunks[i].outputOffset = vertexChunks[i].first;
+		}
+
+		totalVertices += subMesh.vertexCount;
+		totalIndices += subMesh.indexCount;
+	}
+
+	// 병합 배열 1회 할당
+	meshData.vertices.resize(totalVertices);
+	meshData.indices.resize(totalIndices);
+
+	// 3. 정점 / face 청크 변환 (각 청크는 겹치지 않는 구간에만 기록하므로 lock 불필요)
+	uint32_t vertexChunkCount = static_cast<uint32_t>(vertexChunks.size());
+	uint32_t jobCount = vertexChunkCount + static_cast<uint32_t>(indexChunks.size());
+	parallelFor(pool, jobCount, [&](uint32_t i) {
+		if (i < vertexChunkCount) {
+			const MeshChunk& chunk = vertexChunks[i];
+			const SubMesh& subMesh = meshData.subMeshes[chunk.subMeshIndex];
+			convertVertices(chunk, meshData.vertices.data() + subMesh.baseVertex + chunk.outputOffset);
+		} else {
+			const MeshChunk& chunk = indexChunks[i - vertexChunkCount];
+			const SubMesh& subMesh = meshData.subMeshes[chunk.subMeshIndex];
+			convertFaces(chunk, meshData.indices.data() + subMesh.firstIndex + chunk.outputOffset);
+		}
+	});
+}
+
+void processMeshData(MeshData& meshData, const MeshProcessOptions& options, ThreadPool* pool) {
+	// 정점 병합 (정점 수 / vertexBuffer 업로드 크기 감소량 출력)
+	if (options.flags & MESH_PROCESS_WELD_VERTICES) {
+		MeshWeldStats stats = weldVertices(meshData, options.weldEpsilon, pool);
+		float ratio = stats.vertexCountBefore > 0 ? 100.0f * stats.vertexCountAfter / stats.vertexCountBefore : 100.0f;
+		std::cout << "[processMeshData] weld: " << stats.vertexCountBefore << " -> " << stats.vertexCountAfter << " vertices ("
+				  << ratio << "%), vertex upload " << stats.vertexCountBefore * sizeof(Vertex) / 1024 << " KB -> "
+				  << stats.vertexCountAfter * sizeof(Vertex) / 1024 << " KB" << std::endl;
+	}
+
+	// 삼각형 / 정점 순서 최적화 (전후 ACMR / ATVR 출력)
+	const uint32_t reorderFlags = MESH_PROCESS_VERTEX_CACHE | MESH_PROCESS_OVERDRAW | MESH_PROCESS_VERTEX_FETCH;
+	if (options.flags & reorderFlags) {
+		VertexCacheStats before = analyzeVertexCache(meshData);
+
+		if (options.flags & MESH_PROCESS_VERTEX_CACHE) {
+			optimizeVertexCache(meshData, pool);
+		}
+		if (options.flags & MESH_PROCESS_OVERDRAW) {
+			optimizeOverdraw(meshData, options.overdrawThreshold, pool);
+		}
+		if (options.flags & MESH_PROCESS_VERTEX_FETCH) {
+			optimizeVertexFetch(meshData, pool);
+		}
+
+		VertexCacheStats after = analyzeVertexCache(meshData);
+		std::cout << "[processMeshData] reorder (cache " << VERTEX_CACHE_SIZE << "): ACMR " << before.acmr << " -> " << after.acmr
+				  << ", ATVR " << before.atvr << " -> " << after.atvr << std::endl;
+	}
+
+	// 업로드용 정점 인코딩 (양자화 오차가 허용 범위를 넘으면 예외)
+	encodeGpuVertices(meshData, pool);
+	VertexQuantizationError error = measureQuantizationError(meshData);
+	std::cout << "[processMeshData] encode: " << sizeof(Vertex) << " -> " << sizeof(GpuVertex) << " bytes/vertex, vertex upload "
+			  << meshData.vertices.size() * sizeof(Vertex) / 1024 << " KB -> " << meshData.gpuVertices.size() * sizeof(GpuVertex) / 1024
+			  << " KB, max error pos " << error.maxPositionError << " (" << error.maxPositionSteps << " steps), uv "
+			  << error.maxTexCoordError << " (" << error.maxTexCoordSteps << " steps)" << std::endl;
+	if (error.maxPositionSteps > QUANTIZATION_ERROR_BOUND || error.maxTexCoordSteps > QUANTIZATION_ERROR_BOUND) {
+		throw std::runtime_error("failed to quantize vertices within error bound!");
+	}
+
+	// 업로드용 인덱스 인코딩 (서브 메시별 16 / 32bit 선택)
+	size_t indexBytesBefore = meshData.indices.size() * sizeof(uint32_t);
+	MeshIndexStats indexStats = encodeGpuIndices(meshData);
+	size_t indexBytesAfter = meshData.gpuIndices16.size() * sizeof(uint16_t) + meshData.gpuIndices32.size() * sizeof(uint32_t);
+	std::cout << "[processMeshData] index: " << indexStats.subMeshCountBefore << " -> " << indexStats.index16SubMeshCount + indexStats.index32SubMeshCount
+			  << " sub-meshes (" << indexStats.index16SubMeshCount << " x 16bit, " << indexStats.index32SubMeshCount << " x 32bit, "
+			  << indexStats.splitSubMeshCount << " split, " << indexStats.duplicatedVertexCount << " vertices duplicated), index upload " << indexBytesBefore / 1024 << " KB -> " << indexBytesAfter / 1024 << " KB" << std::endl;
+
+	// 서브 메시별 LOD 체인 생성 (LOD 인덱스는 인덱스 배열 끝에 추가되므로 메시렛이 쓰는 LOD 0 구간은 그대로)
+	if (options.flags & MESH_PROCESS_LODS) {
+		MeshLodStats lodStats = buildMeshLods(meshData, pool);
+		std::cout << "[processMeshData] lod: " << lodStats.levelCount << " levels, triangles";
+		for (uint32_t level = 0; level < lodStats.levelCount; level++) {
+			std::cout << (level == 0 ? " " : " -> ") << lodStats.triangleCounts[level];
+		}
+		std::cout << ", max error";
+		for (uint32_t level = 1; level < lodStats.levelCount; level++) {
+			std::cout << " " << lodStats.maxErrors[level];
+		}
+		std::cout << std::endl;
+	}
+
+	// 컬링용 메시렛 생성 (인덱스 구간 / 제한 / 바운딩 구 검사에 실패하면 예외)
+	if (options.flags & MESH_PROCESS_MESHLETS) {
+		MeshletStats meshletStats = buildMeshlets(meshData, pool);
+		std::cout << "[processMeshData] meshlets: " << meshletStats.meshletCount << " meshlets (max " << MAX_MESHLET_VERTICES << " vertices / "
+				  << MAX_MESHLET_TRIANGLES << " triangles), average " << meshletStats.averageVertices << " vertices / "
+				  << meshletStats.averageTriangles << " triangles, " << meshletStats.coneMeshletCount << " with backface cone" << std::endl;
+		if (!validateMeshlets(meshData)) {
+			throw std::runtime_error("failed to build meshlets!");
+		}
+	}
+}
+
+void importModel(const std::string& path, uint32_t importFlags, const MeshProcessOptions& options, MeshData& meshData, ThreadPool* pool) {
+	// OBJ 는 네이티브 로더로 바로 MeshData 생성
+	if (isObjPath(path) && importFlags == OBJ_LOADER_IMPORT_FLAGS) {
+		loadObj(path, meshData, pool);
+		processMeshData(meshData, options, pool);
+		return;
+	}
+
+	Assimp::Importer importer;
+	// scene 구조체 받아오기
+	const aiScene* scene = importer.ReadFile(path, importFlags);
+
+	// scene load 오류 처리
+	if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
+		throw std::runtime_error("failed to load obj file!");
+	}
+
+	buildMeshData(scene, meshData, pool);
+	processMeshData(meshData, options, pool);
+}
+
+void collectMaterialTextures(const aiScene* scene, const std::string& modelPath, std::vector<std::string>& paths) {
+	std::string directory = modelPath.substr(0, modelPath.find_last_of("/\\") + 1);
+	for (uint32_t i = 0; i < scene->mNumMaterials; i++) {
+		const aiMaterial* material = scene->mMaterials[i];
+		for (uint32_t j = 0; j < material->GetTextureCount(aiTextureType_DIFFUSE); j++) {
+			aiString texturePath;
+			if (material->GetTexture(aiTextureType_DIFFUSE, j, &texturePath) != AI_SUCCESS || texturePath.length == 0 || texturePath.C_Str()[0] == '*') {
+				continue;
+			}
+			std::string path = directory + texturePath.C_Str();
+			if (std::find(paths.begin(), paths.end(), path) == paths.end()) {
+				paths.push_back(path);
+			}
+		}
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "mesh.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct aiScene;
+class ThreadPool;
+
+/*
+	[모델 로더]
+	Assimp scene의 모든 mesh를 하나의 정점 / 인덱스 배열(MeshData)로 병합한다.
+	1. 노드 트리를 순회하며 그릴 mesh 목록 수집
+	2. mesh를 고정 크기 청크로 나누고 청크별 삼각형 수를 병렬로 계산
+	3. 청크별 출력 구간을 미리 계산한 뒤 각 청크가 자기 구간에만 기록 (lock 없이 병렬 변환)
+	4. MeshProcessOptions 에서 켠 후처리 단계 실행 (정점 병합 등)
+	5. float 정점을 GpuVertex 레이아웃으로, 인덱스를 서브 메시별 16 / 32bit 로 인코딩
+	6. 켜져 있으면 서브 메시별 LOD 체인 생성 (LOD 인덱스는 인덱스 배열 끝에 추가)
+	7. 켜져 있으면 서브 메시를 컬링용 메시렛으로 분할
+*/
+
+// scene → MeshData 변환 (pool이 nullptr 이면 호출 스레드에서 처리)
+void buildMeshData(const aiScene* scene, MeshData& meshData, ThreadPool* pool);
+
+// 켜진 후처리 단계를 순서대로 실행하고 단계별 결과 출력
+void processMeshData(MeshData& meshData, const MeshProcessOptions& options, ThreadPool* pool);
+
+// 모델 파일 임포트 후 MeshData 변환 + 후처리 (OBJ 는 네이티브 로더, 그 외는 Assimp / 실패시 예외 발생)
+void importModel(const std::string& path, uint32_t importFlags, const MeshProcessOptions& options, MeshData& meshData, ThreadPool* pool);
+
+// scene 재질이 참조하는 diffuse 텍스처 경로 (중복 제거, 모델 파일 폴더 기준 경로, 내장 텍스처 "*n" 은 제외)
+void collectMaterialTextures(const aiScene* scene, const std::string& modelPath, std::vector<std::string>& paths);
@@ -0,0 +1,674 @@
+#include "obj_loader.h"
+#include "mapped_file.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#if defined(_M_X64) || defined(__SSE2__)
+	#include <emmintrin.h>
+	#define OBJ_LOADER_SSE2
+#endif
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+namespace {
+
+// 병렬 파싱 청크 크기 (청크 경계는 다음 줄 시작으로 맞춤)
+const size_t OBJ_CHUNK_SIZE = 1 << 20;
+
+// 재질 번호 0 (Assimp 기본 재질 이름)
+const char* const DEFAULT_MATERIAL_NAME = "DefaultMaterial";
+
+const uint32_t NO_INDEX = UINT32_MAX;
+
+// 정수부 / 인덱스 최대 자릿수 (넘으면 파싱 실패)
+const uint32_t MAX_INTEGER_DIGITS = 19;
+const uint32_t MAX_INDEX_DIGITS = 10;
+
+// 소수부는 Assimp fast_atof 와 같이 앞 15 자리까지만 읽고 자릿수별 배율을 곱함
+const uint32_t MAX_FRACTION_DIGITS = 15;
+const double FRACTION_SCALES[MAX_FRACTION_DIGITS + 1] = {
+	0.0, 0.1, 0.01, 0.001, 0.0001, 0.00001, 0.000001, 0.0000001, 0.00000001, 0.000000001,
+	0.0000000001, 0.00000000001, 0.000000000001, 0.0000000000001, 0.00000000000001, 0.000000000000001
+};
+
+// 구간을 시작하게 만든 상태 변경 문장
+enum ObjStatement : uint8_t {
+	OBJ_STATEMENT_NONE,				// 청크 시작 (이전 청크의 상태를 그대로 이어감)
+	OBJ_STATEMENT_OBJECT,			// o / g
+	OBJ_STATEMENT_MATERIAL,			// usemtl
+	OBJ_STATEMENT_MATERIAL_LIBRARY	// mtllib
+};
+
+// 청크 안에서 상태 변경 없이 이어지는 face 구간
+struct ObjRun {
+	ObjStatement statement;
+	std::string name;				// 오브젝트 / 재질 / 재질 파일 이름
+	uint32_t firstFace;
+	uint32_t faceCount;
+	uint32_t firstCorner;
+	uint32_t cornerCount;
+	uint32_t triangleCount;
+	bool hasTexCoords;				// texCoord 가 있는 face 포함 여부
+};
+
+// face 꼭짓점 (전역 위치 / texCoord 번호, texCoord 가 없으면 NO_INDEX)
+struct ObjCorner {
+	uint32_t position;
+	uint32_t texCoord;
+};
+
+// 음수(상대) 인덱스 (청크 시작 번호가 확정된 뒤 offset 을 더해서 채움)
+struct ObjRelativeIndex {
+	uint32_t corner;
+	int64_t offset;					// 청크 첫 요소 기준 번호 (이전 청크를 가리키면 음수)
+	bool texCoord;
+};
+
+// 청크 1 개의 파싱 결과
+struct ObjChunk {
+	const char* begin;
+	const char* end;
+	std::vector<glm::vec3> positions;
+	std::vector<glm::vec2> texCoords;
+	std::vector<ObjCorner> corners;
+	std::vector<uint32_t> faceSizes;	// face 별 꼭짓점 수
+	std::vector<ObjRun> runs;
+	std::vector<ObjRelativeIndex> relativeIndices;
+	uint32_t firstPosition = 0;
+	uint32_t firstTexCoord = 0;
+};
+
+// 서브 메시로 출력할 구간 (청크의 run 하나)
+struct ObjOutputRun {
+	uint32_t chunkIndex;
+	uint32_t runIndex;
+	uint32_t subMeshIndex;
+	uint32_t vertexOffset;			// 서브 메시 안에서 첫 정점 위치
+	uint32_t indexOffset;			// 서브 메시 안에서 첫 인덱스 위치
+};
+
+[[noreturn]] void failParse() {
+	throw std::runtime_error("failed to parse obj file!");
+}
+
+uint32_t countTrailingZeros(uint32_t value) {
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, value);
+	return index;
+#else
+	return static_cast<uint32_t>(__builtin_ctz(value));
+#endif
+}
+
+// 다음 '\n' 위치 (없으면 end, 16 byte 씩 비교)
+const char* findLineEnd(const char* p, const char* end) {
+#ifdef OBJ_LOADER_SSE2
+	const __m128i newline = _mm_set1_epi8('\n');
+	while (end - p >= 16) {
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+		uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+		if (mask != 0) {
+			return p + countTrailingZeros(mask);
+		}
+		p += 16;
+	}
+#endif
+	while (p < end && *p != '\n') {
+		p++;
+	}
+	return p;
+}
+
+bool isDigit(char c) {
+	return static_cast<unsigned char>(c - '0') < 10;
+}
+
+bool isSpace(char c) {
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+const char* skipSpaces(const char* p, const char* end) {
+	while (p < end && isSpace(*p)) {
+		p++;
+	}
+	return p;
+}
+
+const char* skipWord(const char* p, const char* end) {
+	while (p < end && !isSpace(*p)) {
+		p++;
+	}
+	return p;
+}
+
+// 10 의 거듭제곱 (8 자리 이하 묶음을 이어 붙일 때 사용)
+const uint64_t POWERS_OF_10[9] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+// 8 byte 중 앞에서부터 연속된 '0' ~ '9' 개수 (SWAR: 64bit 정수 1 개로 8 글자를 한 번에 검사, little endian)
+uint32_t countLeadingDigits(uint64_t chars) {
+	uint64_t high = chars & 0xF0F0F0F0F0F0F0F0ull;
+	uint64_t carried = (chars + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull;
+	uint64_t nonDigits = (high ^ 0x3030303030303030ull) | (carried ^ 0x3030303030303030ull);
+	if (nonDigits == 0) {
+		return 8;
+	}
+	uint32_t low = static_cast<uint32_t>(nonDigits);
+	return low != 0 ? countTrailingZeros(low) / 8 : 4 + countTrailingZeros(static_cast<uint32_t>(nonDigits >> 32)) / 8;
+}
+
+// 8 자리 숫자 → 정수 (자리끼리 곱셈 3 번으로 합침, 0 byte 는 앞자리 0 으로 취급)
+uint32_t parseEightDigits(uint64_t chars) {
+	chars = ((chars & 0x0F0F0F0F0F0F0F0Full) * 2561) >> 8;
+	chars = ((chars & 0x00FF00FF00FF00FFull) * 6553601) >> 16;
+	return static_cast<uint32_t>(((chars & 0x0000FFFF0000FFFFull) * 42949672960001ull) >> 32);
+}
+
+// 연속된 숫자를 최대 maxDigits 자리까지 읽고 읽은 자릿수 반환 (남은 숫자는 그대로 둠)
+// 8 byte 를 읽을 수 있으면 최대 8 자리씩 한 번에 변환 (앞의 숫자만 남기고 나머지 byte 는 밀어냄)
+uint32_t parseDigits(const char*& p, const char* end, uint32_t maxDigits, uint64_t& value) {
+	uint32_t digits = 0;
+	value = 0;
+	while (digits < maxDigits && end - p >= 8) {
+		uint64_t chars;
+		memcpy(&chars, p, sizeof(chars));
+		uint32_t count = std::min(countLeadingDigits(chars), maxDigits - digits);
+		if (count == 0) {
+			return digits;
+		}
+		value = value * POWERS_OF_10[count] + parseEightDigits(chars << (8 * (8 - count)));
+		p += count;
+		digits += count;
+		if (count < 8) {
+			return digits;
+		}
+	}
+	while (digits < maxDigits && p < end && isDigit(*p)) {
+		value = value * 10 + static_cast<uint64_t>(*p - '0');
+		p++;
+		digits++;
+	}
+	return digits;
+}
+
+/*
+	[실수 파싱]
+	Assimp fast_atoreal_move<float> 와 같은 순서로 반올림해서 결과 비트를 맞춘다.
+	정수부 → float, 소수부(최대 15 자리) → double 배율 곱 → float 로 더하고, 지수는 float pow 로 곱함
+*/
+bool parseFloat(const char*& p, const char* end, float& result) {
+	bool negative = p < end && *p == '-';
+	if (p < end && (*p == '-' || *p == '+')) {
+		p++;
+	}
+	bool fractionFirst = end - p >= 2 && p[0] == '.' && isDigit(p[1]);
+	if (!(p < end && isDigit(*p)) && !fractionFirst) {
+		return false;
+	}
+
+	uint64_t integer;
+	parseDigits(p, end, MAX_INTEGER_DIGITS, integer);
+	if (p < end && isDigit(*p)) {
+		return false;
+	}
+	float value = static_cast<float>(integer);
+
+	if (end - p >= 2 && p[0] == '.' && isDigit(p[1])) {
+		p++;
+		uint64_t fraction;
+		uint32_t digits = parseDigits(p, end, MAX_FRACTION_DIGITS, fraction);
+		while (p < end && isDigit(*p)) {
+			p++;
+		}
+		value += static_cast<float>(static_cast<double>(fraction) * FRACTION_SCALES[digits]);
+	}
+
+	if (p < end && (*p == 'e' || *p == 'E')) {
+		p++;
+		bool negativeExponent = p < end && *p == '-';
+		if (p < end && (*p == '-' || *p == '+')) {
+			p++;
+		}
+		uint64_t exponentDigits;
+		if (parseDigits(p, end, MAX_INTEGER_DIGITS, exponentDigits) == 0) {
+			return false;
+		}
+		float exponent = static_cast<float>(exponentDigits);
+		value *= std::pow(10.0f, negativeExponent ? -exponent : exponent);
+	}
+
+	result = negative ? -value : value;
+	return true;
+}
+
+// 공백 뒤의 실수 1 개 (토큰의 나머지 글자는 무시)
+float parseFloatToken(const char*& p, const char* end) {
+	p = skipSpaces(p, end);
+	float value;
+	if (!parseFloat(p, end, value)) {
+		failParse();
+	}
+	p = skipWord(p, end);
+	return value;
+}
+
+// face 인덱스 1 개 (1 부터 시작, 음수는 상대 번호)
+int64_t parseIndex(const char*& p, const char* end) {
+	bool negative = p < end && *p == '-';
+	if (negative) {
+		p++;
+	}
+	uint64_t value;
+	if (parseDigits(p, end, MAX_INDEX_DIGITS, value) == 0 || (p < end && isDigit(*p)) || value == 0) {
+		failParse();
+	}
+	return negative ? -static_cast<int64_t>(value) : static_cast<int64_t>(value);
+}
+
+// 줄 나머지 (앞뒤 공백 제외)
+std::string parseName(const char* p, const char* end) {
+	p = skipSpaces(p, end);
+	while (end > p && isSpace(end[-1])) {
+		end--;
+	}
+	return std::string(p, end);
+}
+
+// 문장 키워드 비교 (키워드 뒤는 공백 또는 줄 끝)
+bool matchKeyword(const char* p, const char* end, const char* keyword, size_t length) {
+	return static_cast<size_t>(end - p) >= length && memcmp(p, keyword, length) == 0 && (static_cast<size_t>(end - p) == length || isSpace(p[length]));
+}
+
+class ObjChunkParser {
+public:
+	explicit ObjChunkParser(ObjChunk& chunk) : chunk(chunk) {}
+
+	void parse() {
+		beginRun(OBJ_STATEMENT_NONE, std::string());
+		const char* p = chunk.begin;
+		while (p < chunk.end) {
+			const char* lineEnd = findLineEnd(p, chunk.end);
+			parseLine(skipSpaces(p, lineEnd), lineEnd);
+			p = lineEnd + 1;
+		}
+		endRun();
+	}
+
+private:
+	ObjChunk& chunk;
+
+	void parseLine(const char* p, const char* end) {
+		if (p >= end) {
+			return;
+		}
+
+		switch (*p) {
+		case 'v':
+			if (matchKeyword(p, end, "v", 1)) {
+				p++;
+				glm::vec3 position;
+				position.x = parseFloatToken(p, end);
+				position.y = parseFloatToken(p, end);
+				position.z = parseFloatToken(p, end);
+				chunk.positions.push_back(position);
+			} else if (matchKeyword(p, end, "vt", 2)) {
+				p += 2;
+				glm::vec2 texCoord;
+				texCoord.x = parseFloatToken(p, end);
+				texCoord.y = skipSpaces(p, end) < end ? parseFloatToken(p, end) : 0.0f;
+				chunk.texCoords.push_back(texCoord);
+			}
+			break;
+		case 'f':
+			if (matchKeyword(p, end, "f", 1)) {
+				parseFace(p + 1, end);
+			}
+			break;
+		case 'o':
+		case 'g':
+			if (p + 1 == end || isSpace(p[1])) {
+				beginRun(OBJ_STATEMENT_OBJECT, parseName(p + 1, end));
+			}
+			break;
+		case 'u':
+			if (matchKeyword(p, end, "usemtl", 6)) {
+				beginRun(OBJ_STATEMENT_MATERIAL, parseName(p + 6, end));
+			}
+			break;
+		case 'm':
+			if (matchKeyword(p, end, "mtllib", 6)) {
+				beginRun(OBJ_STATEMENT_MATERIAL_LIBRARY, parseName(p + 6, end));
+			}
+			break;
+		default:
+			// vn / s / l / p / 주석 등은 출력에 쓰이지 않으므로 무시
+			break;
+		}
+	}
+
+	// v[/vt][/vn] 꼭짓점 목록 (꼭짓점이 3 개 미만이면 face 무시)
+	void parseFace(const char* p, const char* end) {
+		size_t firstCorner = chunk.corners.size();
+		bool hasTexCoords = false;
+		while (true) {
+			p = skipSpaces(p, end);
+			if (p >= end || *p == '#') {
+				break;
+			}
+
+			ObjCorner corner{0, NO_INDEX};
+			corner.position = resolveIndex(parseIndex(p, end), chunk.positions.size(), false);
+			if (p < end && *p == '/') {
+				p++;
+				if (p < end && *p != '/' && !isSpace(*p)) {
+					corner.texCoord = resolveIndex(parseIndex(p, end), chunk.texCoords.size(), true);
+					hasTexCoords = true;
+				}
+				if (p < end && *p == '/') {
+					p++;
+					if (p < end && !isSpace(*p)) {
+						parseIndex(p, end);
+					}
+				}
+			}
+			if (p < end && !isSpace(*p)) {
+				failParse();
+			}
+			chunk.corners.push_back(corner);
+		}
+
+		uint32_t cornerCount = static_cast<uint32_t>(chunk.corners.size() - firstCorner);
+		if (cornerCount < 3) {
+			chunk.corners.resize(firstCorner);
+			size_t relativeCount = chunk.relativeIndices.size();
+			while (relativeCount > 0 && chunk.relativeIndices[relativeCount - 1].corner >= firstCorner) {
+				relativeCount--;
+			}
+			chunk.relativeIndices.resize(relativeCount);
+			return;
+		}
+		chunk.faceSizes.push_back(cornerCount);
+		ObjRun& run = chunk.runs.back();
+		run.triangleCount += cornerCount - 2;
+		run.hasTexCoords = run.hasTexCoords || hasTexCoords;
+	}
+
+	// 양수는 전역 번호, 음수는 청크 시작 번호가 정해진 뒤 채울 상대 번호로 기록
+	uint32_t resolveIndex(int64_t index, size_t localCount, bool texCoord) {
+		if (index > 0) {
+			return static_cast<uint32_t>(index - 1);
+		}
+		ObjRelativeIndex relative;
+		relative.corner = static_cast<uint32_t>(chunk.corners.size());
+		relative.offset = static_cast<int64_t>(localCount) + index;
+		relative.texCoord = texCoord;
+		chunk.relativeIndices.push_back(relative);
+		return 0;
+	}
+
+	void beginRun(ObjStatement statement, std::string name) {
+		if (!chunk.runs.empty()) {
+			endRun();
+		}
+		ObjRun run{};
+		run.statement = statement;
+		run.name = std::move(name);
+		run.firstFace = static_cast<uint32_t>(chunk.faceSizes.size());
+		run.firstCorner = static_cast<uint32_t>(chunk.corners.size());
+		chunk.runs.push_back(std::move(run));
+	}
+
+	void endRun() {
+		ObjRun& run = chunk.runs.back();
+		run.faceCount = static_cast<uint32_t>(chunk.faceSizes.size()) - run.firstFace;
+		run.cornerCount = static_cast<uint32_t>(chunk.corners.size()) - run.firstCorner;
+	}
+};
+
+// 파일을 OBJ_CHUNK_SIZE 근처의 줄 경계에서 나눔
+std::vector<ObjChunk> splitChunks(const char* begin, const char* end) {
+	std::vector<ObjChunk> chunks;
+	const char* chunkBegin = begin;
+	while (chunkBegin < end) {
+		const char* chunkEnd = end;
+		if (static_cast<size_t>(end - chunkBegin) > OBJ_CHUNK_SIZE) {
+			chunkEnd = findLineEnd(chunkBegin + OBJ_CHUNK_SIZE, end);
+			chunkEnd = chunkEnd < end ? chunkEnd + 1 : end;
+		}
+		ObjChunk chunk;
+		chunk.begin = chunkBegin;
+		chunk.end = chunkEnd;
+		chunks.push_back(std::move(chunk));
+		chunkBegin = chunkEnd;
+	}
+	return chunks;
+}
+
+// 재질 번호 (없으면 목록 끝에 추가)
+uint32_t findMaterial(std::vector<std::string>& materialNames, const std::string& name) {
+	auto it = std::find(materialNames.begin(), materialNames.end(), name);
+	if (it != materialNames.end()) {
+		return static_cast<uint32_t>(it - materialNames.begin());
+	}
+	materialNames.push_back(name);
+	return static_cast<uint32_t>(materialNames.size()) - 1;
+}
+
+// MTL 파일의 newmtl 이름을 정의 순서대로 재질 목록에 추가 (파일이 없으면 무시)
+void loadMaterialLibrary(const std::string& path, std::vector<std::string>& materialNames) {
+	MappedFile file;
+	if (!file.open(path)) {
+		return;
+	}
+
+	const char* p = reinterpret_cast<const char*>(file.data());
+	const char* end = p + file.size();
+	while (p < end) {
+		const char* lineEnd = findLineEnd(p, end);
+		const char* line = skipSpaces(p, lineEnd);
+		if (matchKeyword(line, lineEnd, "newmtl", 6)) {
+			findMaterial(materialNames, parseName(line + 6, lineEnd));
+		}
+		p = lineEnd + 1;
+	}
+}
+
+// face 1 개를 삼각형으로 분할 (Assimp aiProcess_Triangulate 와 같은 꼭짓점 순서)
+uint32_t triangulateFace(const Vertex* vertices, uint32_t cornerCount, uint32_t base, uint32_t* output) {
+	if (cornerCount == 4) {
+		// 사각형은 오목한 꼭짓점이 있으면 그 꼭짓점에서 대각선을 그음
+		uint32_t start = 0;
+		for (uint32_t i = 0; i < 4; i++) {
+			const glm::vec3& v = vertices[i].pos;
+			glm::vec3 left = vertices[(i + 3) % 4].pos - v;
+			glm::vec3 diagonal = vertices[(i + 2) % 4].pos - v;
+			glm::vec3 right = vertices[(i + 1) % 4].pos - v;
+			left *= 1.0f / std::sqrt(left.x * left.x + left.y * left.y + left.z * left.z);
+			diagonal *= 1.0f / std::sqrt(diagonal.x * diagonal.x + diagonal.y * diagonal.y + diagonal.z * diagonal.z);
+			right *= 1.0f / std::sqrt(right.x * right.x + right.y * right.y + right.z * right.z);
+			float angle = std::acos(left.x * diagonal.x + left.y * diagonal.y + left.z * diagonal.z)
+				+ std::acos(right.x * diagonal.x + right.y * diagonal.y + right.z * diagonal.z);
+			if (angle > 3.1415926538f) {
+				start = i;
+				break;
+			}
+		}
+		output[0] = base + start;
+		output[1] = base + (start + 1) % 4;
+		output[2] = base + (start + 2) % 4;
+		output[3] = base + start;
+		output[4] = base + (start + 2) % 4;
+		output[5] = base + (start + 3) % 4;
+		return 6;
+	}
+
+	for (uint32_t i = 1; i + 1 < cornerCount; i++) {
+		*output++ = base;
+		*output++ = base + i;
+		*output++ = base + i + 1;
+	}
+	return (cornerCount - 2) * 3;
+}
+
+// run 의 face 꼭짓점마다 정점을 만들고 삼각형 인덱스 기록 (인덱스는 서브 메시 기준)
+void convertRun(const ObjRun& run, const ObjChunk& chunk,
+				const std::vector<glm::vec3>& positions, const std::vector<glm::vec2>& texCoords, bool hasTexCoords,
+				uint32_t vertexOffset, Vertex* vertices, uint32_t* indices) {
+	const ObjCorner* corner = chunk.corners.data() + run.firstCorner;
+	uint32_t vertex = 0;
+	for (uint32_t f = run.firstFace; f < run.firstFace + run.faceCount; f++) {
+		uint32_t cornerCount = chunk.faceSizes[f];
+		Vertex* faceVertices = vertices + vertex;
+		for (uint32_t k = 0; k < cornerCount; k++, corner++) {
+			Vertex& v = faceVertices[k];
+			v.pos = positions[corner->position];
+			v.color = {1.0f, 1.0f, 1.0f};
+			// texCoord 가 있는 서브 메시는 모든 정점을 뒤집음 (texCoord 없는 꼭짓점은 (0, 0) → (0, 1))
+			if (hasTexCoords) {
+				glm::vec2 texCoord = corner->texCoord != NO_INDEX ? texCoords[corner->texCoord] : glm::vec2(0.0f, 0.0f);
+				v.texCoord = glm::vec2(texCoord.x, 1.0f - texCoord.y);
+			} else {
+				v.texCoord = glm::vec2(0.0f, 0.0f);
+			}
+		}
+		indices += triangulateFace(faceVertices, cornerCount, vertexOffset + vertex, indices);
+		vertex += cornerCount;
+	}
+}
+
+} // namespace
+
+void loadObj(const std::string& path, MeshData& meshData, ThreadPool* pool) {
+	MappedFile file;
+	if (!file.open(path)) {
+		throw std::runtime_error("failed to load obj file!");
+	}
+
+	// 1. 청크별 병렬 파싱
+	const char* text = reinterpret_cast<const char*>(file.data());
+	std::vector<ObjChunk> chunks = splitChunks(text, text + file.size());
+	parallelFor(pool, static_cast<uint32_t>(chunks.size()), [&chunks](uint32_t i) {
+		ObjChunkParser(chunks[i]).parse();
+	});
+
+	// 2. 청크별 v / vt 시작 번호 확정 후 한 배열로 합침
+	uint64_t positionCount = 0;
+	uint64_t texCoordCount = 0;
+	for (ObjChunk& chunk : chunks) {
+		chunk.firstPosition = static_cast<uint32_t>(positionCount);
+		chunk.firstTexCoord = static_cast<uint32_t>(texCoordCount);
+		positionCount += chunk.positions.size();
+		texCoordCount += chunk.texCoords.size();
+	}
+	if (positionCount >= NO_INDEX || texCoordCount >= NO_INDEX) {
+		failParse();
+	}
+
+	std::vector<glm::vec3> positions(positionCount);
+	std::vector<glm::vec2> texCoords(texCoordCount);
+	parallelFor(pool, static_cast<uint32_t>(chunks.size()), [&](uint32_t i) {
+		ObjChunk& chunk = chunks[i];
+		std::copy(chunk.positions.begin(), chunk.positions.end(), positions.begin() + chunk.firstPosition);
+		std::copy(chunk.texCoords.begin(), chunk.texCoords.end(), texCoords.begin() + chunk.firstTexCoord);
+
+		// 상대 인덱스 채우고 모든 꼭짓점 번호 범위 검사
+		for (const ObjRelativeIndex& relative : chunk.relativeIndices) {
+			int64_t index = relative.offset + (relative.texCoord ? chunk.firstTexCoord : chunk.firstPosition);
+			if (index < 0) {
+				failParse();
+			}
+			uint32_t& target = relative.texCoord ? chunk.corners[relative.corner].texCoord : chunk.corners[relative.corner].position;
+			target = static_cast<uint32_t>(index);
+		}
+		for (const ObjCorner& corner : chunk.corners) {
+			if (corner.position >= positionCount || (corner.texCoord != NO_INDEX && corner.texCoord >= texCoordCount)) {
+				failParse();
+			}
+		}
+	});
+
+	// 3. 상태 변경을 파일 순서대로 적용해서 서브 메시 구간 결정 (오브젝트 / 재질이 바뀌면 새 서브 메시)
+	std::string directory = path.substr(0, path.find_last_of("/\\") + 1);
+	std::vector<std::string> materialNames = {DEFAULT_MATERIAL_NAME};
+	std::string objectName;
+	uint32_t objectIndex = 0;
+	uint32_t materialIndex = 0;
+	uint32_t subMeshObject = 0;
+
+	meshData = MeshData();
+	std::vector<ObjOutputRun> outputRuns;
+	std::vector<uint8_t> subMeshTexCoords;
+	uint64_t totalVertices = 0;
+	uint64_t totalIndices = 0;
+	for (uint32_t c = 0; c < chunks.size(); c++) {
+		for (uint32_t r = 0; r < chunks[c].runs.size(); r++) {
+			const ObjRun& run = chunks[c].runs[r];
+			switch (run.statement) {
+			case OBJ_STATEMENT_OBJECT:
+				if (run.name != objectName) {
+					objectName = run.name;
+					objectIndex++;
+				}
+				break;
+			case OBJ_STATEMENT_MATERIAL:
+				materialIndex = findMaterial(materialNames, run.name);
+				break;
+			case OBJ_STATEMENT_MATERIAL_LIBRARY:
+				loadMaterialLibrary(directory + run.name, materialNames);
+				break;
+			default:
+				break;
+			}
+			if (run.faceCount == 0) {
+				continue;
+			}
+
+			if (meshData.subMeshes.empty() || subMeshObject != objectIndex || meshData.subMeshes.back().materialIndex != materialIndex) {
+				SubMesh subMesh{};
+				subMesh.baseVertex = static_cast<uint32_t>(totalVertices);
+				subMesh.firstIndex = static_cast<uint32_t>(totalIndices);
+				subMesh.materialIndex = materialIndex;
+				meshData.subMeshes.push_back(subMesh);
+				subMeshTexCoords.push_back(0);
+				subMeshObject = objectIndex;
+			}
+
+			SubMesh& subMesh = meshData.subMeshes.back();
+			ObjOutputRun outputRun;
+			outputRun.chunkIndex = c;
+			outputRun.runIndex = r;
+			outputRun.subMeshIndex = static_cast<uint32_t>(meshData.subMeshes.size()) - 1;
+			outputRun.vertexOffset = subMesh.vertexCount;
+			outputRun.indexOffset = subMesh.indexCount;
+			outputRuns.push_back(outputRun);
+
+			subMesh.vertexCount += run.cornerCount;
+			subMesh.indexCount += run.triangleCount * 3;
+			subMeshTexCoords.back() |= run.hasTexCoords ? 1 : 0;
+			totalVertices += run.cornerCount;
+			totalIndices += uint64_t(run.triangleCount) * 3;
+		}
+	}
+	if (totalVertices >= NO_INDEX || totalIndices >= NO_INDEX) {
+		failParse();
+	}
+
+	// 4. 구간별 정점 / 인덱스 변환 (각 구간은 겹치지 않는 위치에만 기록하므로 lock 불필요)
+	meshData.vertices.resize(totalVertices);
+	meshData.indices.resize(totalIndices);
+	parallelFor(pool, static_cast<uint32_t>(outputRuns.size()), [&](uint32_t i) {
+		const ObjOutputRun& outputRun = outputRuns[i];
+		const ObjChunk& chunk = chunks[outputRun.chunkIndex];
+		const SubMesh& subMesh = meshData.subMeshes[outputRun.subMeshIndex];
+		convertRun(chunk.runs[outputRun.runIndex], chunk, positions, texCoords, subMeshTexCoords[outputRun.subMeshIndex] != 0,
+				   outputRun.vertexOffset, meshData.vertices.data() + subMesh.baseVertex + outputRun.vertexOffset,
+				   meshData.indices.data() + subMesh.firstIndex + outputRun.indexOffset);
+	});
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "mesh.h"
+
+#include <string>
+
+class ThreadPool;
+
+/*
+	[OBJ 로더]
+	Assimp 없이 OBJ / MTL 파일을 직접 읽어서 buildMeshData 와 같은 MeshData 를 만든다.
+	(Assimp aiProcess_Triangulate | aiProcess_FlipUVs 임포트 + buildMeshData 결과와 정점 / 인덱스 / 서브 메시가 같음)
+	1. 파일을 메모리 매핑하고 줄 경계에 맞춘 청크로 나눠 청크별로 병렬 파싱
+	   (줄 끝 탐색은 SSE2 16 byte 비교, 숫자는 8 자리씩 SWAR 변환, 실수 반올림 순서는 Assimp fast_atof 와 동일)
+	2. 청크별 v / vt 개수 누적으로 전역 번호 확정 후 o / g / usemtl 상태를 순서대로 적용해서 서브 메시 구간 결정
+	3. 서브 메시 구간을 청크 단위로 나눠 face 꼭짓점마다 정점 1 개씩 만들고 삼각형 분할 (병렬)
+	재질 번호는 Assimp 와 같이 DefaultMaterial 이 0, 이후 mtllib 의 newmtl 순서, 없는 재질은 처음 쓰일 때 추가
+	점 / 선 요소와 꼭짓점이 3 개 미만인 face 는 무시하고, 5 각형 이상은 fan 분할한다. (Assimp 는 ear clipping)
+*/
+
+// OBJ 파일 → MeshData 변환 (pool이 nullptr 이면 호출 스레드에서 처리, 실패시 예외 발생)
+void loadObj(const std::string& path, MeshData& meshData, ThreadPool* pool);
@@ -0,0 +1,353 @@
+#include "scene_bvh.h"
+
+#include <algorithm>
+#include <limits>
+
+#if defined(__AVX__)
+	#include <immintrin.h>
+	#define SCENE_BVH_AVX
+#elif defined(_M_X64) || defined(__SSE2__)
+	#include <xmmintrin.h>
+	#define SCENE_BVH_SSE
+#endif
+
+namespace {
+
+// 노드마다 다시 고르지 않도록 평면 법선 부호별로 AABB 의 가장 먼 / 가까운 꼭짓점 축 선택을 미리 계산
+struct CullPlane {
+	float nx, ny, nz, d;
+	bool positiveX, positiveY, positiveZ;	// 법선 성분이 0 이상이면 가장 먼 꼭짓점은 max 쪽
+};
+
+// 자식 칸 8 개 검사 결과 비트 (outside: 평면 하나라도 완전히 바깥, inside: 모든 평면 안쪽)
+struct LaneMasks {
+	uint32_t outside;
+	uint32_t inside;
+};
+
+LaneMasks testLanes(const SceneBvhNode& node, const CullPlane* planes) {
+	LaneMasks masks{0, 0};
+#if defined(SCENE_BVH_AVX)
+	__m256 zero = _mm256_setzero_ps();
+	__m256 outside = zero;
+	__m256 inside = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+	for (int p = 0; p < 6; p++) {
+		const CullPlane& plane = planes[p];
+		__m256 nx = _mm256_set1_ps(plane.nx), ny = _mm256_set1_ps(plane.ny), nz = _mm256_set1_ps(plane.nz), d = _mm256_set1_ps(plane.d);
+		__m256 farX = _mm256_load_ps(plane.positiveX ? node.maxX : node.minX);
+		__m256 farY = _mm256_load_ps(plane.positiveY ? node.maxY : node.minY);
+		__m256 farZ = _mm256_load_ps(plane.positiveZ ? node.maxZ : node.minZ);
+		__m256 nearX = _mm256_load_ps(plane.positiveX ? node.minX : node.maxX);
+		__m256 nearY = _mm256_load_ps(plane.positiveY ? node.minY : node.maxY);
+		__m256 nearZ = _mm256_load_ps(plane.positiveZ ? node.minZ : node.maxZ);
+		__m256 farDistance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, farX), _mm256_mul_ps(ny, farY)), _mm256_add_ps(_mm256_mul_ps(nz, farZ), d));
+		__m256 nearDistance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, nearX), _mm256_mul_ps(ny, nearY)), _mm256_add_ps(_mm256_mul_ps(nz, nearZ), d));
+		outside = _mm256_or_ps(outside, _mm256_cmp_ps(farDistance, zero, _CMP_LT_OQ));
+		inside = _mm256_and_ps(inside, _mm256_cmp_ps(nearDistance, zero, _CMP_GE_OQ));
+	}
+	masks.outside = static_cast<uint32_t>(_mm256_movemask_ps(outside));
+	masks.inside = static_cast<uint32_t>(_mm256_movemask_ps(inside));
+#elif defined(SCENE_BVH_SSE)
+	__m128 zero = _mm_setzero_ps();
+	for (uint32_t base = 0; base < SCENE_BVH_WIDTH; base += 4) {
+		__m128 outside = zero;
+		__m128 inside = _mm_cmpeq_ps(zero, zero);
+		for (int p = 0; p < 6; p++) {
+			const CullPlane& plane = planes[p];
+			__m128 nx = _mm_set1_ps(plane.nx), ny = _mm_set1_ps(plane.ny), nz = _mm_set1_ps(plane.nz), d = _mm_set1_ps(plane.d);
+			__m128 farX = _mm_load_ps((plane.positiveX ? node.maxX : node.minX) + base);
+			__m128 farY = _mm_load_ps((plane.positiveY ? node.maxY : node.minY) + base);
+			__m128 farZ = _mm_load_ps((plane.positiveZ ? node.maxZ : node.minZ) + base);
+			__m128 nearX = _mm_load_ps((plane.positiveX ? node.minX : node.maxX) + base);
+			__m128 nearY = _mm_load_ps((plane.positiveY ? node.minY : node.maxY) + base);
+			__m128 nearZ = _mm_load_ps((plane.positiveZ ? node.minZ : node.maxZ) + base);
+			__m128 farDistance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, farX), _mm_mul_ps(ny, farY)), _mm_add_ps(_mm_mul_ps(nz, farZ), d));
+			__m128 nearDistance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, nearX), _mm_mul_ps(ny, nearY)), _mm_add_ps(_mm_mul_ps(nz, nearZ), d));
+			outside = _mm_or_ps(outside, _mm_cmplt_ps(farDistance, zero));
+			inside = _mm_and_ps(inside, _mm_cmpge_ps(nearDistance, zero));
+		}
+		masks.outside |= static_cast<uint32_t>(_mm_movemask_ps(outside)) << base;
+		masks.inside |= static_cast<uint32_t>(_mm_movemask_ps(inside)) << base;
+	}
+#else
+	for (uint32_t lane = 0; lane < SCENE_BVH_WIDTH; lane++) {
+		bool outside = false;
+		bool inside = true;
+		for (int p = 0; p < 6; p++) {
+			const CullPlane& plane = planes[p];
+			float farDistance = (plane.nx * (plane.positiveX ? node.maxX : node.minX)[lane] + plane.ny * (plane.positiveY ? node.maxY : node.minY)[lane])
+							  + (plane.nz * (plane.positiveZ ? node.maxZ : node.minZ)[lane] + plane.d);
+			float nearDistance = (plane.nx * (plane.positiveX ? node.minX : node.maxX)[lane] + plane.ny * (plane.positiveY ? node.minY : node.maxY)[lane])
+							   + (plane.nz * (plane.positiveZ ? node.minZ : node.maxZ)[lane] + plane.d);
+			outside = outside || farDistance < 0.0f;
+			inside = inside && nearDistance >= 0.0f;
+		}
+		masks.outside |= static_cast<uint32_t>(outside) << lane;
+		masks.inside |= static_cast<uint32_t>(inside) << lane;
+	}
+#endif
+	return masks;
+}
+
+SceneAabb emptyAabb() {
+	float infinity = std::numeric_limits<float>::infinity();
+	return {glm::vec3(infinity), glm::vec3(-infinity)};
+}
+
+bool contains(const SceneAabb& outer, const SceneAabb& inner) {
+	return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+		   outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+}
+
+SceneAabb slotBounds(const SceneBvhNode& node, uint32_t slot) {
+	return {glm::vec3(node.minX[slot], node.minY[slot], node.minZ[slot]), glm::vec3(node.maxX[slot], node.maxY[slot], node.maxZ[slot])};
+}
+
+} // namespace
+
+void SceneBvh::build(const SceneAabb* boxes, uint32_t count) {
+	nodes.clear();
+	objectSlots.assign(count, SCENE_BVH_NONE);
+	dirtyNodes.clear();
+	nodeDirty.clear();
+	if (count == 0) {
+		return;
+	}
+
+	std::vector<glm::vec3> centers(count);
+	std::vector<uint32_t> objects(count);
+	for (uint32_t i = 0; i < count; i++) {
+		centers[i] = (boxes[i].min + boxes[i].max) * 0.5f;
+		objects[i] = i;
+	}
+	nodes.reserve(count / (SCENE_BVH_WIDTH - 1) + 1);
+	buildNode(boxes, centers, objects.data(), count, SCENE_BVH_NONE, 0);
+	nodeDirty.assign(nodes.size(), 0);
+}
+
+/*
+	[노드 생성]
+	1. 물체가 가장 많은 그룹을 중심 분포가 가장 긴 축에서 나누기를 모든 그룹이 칸 용량 이하가 될 때까지 반복
+	   (나누는 위치를 칸 용량 배수로 맞춰서 칸이 많아야 SCENE_BVH_WIDTH 개, 마지막 하나 외에는 하위 노드가 가득 참)
+	2. 물체 1 개 그룹은 칸에 바로 넣고, 나머지는 하위 노드로 재귀 (부모 번호가 자식보다 작음)
+*/
+uint32_t SceneBvh::buildNode(const SceneAabb* boxes, const std::vector<glm::vec3>& centers, uint32_t* objects, uint32_t count, uint32_t parent, uint32_t parentSlot) {
+	uint32_t nodeIndex = static_cast<uint32_t>(nodes.size());
+	nodes.emplace_back();
+	SceneBvhNode& node = nodes.back();
+	node.childCount = 0;
+	node.parent = parent;
+	node.parentSlot = parentSlot;
+	for (uint32_t slot = 0; slot < SCENE_BVH_WIDTH; slot++) {
+		setSlot(node, slot, emptyAabb());
+		node.children[slot] = SCENE_BVH_NONE;
+	}
+
+	// 자식 1 칸이 담을 물체 수: 칸 WIDTH 개로 count 를 담을 수 있는 가장 작은 WIDTH 거듭제곱
+	uint32_t slotCapacity = 1;
+	while (static_cast<uint64_t>(slotCapacity) * SCENE_BVH_WIDTH < count) {
+		slotCapacity *= SCENE_BVH_WIDTH;
+	}
+
+	// (시작 위치, 개수), 나누는 위치를 slotCapacity 배수로 맞춰서 하위 노드가 가득 차도록 함
+	std::vector<std::pair<uint32_t, uint32_t>> groups = {{0, count}};
+	while (true) {
+		auto largest = std::max_element(groups.begin(), groups.end(),
+			[](const std::pair<uint32_t, uint32_t>& a, const std::pair<uint32_t, uint32_t>& b) { return a.second < b.second; });
+		if (largest->second <= slotCapacity) {
+			break;
+		}
+
+		uint32_t first = largest->first;
+		uint32_t groupCount = largest->second;
+		glm::vec3 minCenter(std::numeric_limits<float>::max());
+		glm::vec3 maxCenter(-std::numeric_limits<float>::max());
+		for (uint32_t i = first; i < first + groupCount; i++) {
+			minCenter = glm::min(minCenter, centers[objects[i]]);
+			maxCenter = glm::max(maxCenter, centers[objects[i]]);
+		}
+		glm::vec3 extent = maxCenter - minCenter;
+		int axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+
+		uint32_t chunks = (groupCount + slotCapacity - 1) / slotCapacity;
+		uint32_t split = chunks / 2 * slotCapacity;
+		std::nth_element(objects + first, objects + first + split, objects + first + groupCount,
+			[&centers, axis](uint32_t a, uint32_t b) { return centers[a][axis] < centers[b][axis]; });
+		*largest = {first, split};
+		groups.push_back({first + split, groupCount - split});
+	}
+
+	for (uint32_t slot = 0; slot < groups.size(); slot++) {
+		uint32_t first = groups[slot].first;
+		uint32_t groupCount = groups[slot].second;
+		if (groupCount == 1) {
+			uint32_t object = objects[first];
+			nodes[nodeIndex].children[slot] = SCENE_BVH_OBJECT | object;
+			setSlot(nodes[nodeIndex], slot, boxes[object]);
+			objectSlots[object] = nodeIndex * SCENE_BVH_WIDTH + slot;
+		} else {
+			uint32_t child = buildNode(boxes, centers, objects + first, groupCount, nodeIndex, slot);	// nodes 가 재할당될 수 있어서 번호로 접근
+			nodes[nodeIndex].children[slot] = child;
+			setSlot(nodes[nodeIndex], slot, nodeBounds(nodes[child]));
+		}
+	}
+	nodes[nodeIndex].childCount = static_cast<uint32_t>(groups.size());
+	return nodeIndex;
+}
+
+void SceneBvh::setSlot(SceneBvhNode& node, uint32_t slot, const SceneAabb& box) {
+	node.minX[slot] = box.min.x;
+	node.minY[slot] = box.min.y;
+	node.minZ[slot] = box.min.z;
+	node.maxX[slot] = box.max.x;
+	node.maxY[slot] = box.max.y;
+	node.maxZ[slot] = box.max.z;
+}
+
+SceneAabb SceneBvh::nodeBounds(const SceneBvhNode& node) const {
+	SceneAabb bounds = emptyAabb();
+	for (uint32_t slot = 0; slot < node.childCount; slot++) {
+		SceneAabb box = slotBounds(node, slot);
+		bounds.min = glm::min(bounds.min, box.min);
+		bounds.max = glm::max(bounds.max, box.max);
+	}
+	return bounds;
+}
+
+void SceneBvh::updateObject(uint32_t object, const SceneAabb& box) {
+	uint32_t nodeIndex = objectSlots[object] / SCENE_BVH_WIDTH;
+	setSlot(nodes[nodeIndex], objectSlots[object] % SCENE_BVH_WIDTH, box);
+	if (!nodeDirty[nodeIndex]) {
+		nodeDirty[nodeIndex] = 1;
+		dirtyNodes.push_back(nodeIndex);
+	}
+}
+
+// 번호가 큰 (깊은) 노드부터 처리해서 부모는 모든 자식이 끝난 뒤 1 번만 계산, 경계가 그대로면 위로 전파하지 않음
+uint32_t SceneBvh::refit() {
+	uint32_t refitted = 0;
+	std::make_heap(dirtyNodes.begin(), dirtyNodes.end());
+	while (!dirtyNodes.empty()) {
+		std::pop_heap(dirtyNodes.begin(), dirtyNodes.end());
+		uint32_t nodeIndex = dirtyNodes.back();
+		dirtyNodes.pop_back();
+		nodeDirty[nodeIndex] = 0;
+		refitted++;
+
+		const SceneBvhNode& node = nodes[nodeIndex];
+		if (node.parent == SCENE_BVH_NONE) {
+			continue;
+		}
+		SceneAabb bounds = nodeBounds(node);
+		SceneBvhNode& parent = nodes[node.parent];
+		SceneAabb previous = slotBounds(parent, node.parentSlot);
+		if (bounds.min == previous.min && bounds.max == previous.max) {
+			continue;
+		}
+		setSlot(parent, node.parentSlot, bounds);
+		if (!nodeDirty[node.parent]) {
+			nodeDirty[node.parent] = 1;
+			dirtyNodes.push_back(node.parent);
+			std::push_heap(dirtyNodes.begin(), dirtyNodes.end());
+		}
+	}
+	return refitted;
+}
+
+/*
+	[컬링]
+	루트부터 스택으로 내려가면서 노드마다 자식 칸 8 개를 평면 6 개에 검사
+	바깥 칸은 버리고, 완전히 안쪽인 칸은 하위 물체를 검사 없이 추가, 걸친 칸의 하위 노드만 다시 검사
+*/
+SceneCullStats SceneBvh::cull(const glm::vec4 frustumPlanes[6], std::vector<uint32_t>& visible) const {
+	SceneCullStats stats;
+	visible.clear();
+	if (nodes.empty()) {
+		return stats;
+	}
+
+	CullPlane planes[6];
+	for (int p = 0; p < 6; p++) {
+		const glm::vec4& plane = frustumPlanes[p];
+		planes[p] = {plane.x, plane.y, plane.z, plane.w, plane.x >= 0.0f, plane.y >= 0.0f, plane.z >= 0.0f};
+	}
+
+	uint32_t stack[64 * SCENE_BVH_WIDTH];		// 깊이당 최대 WIDTH - 1 개 (균형 트리라 깊이는 log8(물체 수) 정도)
+	uint32_t stackSize = 0;
+	stack[stackSize++] = 0;
+	while (stackSize > 0) {
+		const SceneBvhNode& node = nodes[stack[--stackSize]];
+		stats.nodesVisited++;
+
+		LaneMasks masks = testLanes(node, planes);
+		uint32_t valid = (1u << node.childCount) - 1;
+		uint32_t remaining = valid & ~masks.outside;
+		for (uint32_t slot = 0; slot < node.childCount; slot++) {
+			if (!(remaining & (1u << slot))) {
+				continue;
+			}
+			uint32_t child = node.children[slot];
+			if (child & SCENE_BVH_OBJECT) {
+				visible.push_back(child & ~SCENE_BVH_OBJECT);
+			} else if (masks.inside & (1u << slot)) {
+				appendSubtree(child, visible);
+			} else {
+				stack[stackSize++] = child;
+			}
+		}
+	}
+	stats.visibleObjects = static_cast<uint32_t>(visible.size());
+	return stats;
+}
+
+void SceneBvh::appendSubtree(uint32_t child, std::vector<uint32_t>& visible) const {
+	const SceneBvhNode& node = nodes[child];
+	for (uint32_t slot = 0; slot < node.childCount; slot++) {
+		if (node.children[slot] & SCENE_BVH_OBJECT) {
+			visible.push_back(node.children[slot] & ~SCENE_BVH_OBJECT);
+		} else {
+			appendSubtree(node.children[slot], visible);
+		}
+	}
+}
+
+bool SceneBvh::validate() const {
+	std::vector<uint32_t> seen(objectSlots.size(), 0);
+	for (uint32_t n = 0; n < nodes.size(); n++) {
+		const SceneBvhNode& node = nodes[n];
+		if (node.childCount == 0 || node.childCount > SCENE_BVH_WIDTH) {
+			return false;
+		}
+		for (uint32_t slot = 0; slot < node.childCount; slot++) {
+			uint32_t child = node.children[slot];
+			if (child & SCENE_BVH_OBJECT) {
+				uint32_t object = child & ~SCENE_BVH_OBJECT;
+				if (object >= objectSlots.size() || objectSlots[object] != n * SCENE_BVH_WIDTH + slot) {
+					return false;
+				}
+				seen[object]++;
+				continue;
+			}
+			if (child <= n || child >= nodes.size() || nodes[child].parent != n || nodes[child].parentSlot != slot) {
+				return false;
+			}
+			if (!contains(slotBounds(node, slot), nodeBounds(nodes[child]))) {
+				return false;
+			}
+		}
+	}
+	return std::all_of(seen.begin(), seen.end(), [](uint32_t count) { return count == 1; });
+}
+
+bool sceneAabbInFrustum(const glm::vec4 frustumPlanes[6], const SceneAabb& box) {
+	for (int p = 0; p < 6; p++) {
+		const glm::vec4& plane = frustumPlanes[p];
+		float farX = plane.x >= 0.0f ? box.max.x : box.min.x;
+		float farY = plane.y >= 0.0f ? box.max.y : box.min.y;
+		float farZ = plane.z >= 0.0f ? box.max.z : box.min.z;
+		if ((plane.x * farX + plane.y * farY) + (plane.z * farZ + plane.w) < 0.0f) {
+			return false;
+		}
+	}
+	return true;
+}
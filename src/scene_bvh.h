@@ -0,0 +1,84 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+/*
+	[장면 BVH (CPU frustum 컬링)]
+	GPU 컬링을 쓸 수 없을 때 물체 AABB 위에 8 갈래 BVH 를 만들어 CPU 에서 컬링한다.
+	1. 노드는 자식 8 개의 AABB 를 축별 배열 (SoA) 로 저장해서 평면 1 개를 자식 8 개에 한 번에 검사
+	   (AVX 는 8 개, SSE 는 4 개씩 두 번, 나머지 플랫폼은 스칼라)
+	2. 자식 칸은 하위 노드 또는 물체 1 개 (리프 노드가 따로 없어 마지막 단계도 물체 8 개를 한 번에 검사)
+	3. 평면 안쪽에 완전히 들어간 자식은 더 검사하지 않고 하위 물체를 모두 추가
+	4. 물체가 움직이면 updateObject 로 그 칸만 고치고, refit 이 바뀐 노드에서 루트 방향으로만 경계를 다시 계산
+	   (트리 구조는 유지하므로 많이 움직이면 build 를 다시 호출)
+	메인 스레드 전용
+*/
+
+// 노드 1 개의 자식 수 (SIMD 폭)
+const uint32_t SCENE_BVH_WIDTH = 8;
+
+struct SceneAabb {
+	glm::vec3 min;
+	glm::vec3 max;
+};
+
+struct SceneBvhNode {
+	alignas(32) float minX[SCENE_BVH_WIDTH];
+	alignas(32) float minY[SCENE_BVH_WIDTH];
+	alignas(32) float minZ[SCENE_BVH_WIDTH];
+	alignas(32) float maxX[SCENE_BVH_WIDTH];
+	alignas(32) float maxY[SCENE_BVH_WIDTH];
+	alignas(32) float maxZ[SCENE_BVH_WIDTH];
+	uint32_t children[SCENE_BVH_WIDTH];	// 하위 노드 번호 또는 SCENE_BVH_OBJECT | 물체 번호
+	uint32_t childCount;
+	uint32_t parent;					// 루트는 SCENE_BVH_NONE
+	uint32_t parentSlot;				// 부모 노드에서 이 노드의 칸
+};
+
+// 자식 칸이 물체임을 나타내는 비트
+const uint32_t SCENE_BVH_OBJECT = 0x80000000u;
+const uint32_t SCENE_BVH_NONE = 0xFFFFFFFFu;
+
+// 컬링 결과
+struct SceneCullStats {
+	uint32_t nodesVisited = 0;
+	uint32_t visibleObjects = 0;
+};
+
+class SceneBvh {
+public:
+	// boxes 로 트리 생성 (가장 긴 중심 분포 축으로 나누고, 하위 노드 칸이 가득 차도록 나누는 위치를 맞춤)
+	void build(const SceneAabb* boxes, uint32_t count);
+
+	// 물체 AABB 교체 (refit 전까지 상위 노드 경계는 이전 값)
+	void updateObject(uint32_t object, const SceneAabb& box);
+	// updateObject 로 바뀐 노드부터 루트까지 경계 재계산 (바뀐 경로만 방문)
+	// 반환값: 다시 계산한 노드 수
+	uint32_t refit();
+
+	// frustumPlanes (안쪽을 향하는 정규화된 평면) 과 겹치는 물체 번호를 visible 에 기록 (순서는 트리 순)
+	SceneCullStats cull(const glm::vec4 frustumPlanes[6], std::vector<uint32_t>& visible) const;
+
+	// 모든 노드 경계가 자식을 감싸고 모든 물체가 정확히 한 칸에 있는지 검사
+	bool validate() const;
+
+	uint32_t objectCount() const { return static_cast<uint32_t>(objectSlots.size()); }
+	uint32_t nodeCount() const { return static_cast<uint32_t>(nodes.size()); }
+
+private:
+	std::vector<SceneBvhNode> nodes;		// 0 번이 루트, 부모는 항상 자식보다 작은 번호
+	std::vector<uint32_t> objectSlots;		// 물체 번호 → 노드 번호 * SCENE_BVH_WIDTH + 칸
+	std::vector<uint32_t> dirtyNodes;		// refit 할 노드 (경계가 바뀐 칸을 가진 노드)
+	std::vector<uint8_t> nodeDirty;
+
+	uint32_t buildNode(const SceneAabb* boxes, const std::vector<glm::vec3>& centers, uint32_t* objects, uint32_t count, uint32_t parent, uint32_t parentSlot);
+	void setSlot(SceneBvhNode& node, uint32_t slot, const SceneAabb& box);
+	SceneAabb nodeBounds(const SceneBvhNode& node) const;
+	void appendSubtree(uint32_t child, std::vector<uint32_t>& visible) const;
+};
+
+// AABB 가 frustum 평면 하나라도 완전히 바깥이면 false (BVH 컬링과 같은 판정, 검증용)
+bool sceneAabbInFrustum(const glm::vec4 frustumPlanes[6], const SceneAabb& box);
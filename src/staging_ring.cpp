@@ -0,0 +1,75 @@
+#include "staging_ring.h"
+
+#include <stdexcept>
+
+namespace {
+
+size_t alignUp(size_t value, size_t alignment) {
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+void StagingRing::init(size_t capacity, size_t alignment) {
+	if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+		throw std::runtime_error("failed to create staging ring!");
+	}
+	ringCapacity = capacity;
+	this->alignment = alignment;
+	head = 0;
+	spans.clear();
+}
+
+bool StagingRing::allocate(size_t size, uint64_t batch, size_t& offset) {
+	if (spans.empty()) {
+		// 비어 있으면 처음부터 (돌아가며 버리는 자리가 생기지 않도록)
+		head = 0;
+		if (size > ringCapacity) {
+			return false;
+		}
+		offset = 0;
+	} else {
+		// 마지막 구간이 가장 오래된 구간보다 앞에서 시작하면 이미 한 바퀴 돈 상태 → 빈 자리는 [head, 가장 오래된 구간 시작)
+		size_t tail = spans.front().begin;
+		bool wrapped = spans.back().begin < tail;
+		size_t start = alignUp(head, alignment);
+		if (wrapped) {
+			if (start + size > tail) {
+				return false;
+			}
+			offset = start;
+		} else if (start + size <= ringCapacity) {
+			offset = start;
+		} else if (size <= tail) {
+			offset = 0;
+		} else {
+			return false;
+		}
+	}
+
+	// 같은 배치가 이어서 쓰면 구간 확장, 아니면 새 구간
+	if (!spans.empty() && spans.back().batch == batch && offset >= spans.back().begin) {
+		spans.back().end = offset + size;
+	} else {
+		spans.push_back({batch, offset, offset + size});
+	}
+	head = offset + size;
+	return true;
+}
+
+void StagingRing::retire(uint64_t completedBatch) {
+	while (!spans.empty() && spans.front().batch <= completedBatch) {
+		spans.pop_front();
+	}
+}
+
+size_t StagingRing::usedBytes() const {
+	if (spans.empty()) {
+		return 0;
+	}
+	size_t tail = spans.front().begin;
+	if (head > tail || (head == tail && spans.back().begin >= tail)) {
+		return head - tail;
+	}
+	return ringCapacity - tail + head;
+}
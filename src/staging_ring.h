@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+/*
+	[스테이징 링]
+	영구 매핑된 업로드 버퍼를 FIFO 링으로 나눠 쓰는 byte 구간 할당기 (Vulkan 호출 없음)
+	1. 구간은 업로드 배치 번호와 함께 할당하고, 배치가 끝나면 (타임라인 세마포어 값) retire 로 그 배치까지의 구간을 한 번에 반환
+	2. 끝에 자리가 없으면 처음으로 돌아감 (가장 오래된 배치 구간 앞까지)
+	3. 자리가 없으면 false → 호출자가 배치를 제출하고 오래된 배치를 기다린 뒤 다시 시도
+*/
+class StagingRing {
+public:
+	// capacity byte 링 (alignment 는 2 의 거듭제곱, 모든 구간 offset 을 정렬)
+	void init(size_t capacity, size_t alignment);
+
+	// batch 에 속하는 size byte 구간 할당 (batch 는 이전 호출보다 작아지면 안 됨)
+	bool allocate(size_t size, uint64_t batch, size_t& offset);
+
+	// completedBatch 이하 배치의 구간 반환
+	void retire(uint64_t completedBatch);
+
+	size_t capacity() const { return ringCapacity; }
+	// 아직 반환하지 않은 구간 크기 (끝에서 돌아가며 버린 자리 포함)
+	size_t usedBytes() const;
+	bool empty() const { return spans.empty(); }
+
+private:
+	// 배치 1 개가 연속으로 쓴 구간
+	struct Span {
+		uint64_t batch;
+		size_t begin;
+		size_t end;
+	};
+
+	size_t ringCapacity = 0;
+	size_t alignment = 1;
+	size_t head = 0;				// 다음 할당 위치 (마지막 구간의 끝)
+	std::deque<Span> spans;			// 오래된 순
+};
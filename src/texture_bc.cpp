@@ -0,0 +1,624 @@
+#include "texture_bc.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+// 끝점 최소제곱 보정 반복 횟수
+const uint32_t BC_REFINE_ITERATIONS = 2;
+
+// 주성분 축 power iteration 횟수
+const uint32_t BC_AXIS_ITERATIONS = 8;
+
+// BC7 인덱스 비트 수별 보간 가중치 (/64)
+const uint32_t BC7_WEIGHTS2[4] = {0, 21, 43, 64};
+const uint32_t BC7_WEIGHTS3[8] = {0, 9, 18, 27, 37, 46, 55, 64};
+const uint32_t BC7_WEIGHTS4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+// BC1 인덱스별 c1 쪽 가중치 (0 → c0, 1 → c1, 2 → 1/3, 3 → 2/3)
+const float BC1_WEIGHTS[4] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+
+// 4x4 블록 픽셀 (0 ~ 255 float)
+typedef float BlockPixels[16][4];
+
+// 블록 안의 비트 스트림 쓰기 / 읽기 (하위 비트부터)
+struct BitWriter {
+	uint8_t* data;
+	uint32_t position = 0;
+
+	void write(uint32_t value, uint32_t bits) {
+		for (uint32_t i = 0; i < bits; i++, position++) {
+			data[position >> 3] |= static_cast<uint8_t>(((value >> i) & 1) << (position & 7));
+		}
+	}
+};
+
+struct BitReader {
+	const uint8_t* data;
+	uint32_t position = 0;
+
+	uint32_t read(uint32_t bits) {
+		uint32_t value = 0;
+		for (uint32_t i = 0; i < bits; i++, position++) {
+			value |= ((data[position >> 3] >> (position & 7)) & 1u) << i;
+		}
+		return value;
+	}
+};
+
+float clampColor(float value) {
+	return std::min(std::max(value, 0.0f), 255.0f);
+}
+
+// 블록 픽셀의 평균과 주성분 축 (channelCount 3: RGB / 4: RGBA, 모든 픽셀이 같으면 축은 0)
+void principalAxis(const BlockPixels& pixels, uint32_t channelCount, float* mean, float* axis) {
+	for (uint32_t c = 0; c < 4; c++) {
+		mean[c] = 0.0f;
+		axis[c] = 0.0f;
+	}
+	for (uint32_t i = 0; i < 16; i++) {
+		for (uint32_t c = 0; c < channelCount; c++) {
+			mean[c] += pixels[i][c];
+		}
+	}
+	for (uint32_t c = 0; c < channelCount; c++) {
+		mean[c] /= 16.0f;
+	}
+
+	float covariance[4][4] = {};
+	for (uint32_t i = 0; i < 16; i++) {
+		float d[4];
+		for (uint32_t c = 0; c < channelCount; c++) {
+			d[c] = pixels[i][c] - mean[c];
+		}
+		for (uint32_t a = 0; a < channelCount; a++) {
+			for (uint32_t b = 0; b < channelCount; b++) {
+				covariance[a][b] += d[a] * d[b];
+			}
+		}
+	}
+
+	// 분산이 가장 큰 채널 행에서 시작해서 power iteration
+	uint32_t start = 0;
+	for (uint32_t c = 1; c < channelCount; c++) {
+		if (covariance[c][c] > covariance[start][start]) {
+			start = c;
+		}
+	}
+	float v[4];
+	for (uint32_t c = 0; c < channelCount; c++) {
+		v[c] = covariance[start][c];
+	}
+	for (uint32_t iteration = 0; iteration < BC_AXIS_ITERATIONS; iteration++) {
+		float next[4] = {};
+		float largest = 0.0f;
+		for (uint32_t a = 0; a < channelCount; a++) {
+			for (uint32_t b = 0; b < channelCount; b++) {
+				next[a] += covariance[a][b] * v[b];
+			}
+			largest = std::max(largest, std::fabs(next[a]));
+		}
+		if (largest == 0.0f) {
+			return;
+		}
+		for (uint32_t c = 0; c < channelCount; c++) {
+			v[c] = next[c] / largest;
+		}
+	}
+
+	float length = 0.0f;
+	for (uint32_t c = 0; c < channelCount; c++) {
+		length += v[c] * v[c];
+	}
+	length = std::sqrt(length);
+	for (uint32_t c = 0; c < channelCount; c++) {
+		axis[c] = v[c] / length;
+	}
+}
+
+// 주성분 축 위 투영 범위의 양 끝점
+void axisEndpoints(const BlockPixels& pixels, uint32_t channelCount, float* e0, float* e1) {
+	float mean[4], axis[4];
+	principalAxis(pixels, channelCount, mean, axis);
+
+	float tMin = 0.0f, tMax = 0.0f;
+	for (uint32_t i = 0; i < 16; i++) {
+		float t = 0.0f;
+		for (uint32_t c = 0; c < channelCount; c++) {
+			t += (pixels[i][c] - mean[c]) * axis[c];
+		}
+		tMin = std::min(tMin, t);
+		tMax = std::max(tMax, t);
+	}
+	for (uint32_t c = 0; c < 4; c++) {
+		e0[c] = clampColor(mean[c] + axis[c] * tMin);
+		e1[c] = clampColor(mean[c] + axis[c] * tMax);
+	}
+}
+
+// 인덱스별 c1 쪽 가중치로 두 끝점 최소제곱 해 (해가 없으면 false)
+bool solveEndpoints(const BlockPixels& pixels, const float* weights, uint32_t channelCount, float* e0, float* e1) {
+	float a = 0.0f, b = 0.0f, c = 0.0f;
+	float x0[4] = {}, x1[4] = {};
+	for (uint32_t i = 0; i < 16; i++) {
+		float w = weights[i];
+		a += (1.0f - w) * (1.0f - w);
+		b += (1.0f - w) * w;
+		c += w * w;
+		for (uint32_t k = 0; k < channelCount; k++) {
+			x0[k] += (1.0f - w) * pixels[i][k];
+			x1[k] += w * pixels[i][k];
+		}
+	}
+	float det = a * c - b * b;
+	if (std::fabs(det) < 1e-6f) {
+		return false;
+	}
+	for (uint32_t k = 0; k < channelCount; k++) {
+		e0[k] = clampColor((c * x0[k] - b * x1[k]) / det);
+		e1[k] = clampColor((a * x1[k] - b * x0[k]) / det);
+	}
+	return true;
+}
+
+// ---------------------------------------------------------------- BC1
+
+uint16_t packRgb565(const float* color) {
+	uint32_t r = static_cast<uint32_t>(color[0] * 31.0f / 255.0f + 0.5f);
+	uint32_t g = static_cast<uint32_t>(color[1] * 63.0f / 255.0f + 0.5f);
+	uint32_t b = static_cast<uint32_t>(color[2] * 31.0f / 255.0f + 0.5f);
+	return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+void unpackRgb565(uint16_t value, int32_t* color) {
+	int32_t r = value >> 11;
+	int32_t g = (value >> 5) & 63;
+	int32_t b = value & 31;
+	color[0] = (r << 3) | (r >> 2);
+	color[1] = (g << 2) | (g >> 4);
+	color[2] = (b << 3) | (b >> 2);
+}
+
+// 끝점 두 개로 만드는 BC1 팔레트 (c0 > c1 이면 4 색, 아니면 3 색 + 검정)
+void bc1Palette(uint16_t c0, uint16_t c1, int32_t palette[4][3]) {
+	unpackRgb565(c0, palette[0]);
+	unpackRgb565(c1, palette[1]);
+	for (uint32_t k = 0; k < 3; k++) {
+		if (c0 > c1) {
+			palette[2][k] = (2 * palette[0][k] + palette[1][k]) / 3;
+			palette[3][k] = (palette[0][k] + 2 * palette[1][k]) / 3;
+		} else {
+			palette[2][k] = (palette[0][k] + palette[1][k]) / 2;
+			palette[3][k] = 0;
+		}
+	}
+}
+
+// 4 색 팔레트 (c0 >= c1) 에서 픽셀별 가장 가까운 인덱스와 전체 오차
+float bc1Evaluate(const BlockPixels& pixels, uint16_t c0, uint16_t c1, uint32_t& indices) {
+	int32_t palette[4][3];
+	bc1Palette(c0, c1, palette);
+	uint32_t paletteSize = c0 > c1 ? 4 : 1;
+
+	float total = 0.0f;
+	indices = 0;
+	for (uint32_t i = 0; i < 16; i++) {
+		float best = 1e30f;
+		uint32_t bestIndex = 0;
+		for (uint32_t j = 0; j < paletteSize; j++) {
+			float error = 0.0f;
+			for (uint32_t k = 0; k < 3; k++) {
+				float d = pixels[i][k] - palette[j][k];
+				error += d * d;
+			}
+			if (error < best) {
+				best = error;
+				bestIndex = j;
+			}
+		}
+		total += best;
+		indices |= bestIndex << (i * 2);
+	}
+	return total;
+}
+
+// ---------------------------------------------------------------- BC7
+
+// BC7 모드 6 끝점 (양자화 7bit 값 + p-bit) 과 인덱스
+struct Bc7Mode6 {
+	uint32_t quantized[2][4];
+	uint32_t pBits[2];
+	uint8_t indices[16];
+	float error;
+};
+
+// 투영값 (0 ~ 64) → 가장 가까운 4bit 인덱스
+struct Bc7IndexTable {
+	uint8_t nearest[65];
+
+	Bc7IndexTable() {
+		for (uint32_t t = 0; t <= 64; t++) {
+			uint32_t best = 0;
+			for (uint32_t i = 1; i < 16; i++) {
+				if (std::abs(static_cast<int32_t>(BC7_WEIGHTS4[i]) - static_cast<int32_t>(t)) < std::abs(static_cast<int32_t>(BC7_WEIGHTS4[best]) - static_cast<int32_t>(t))) {
+					best = i;
+				}
+			}
+			nearest[t] = static_cast<uint8_t>(best);
+		}
+	}
+};
+
+const Bc7IndexTable& bc7IndexTable() {
+	static const Bc7IndexTable table;
+	return table;
+}
+
+// 모드 6 끝점으로 픽셀별 인덱스 선택 (끝점 선 위 투영 후 주변 인덱스 중 오차가 가장 작은 값)
+void bc7Evaluate(const BlockPixels& pixels, Bc7Mode6& mode) {
+	int32_t e0[4], e1[4], d[4];
+	int32_t lengthSquared = 0;
+	for (uint32_t c = 0; c < 4; c++) {
+		e0[c] = static_cast<int32_t>((mode.quantized[0][c] << 1) | mode.pBits[0]);
+		e1[c] = static_cast<int32_t>((mode.quantized[1][c] << 1) | mode.pBits[1]);
+		d[c] = e1[c] - e0[c];
+		lengthSquared += d[c] * d[c];
+	}
+
+	int32_t palette[16][4];
+	for (uint32_t i = 0; i < 16; i++) {
+		for (uint32_t c = 0; c < 4; c++) {
+			palette[i][c] = ((64 - static_cast<int32_t>(BC7_WEIGHTS4[i])) * e0[c] + static_cast<int32_t>(BC7_WEIGHTS4[i]) * e1[c] + 32) >> 6;
+		}
+	}
+
+	const Bc7IndexTable& table = bc7IndexTable();
+	mode.error = 0.0f;
+	for (uint32_t i = 0; i < 16; i++) {
+		uint32_t guess = 0;
+		if (lengthSquared > 0) {
+			float t = 0.0f;
+			for (uint32_t c = 0; c < 4; c++) {
+				t += (pixels[i][c] - e0[c]) * d[c];
+			}
+			t = std::min(std::max(t * 64.0f / lengthSquared, 0.0f), 64.0f);
+			guess = table.nearest[static_cast<uint32_t>(t + 0.5f)];
+		}
+
+		float best = 1e30f;
+		uint32_t first = guess > 0 ? guess - 1 : 0;
+		uint32_t last = std::min(guess + 1, 15u);
+		for (uint32_t j = first; j <= last; j++) {
+			float error = 0.0f;
+			for (uint32_t c = 0; c < 4; c++) {
+				float diff = pixels[i][c] - palette[j][c];
+				error += diff * diff;
+			}
+			if (error < best) {
+				best = error;
+				mode.indices[i] = static_cast<uint8_t>(j);
+			}
+		}
+		mode.error += best;
+	}
+}
+
+// 실수 끝점을 p-bit 조합 4 가지로 양자화해서 가장 오차가 작은 결과를 best 에 반영
+void bc7QuantizeEndpoints(const BlockPixels& pixels, const float* e0, const float* e1, Bc7Mode6& best) {
+	for (uint32_t p = 0; p < 4; p++) {
+		Bc7Mode6 mode;
+		mode.pBits[0] = p & 1;
+		mode.pBits[1] = p >> 1;
+		for (uint32_t c = 0; c < 4; c++) {
+			float q0 = (e0[c] - mode.pBits[0]) * 0.5f + 0.5f;
+			float q1 = (e1[c] - mode.pBits[1]) * 0.5f + 0.5f;
+			mode.quantized[0][c] = static_cast<uint32_t>(std::min(std::max(q0, 0.0f), 127.0f));
+			mode.quantized[1][c] = static_cast<uint32_t>(std::min(std::max(q1, 0.0f), 127.0f));
+		}
+		bc7Evaluate(pixels, mode);
+		if (mode.error < best.error) {
+			best = mode;
+		}
+	}
+}
+
+// 단일 구간 모드 (4 / 5 / 6) 비트 구성
+struct Bc7ModeInfo {
+	uint32_t colorBits;
+	uint32_t alphaBits;
+	uint32_t pBits;				// 끝점별 p-bit 유무
+	uint32_t indexBits;			// 첫 번째 인덱스 세트 비트 수
+	uint32_t secondIndexBits;	// 두 번째 인덱스 세트 비트 수 (없으면 0)
+	bool hasRotation;
+	bool hasIndexMode;
+};
+
+const Bc7ModeInfo BC7_SINGLE_SUBSET_MODES[3] = {
+	{5, 6, 0, 2, 3, true, true},		// 모드 4
+	{7, 8, 0, 2, 2, true, false},		// 모드 5
+	{7, 7, 1, 4, 0, false, false}		// 모드 6
+};
+
+uint32_t unquantize(uint32_t value, uint32_t bits) {
+	value <<= 8 - bits;
+	return value | (value >> bits);
+}
+
+const uint32_t* bc7Weights(uint32_t bits) {
+	return bits == 2 ? BC7_WEIGHTS2 : bits == 3 ? BC7_WEIGHTS3 : BC7_WEIGHTS4;
+}
+
+// 이미지에서 4x4 블록 읽기 (바깥 픽셀은 가장자리 값)
+void loadBlock(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, uint8_t* rgba) {
+	for (uint32_t y = 0; y < 4; y++) {
+		uint32_t sy = std::min(blockY * 4 + y, height - 1);
+		for (uint32_t x = 0; x < 4; x++) {
+			uint32_t sx = std::min(blockX * 4 + x, width - 1);
+			memcpy(rgba + (y * 4 + x) * 4, pixels + (size_t(sy) * width + sx) * 4, 4);
+		}
+	}
+}
+
+} // namespace
+
+uint32_t bcBlockSize(BcFormat format) {
+	return format == BC_FORMAT_BC1 ? 8 : 16;
+}
+
+size_t bcImageSize(BcFormat format, uint32_t width, uint32_t height) {
+	return size_t((width + 3) / 4) * ((height + 3) / 4) * bcBlockSize(format);
+}
+
+VkFormat bcVkFormat(BcFormat format, bool srgb) {
+	if (format == BC_FORMAT_BC1) {
+		return srgb ? VK_FORMAT_BC1_RGB_SRGB_BLOCK : VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+	}
+	return srgb ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK;
+}
+
+bool bcFormatFromVkFormat(VkFormat vkFormat, BcFormat& format, bool& srgb) {
+	switch (vkFormat) {
+	case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+	case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+		format = BC_FORMAT_BC1;
+		srgb = vkFormat == VK_FORMAT_BC1_RGB_SRGB_BLOCK;
+		return true;
+	case VK_FORMAT_BC7_UNORM_BLOCK:
+	case VK_FORMAT_BC7_SRGB_BLOCK:
+		format = BC_FORMAT_BC7;
+		srgb = vkFormat == VK_FORMAT_BC7_SRGB_BLOCK;
+		return true;
+	default:
+		return false;
+	}
+}
+
+void encodeBc1Block(const uint8_t* rgba, uint8_t* block) {
+	BlockPixels pixels;
+	for (uint32_t i = 0; i < 16; i++) {
+		for (uint32_t c = 0; c < 4; c++) {
+			pixels[i][c] = rgba[i * 4 + c];
+		}
+	}
+
+	float e0[4], e1[4];
+	axisEndpoints(pixels, 3, e0, e1);
+
+	uint16_t bestC0 = 0, bestC1 = 0;
+	uint32_t bestIndices = 0;
+	float bestError = 1e30f;
+	for (uint32_t iteration = 0; iteration <= BC_REFINE_ITERATIONS; iteration++) {
+		// 4 색 모드를 쓰도록 큰 값을 c0 으로
+		uint16_t c0 = packRgb565(e1);
+		uint16_t c1 = packRgb565(e0);
+		if (c0 < c1) {
+			std::swap(c0, c1);
+		}
+		uint32_t indices;
+		float error = bc1Evaluate(pixels, c0, c1, indices);
+		if (error < bestError) {
+			bestError = error;
+			bestC0 = c0;
+			bestC1 = c1;
+			bestIndices = indices;
+		}
+		if (iteration == BC_REFINE_ITERATIONS || c0 == c1) {
+			break;
+		}
+
+		// 현재 인덱스로 끝점 보정 (e0 → c0, e1 → c1)
+		float weights[16];
+		for (uint32_t i = 0; i < 16; i++) {
+			weights[i] = BC1_WEIGHTS[(indices >> (i * 2)) & 3];
+		}
+		float r0[4], r1[4];
+		if (!solveEndpoints(pixels, weights, 3, r0, r1)) {
+			break;
+		}
+		memcpy(e1, r0, sizeof(r0));
+		memcpy(e0, r1, sizeof(r1));
+	}
+
+	block[0] = static_cast<uint8_t>(bestC0);
+	block[1] = static_cast<uint8_t>(bestC0 >> 8);
+	block[2] = static_cast<uint8_t>(bestC1);
+	block[3] = static_cast<uint8_t>(bestC1 >> 8);
+	for (uint32_t i = 0; i < 4; i++) {
+		block[4 + i] = static_cast<uint8_t>(bestIndices >> (i * 8));
+	}
+}
+
+void encodeBc7Block(const uint8_t* rgba, uint8_t* block) {
+	BlockPixels pixels;
+	for (uint32_t i = 0; i < 16; i++) {
+		for (uint32_t c = 0; c < 4; c++) {
+			pixels[i][c] = rgba[i * 4 + c];
+		}
+	}
+
+	float e0[4], e1[4];
+	axisEndpoints(pixels, 4, e0, e1);
+
+	Bc7Mode6 best;
+	best.error = 1e30f;
+	bc7QuantizeEndpoints(pixels, e0, e1, best);
+	for (uint32_t iteration = 0; iteration < BC_REFINE_ITERATIONS && best.error > 0.0f; iteration++) {
+		float weights[16];
+		for (uint32_t i = 0; i < 16; i++) {
+			weights[i] = BC7_WEIGHTS4[best.indices[i]] / 64.0f;
+		}
+		if (!solveEndpoints(pixels, weights, 4, e0, e1)) {
+			break;
+		}
+		bc7QuantizeEndpoints(pixels, e0, e1, best);
+	}
+
+	// 첫 픽셀 인덱스 최상위 비트는 저장하지 않으므로 0 이 되도록 끝점 교환
+	if (best.indices[0] & 8) {
+		for (uint32_t c = 0; c < 4; c++) {
+			std::swap(best.quantized[0][c], best.quantized[1][c]);
+		}
+		std::swap(best.pBits[0], best.pBits[1]);
+		for (uint32_t i = 0; i < 16; i++) {
+			best.indices[i] = static_cast<uint8_t>(15 - best.indices[i]);
+		}
+	}
+
+	memset(block, 0, 16);
+	BitWriter writer{block};
+	writer.write(1u << 6, 7);
+	for (uint32_t c = 0; c < 4; c++) {
+		writer.write(best.quantized[0][c], 7);
+		writer.write(best.quantized[1][c], 7);
+	}
+	writer.write(best.pBits[0], 1);
+	writer.write(best.pBits[1], 1);
+	for (uint32_t i = 0; i < 16; i++) {
+		writer.write(best.indices[i], i == 0 ? 3 : 4);
+	}
+}
+
+void decodeBc1Block(const uint8_t* block, uint8_t* rgba) {
+	uint16_t c0 = static_cast<uint16_t>(block[0] | (block[1] << 8));
+	uint16_t c1 = static_cast<uint16_t>(block[2] | (block[3] << 8));
+	uint32_t indices = block[4] | (block[5] << 8) | (block[6] << 16) | (uint32_t(block[7]) << 24);
+
+	int32_t palette[4][3];
+	bc1Palette(c0, c1, palette);
+	for (uint32_t i = 0; i < 16; i++) {
+		const int32_t* color = palette[(indices >> (i * 2)) & 3];
+		rgba[i * 4 + 0] = static_cast<uint8_t>(color[0]);
+		rgba[i * 4 + 1] = static_cast<uint8_t>(color[1]);
+		rgba[i * 4 + 2] = static_cast<uint8_t>(color[2]);
+		rgba[i * 4 + 3] = 255;
+	}
+}
+
+void decodeBc7Block(const uint8_t* block, uint8_t* rgba) {
+	// 모드 = 첫 byte 최하위 1 비트 위치 (모드 비트가 없는 블록은 예약 값이므로 0 으로 복원)
+	uint32_t mode = 0;
+	while (mode < 8 && !(block[0] & (1u << mode))) {
+		mode++;
+	}
+	if (mode == 8) {
+		memset(rgba, 0, 64);
+		return;
+	}
+	if (mode < 4 || mode == 7) {
+		throw std::runtime_error("failed to decode bc7 block!");
+	}
+
+	const Bc7ModeInfo& info = BC7_SINGLE_SUBSET_MODES[mode - 4];
+	BitReader reader{block, mode + 1};
+	uint32_t rotation = info.hasRotation ? reader.read(2) : 0;
+	uint32_t indexMode = info.hasIndexMode ? reader.read(1) : 0;
+
+	uint32_t endpoints[2][4];
+	for (uint32_t c = 0; c < 4; c++) {
+		uint32_t bits = c < 3 ? info.colorBits : info.alphaBits;
+		endpoints[0][c] = reader.read(bits);
+		endpoints[1][c] = reader.read(bits);
+	}
+	for (uint32_t e = 0; e < 2; e++) {
+		uint32_t pBit = info.pBits ? reader.read(1) : 0;
+		for (uint32_t c = 0; c < 4; c++) {
+			uint32_t bits = c < 3 ? info.colorBits : info.alphaBits;
+			endpoints[e][c] = info.pBits ? (endpoints[e][c] << 1) | pBit : unquantize(endpoints[e][c], bits);
+		}
+	}
+
+	// 인덱스 세트 (첫 픽셀은 최상위 비트 생략)
+	uint32_t indices[2][16] = {};
+	uint32_t indexBits[2] = {info.indexBits, info.secondIndexBits};
+	for (uint32_t set = 0; set < 2 && indexBits[set]; set++) {
+		for (uint32_t i = 0; i < 16; i++) {
+			indices[set][i] = reader.read(i == 0 ? indexBits[set] - 1 : indexBits[set]);
+		}
+	}
+
+	// 색 / 알파가 쓰는 인덱스 세트 (모드 4 indexMode 1 이면 교환, 모드 6 은 둘 다 첫 번째 세트)
+	uint32_t colorSet = indexMode;
+	uint32_t alphaSet = info.secondIndexBits ? 1 - indexMode : 0;
+	const uint32_t* colorWeights = bc7Weights(indexBits[colorSet]);
+	const uint32_t* alphaWeights = bc7Weights(indexBits[alphaSet]);
+
+	for (uint32_t i = 0; i < 16; i++) {
+		uint32_t color[4];
+		for (uint32_t c = 0; c < 4; c++) {
+			uint32_t w = c < 3 ? colorWeights[indices[colorSet][i]] : alphaWeights[indices[alphaSet][i]];
+			color[c] = ((64 - w) * endpoints[0][c] + w * endpoints[1][c] + 32) >> 6;
+		}
+		if (rotation) {
+			std::swap(color[3], color[rotation - 1]);
+		}
+		for (uint32_t c = 0; c < 4; c++) {
+			rgba[i * 4 + c] = static_cast<uint8_t>(color[c]);
+		}
+	}
+}
+
+void encodeBcImage(const uint8_t* pixels, uint32_t width, uint32_t height, BcFormat format, uint8_t* blocks, ThreadPool* pool) {
+	uint32_t blocksX = (width + 3) / 4;
+	uint32_t blocksY = (height + 3) / 4;
+	uint32_t blockSize = bcBlockSize(format);
+	parallelFor(pool, blocksY, [&](uint32_t blockY) {
+		uint8_t rgba[64];
+		for (uint32_t blockX = 0; blockX < blocksX; blockX++) {
+			loadBlock(pixels, width, height, blockX, blockY, rgba);
+			uint8_t* block = blocks + (size_t(blockY) * blocksX + blockX) * blockSize;
+			if (format == BC_FORMAT_BC1) {
+				encodeBc1Block(rgba, block);
+			} else {
+				encodeBc7Block(rgba, block);
+			}
+		}
+	});
+}
+
+void decodeBcImage(const uint8_t* blocks, uint32_t width, uint32_t height, BcFormat format, uint8_t* pixels, ThreadPool* pool) {
+	uint32_t blocksX = (width + 3) / 4;
+	uint32_t blocksY = (height + 3) / 4;
+	uint32_t blockSize = bcBlockSize(format);
+	parallelFor(pool, blocksY, [&](uint32_t blockY) {
+		uint8_t rgba[64];
+		for (uint32_t blockX = 0; blockX < blocksX; blockX++) {
+			const uint8_t* block = blocks + (size_t(blockY) * blocksX + blockX) * blockSize;
+			if (format == BC_FORMAT_BC1) {
+				decodeBc1Block(block, rgba);
+			} else {
+				decodeBc7Block(block, rgba);
+			}
+
+			// 이미지 안쪽 픽셀만 복사
+			uint32_t rows = std::min(4u, height - blockY * 4);
+			uint32_t columns = std::min(4u, width - blockX * 4);
+			for (uint32_t y = 0; y < rows; y++) {
+				memcpy(pixels + ((size_t(blockY) * 4 + y) * width + blockX * 4) * 4, rgba + y * 16, columns * 4);
+			}
+		}
+	});
+}
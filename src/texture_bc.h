@@ -0,0 +1,46 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstddef>
+#include <cstdint>
+
+class ThreadPool;
+
+/*
+	[BC 블록 압축]
+	RGBA8 이미지를 4x4 블록 단위 BC1 / BC7 로 압축하고, 반대로 RGBA8 로 복원한다.
+	1. BC1 (8 byte / 블록, 불투명 RGB) : 주성분 축 양 끝을 565 끝점으로 잡고 최소제곱으로 끝점 보정 (빠른 경로)
+	2. BC7 (16 byte / 블록, RGBA) : 모드 6 (단일 구간, 7777 끝점 + 끝점별 p-bit, 4bit 인덱스)
+	   주성분 축으로 초기 끝점을 잡고 p-bit 조합 4 가지를 모두 평가한 뒤 최소제곱 보정 반복
+	압축은 sRGB 값 그대로 (감마 공간) 오차를 줄이고, 이미지 가장자리 블록은 바깥 픽셀을 가장자리 값으로 채운다.
+	복원은 BC1 전체와 BC7 단일 구간 모드 (4 / 5 / 6) 를 지원 (분할 모드는 예외 발생)
+*/
+
+// 블록 압축 형식
+enum BcFormat : uint32_t {
+	BC_FORMAT_BC1,			// VK_FORMAT_BC1_RGB_*_BLOCK
+	BC_FORMAT_BC7			// VK_FORMAT_BC7_*_BLOCK
+};
+
+// 블록 1 개의 byte 크기
+uint32_t bcBlockSize(BcFormat format);
+
+// width x height 이미지를 압축한 byte 크기
+size_t bcImageSize(BcFormat format, uint32_t width, uint32_t height);
+
+// 형식에 대응하는 VkFormat (srgb 가 true 면 *_SRGB_BLOCK)
+VkFormat bcVkFormat(BcFormat format, bool srgb);
+
+// VkFormat 에 대응하는 압축 형식 (BC1 RGB / RGBA, BC7 이 아니면 false)
+bool bcFormatFromVkFormat(VkFormat vkFormat, BcFormat& format, bool& srgb);
+
+// 블록 1 개 압축 / 복원 (rgba 는 4x4 픽셀 RGBA8, 행 순서)
+void encodeBc1Block(const uint8_t* rgba, uint8_t* block);
+void encodeBc7Block(const uint8_t* rgba, uint8_t* block);
+void decodeBc1Block(const uint8_t* block, uint8_t* rgba);
+void decodeBc7Block(const uint8_t* block, uint8_t* rgba);
+
+// RGBA8 이미지 전체 압축 / 복원 (블록 행 단위 병렬 처리, pool이 nullptr 이면 호출 스레드에서 처리)
+void encodeBcImage(const uint8_t* pixels, uint32_t width, uint32_t height, BcFormat format, uint8_t* blocks, ThreadPool* pool);
+void decodeBcImage(const uint8_t* blocks, uint32_t width, uint32_t height, BcFormat format, uint8_t* pixels, ThreadPool* pool);
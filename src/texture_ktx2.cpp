@@ -0,0 +1,255 @@
+#include "texture_ktx2.h"
+#include "texture_bc.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+const uint8_t KTX2_IDENTIFIER[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+// KTXwriter 키 값 (파일을 만든 도구)
+const char KTX2_WRITER_KEY[] = "KTXwriter";
+const char KTX2_WRITER_VALUE[] = "texture_ktx2";
+
+// Data Format Descriptor 값 (Khronos Data Format 1.3)
+const uint32_t KHR_DF_VERSION = 2;
+const uint32_t KHR_DF_MODEL_BC1A = 128;
+const uint32_t KHR_DF_MODEL_BC7 = 134;
+const uint32_t KHR_DF_PRIMARIES_BT709 = 1;
+const uint32_t KHR_DF_TRANSFER_LINEAR = 1;
+const uint32_t KHR_DF_TRANSFER_SRGB = 2;
+
+// 파일 맨 앞 헤더 + 인덱스 (뒤에 레벨 인덱스가 levelCount 개 이어짐)
+struct Ktx2Header {
+	uint8_t identifier[12];
+	uint32_t vkFormat;
+	uint32_t typeSize;
+	uint32_t pixelWidth;
+	uint32_t pixelHeight;
+	uint32_t pixelDepth;
+	uint32_t layerCount;
+	uint32_t faceCount;
+	uint32_t levelCount;
+	uint32_t supercompressionScheme;
+	uint32_t dfdByteOffset;
+	uint32_t dfdByteLength;
+	uint32_t kvdByteOffset;
+	uint32_t kvdByteLength;
+	uint64_t sgdByteOffset;
+	uint64_t sgdByteLength;
+};
+static_assert(sizeof(Ktx2Header) == 80, "KTX2 header must be packed");
+
+// 레벨 1 개의 파일 위치
+struct Ktx2LevelIndex {
+	uint64_t byteOffset;
+	uint64_t byteLength;
+	uint64_t uncompressedByteLength;
+};
+
+// 형식별 블록 크기 (byte) 와 블록 한 변의 픽셀 수 (지원하지 않는 형식이면 false)
+bool formatBlock(VkFormat format, uint32_t& blockBytes, uint32_t& blockDimension) {
+	BcFormat bcFormat;
+	bool srgb;
+	if (bcFormatFromVkFormat(format, bcFormat, srgb)) {
+		blockBytes = bcBlockSize(bcFormat);
+		blockDimension = 4;
+		return true;
+	}
+	if (format == VK_FORMAT_R8G8B8A8_UNORM || format == VK_FORMAT_R8G8B8A8_SRGB) {
+		blockBytes = 4;
+		blockDimension = 1;
+		return true;
+	}
+	return false;
+}
+
+size_t levelSize(uint32_t width, uint32_t height, uint32_t blockBytes, uint32_t blockDimension) {
+	return size_t((width + blockDimension - 1) / blockDimension) * ((height + blockDimension - 1) / blockDimension) * blockBytes;
+}
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) {
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+// 블록 압축 형식 1 개 채널짜리 Basic Data Format Descriptor (dfdTotalSize 포함)
+std::vector<uint32_t> makeDataFormatDescriptor(VkFormat format) {
+	BcFormat bcFormat;
+	bool srgb;
+	bcFormatFromVkFormat(format, bcFormat, srgb);
+	uint32_t blockBytes = bcBlockSize(bcFormat);
+	uint32_t colorModel = bcFormat == BC_FORMAT_BC1 ? KHR_DF_MODEL_BC1A : KHR_DF_MODEL_BC7;
+	uint32_t transfer = srgb ? KHR_DF_TRANSFER_SRGB : KHR_DF_TRANSFER_LINEAR;
+
+	const uint32_t blockSize = 24 + 16;		// 기본 블록 + 샘플 1 개
+	return {
+		4 + blockSize,														// dfdTotalSize
+		0,																	// vendorId (Khronos) / descriptorType (basic)
+		KHR_DF_VERSION | (blockSize << 16),									// versionNumber / descriptorBlockSize
+		colorModel | (KHR_DF_PRIMARIES_BT709 << 8) | (transfer << 16),		// colorModel / primaries / transfer / flags
+		3 | (3 << 8),														// texelBlockDimension (4x4x1x1, 값 - 1)
+		blockBytes,															// bytesPlane0
+		0,																	// bytesPlane4 ~ 7
+		(blockBytes * 8 - 1) << 16,											// 샘플: bitOffset 0 / bitLength / channelType COLOR
+		0,																	// samplePosition
+		0,																	// sampleLower
+		0xFFFFFFFF															// sampleUpper
+	};
+}
+
+} // namespace
+
+bool Ktx2File::open(const std::string& path) {
+	close();
+
+	if (!file.open(path)) {
+		return false;
+	}
+	if (!parse(file.data(), file.size())) {
+		close();
+		throw std::runtime_error("failed to parse ktx2 file!");
+	}
+	return true;
+}
+
+void Ktx2File::open(const uint8_t* data, size_t size) {
+	close();
+
+	if (!parse(data, size)) {
+		close();
+		throw std::runtime_error("failed to parse ktx2 file!");
+	}
+}
+
+bool Ktx2File::parse(const uint8_t* data, size_t size) {
+	// 헤더 검증 (2D 텍스처 1 장, supercompression 없음)
+	Ktx2Header header;
+	if (size < sizeof(header)) {
+		return false;
+	}
+	memcpy(&header, data, sizeof(header));
+
+	uint32_t blockBytes = 0, blockDimension = 0;
+	bool valid = memcmp(header.identifier, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) == 0
+		&& formatBlock(static_cast<VkFormat>(header.vkFormat), blockBytes, blockDimension)
+		&& header.pixelWidth > 0
+		&& header.pixelHeight > 0
+		&& header.pixelDepth == 0
+		&& header.layerCount <= 1
+		&& header.faceCount == 1
+		&& header.levelCount > 0
+		&& header.levelCount <= mipLevelCount(header.pixelWidth, header.pixelHeight)
+		&& header.supercompressionScheme == 0
+		&& sizeof(header) + uint64_t(header.levelCount) * sizeof(Ktx2LevelIndex) <= size;
+
+	// 레벨 검증 (크기가 형식과 일치하고 데이터 범위 안에 있는지)
+	for (uint32_t i = 0; valid && i < header.levelCount; i++) {
+		Ktx2LevelIndex index;
+		memcpy(&index, data + sizeof(header) + i * sizeof(index), sizeof(index));
+
+		MipLevel level;
+		level.width = std::max(header.pixelWidth >> i, 1u);
+		level.height = std::max(header.pixelHeight >> i, 1u);
+		level.offset = static_cast<size_t>(index.byteOffset);
+		level.size = levelSize(level.width, level.height, blockBytes, blockDimension);
+		valid = index.byteLength == level.size
+			&& index.byteOffset % blockBytes == 0
+			&& index.byteOffset <= size
+			&& index.byteLength <= size - index.byteOffset;
+		mipLevels.push_back(level);
+	}
+
+	if (!valid) {
+		return false;
+	}
+	fileData = data;
+	vkFormat = static_cast<VkFormat>(header.vkFormat);
+	return true;
+}
+
+void Ktx2File::close() {
+	file.close();
+	fileData = nullptr;
+	vkFormat = VK_FORMAT_UNDEFINED;
+	mipLevels.clear();
+}
+
+bool Ktx2File::write(const std::string& path, VkFormat format, const MipLevel* levels, uint32_t levelCount, const uint8_t* data) {
+	BcFormat bcFormat;
+	bool srgb;
+	if (levelCount == 0 || !bcFormatFromVkFormat(format, bcFormat, srgb)) {
+		return false;
+	}
+	uint64_t alignment = std::max<uint64_t>(bcBlockSize(bcFormat), 4);
+
+	std::vector<uint32_t> dfd = makeDataFormatDescriptor(format);
+
+	// KTXwriter 키 / 값 (길이 + 키\0 + 값\0, 4 byte 정렬)
+	uint32_t kvdEntryLength = sizeof(KTX2_WRITER_KEY) + sizeof(KTX2_WRITER_VALUE);
+	std::vector<uint8_t> kvd(alignUp(4 + kvdEntryLength, 4), 0);
+	memcpy(kvd.data(), &kvdEntryLength, 4);
+	memcpy(kvd.data() + 4, KTX2_WRITER_KEY, sizeof(KTX2_WRITER_KEY));
+	memcpy(kvd.data() + 4 + sizeof(KTX2_WRITER_KEY), KTX2_WRITER_VALUE, sizeof(KTX2_WRITER_VALUE));
+
+	Ktx2Header header{};
+	memcpy(header.identifier, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER));
+	header.vkFormat = static_cast<uint32_t>(format);
+	header.typeSize = 1;
+	header.pixelWidth = levels[0].width;
+	header.pixelHeight = levels[0].height;
+	header.faceCount = 1;
+	header.levelCount = levelCount;
+	header.dfdByteOffset = static_cast<uint32_t>(sizeof(header) + levelCount * sizeof(Ktx2LevelIndex));
+	header.dfdByteLength = static_cast<uint32_t>(dfd.size() * sizeof(uint32_t));
+	header.kvdByteOffset = header.dfdByteOffset + header.dfdByteLength;
+	header.kvdByteLength = 4 + kvdEntryLength;
+
+	// 레벨 데이터 배치 (가장 작은 레벨부터, 블록 크기 정렬)
+	std::vector<Ktx2LevelIndex> levelIndex(levelCount);
+	uint64_t offset = header.kvdByteOffset + kvd.size();
+	for (uint32_t i = levelCount; i-- > 0;) {
+		offset = alignUp(offset, alignment);
+		levelIndex[i].byteOffset = offset;
+		levelIndex[i].byteLength = levels[i].size;
+		levelIndex[i].uncompressedByteLength = levels[i].size;
+		offset += levels[i].size;
+	}
+
+	// 쓰는 도중 종료되어도 깨진 파일이 남지 않도록 임시 파일에 먼저 기록
+	std::string tempPath = path + ".tmp";
+	{
+		std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+		if (!out.is_open()) {
+			return false;
+		}
+
+		const char padding[16] = {};
+		out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		out.write(reinterpret_cast<const char*>(levelIndex.data()), levelIndex.size() * sizeof(Ktx2LevelIndex));
+		out.write(reinterpret_cast<const char*>(dfd.data()), dfd.size() * sizeof(uint32_t));
+		out.write(reinterpret_cast<const char*>(kvd.data()), kvd.size());
+
+		uint64_t written = header.kvdByteOffset + kvd.size();
+		for (uint32_t i = levelCount; i-- > 0;) {
+			out.write(padding, levelIndex[i].byteOffset - written);
+			out.write(reinterpret_cast<const char*>(data + levels[i].offset), levels[i].size);
+			written = levelIndex[i].byteOffset + levels[i].size;
+		}
+
+		if (!out.good()) {
+			return false;
+		}
+	}
+
+	std::error_code ec;
+	std::filesystem::rename(tempPath, path, ec);
+	if (ec) {
+		std::filesystem::remove(tempPath, ec);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "mapped_file.h"
+#include "texture_mip.h"
+
+#include <vulkan/vulkan.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+	[KTX2 텍스처 파일]
+	Khronos KTX 2.0 컨테이너로 밉 레벨 전체를 VkFormat 블록 그대로 저장 / 로드한다.
+	(2D 텍스처 1 장, 배열 / 큐브맵 / supercompression 미지원)
+
+	파일 구성
+	1. 식별자 + 헤더 (vkFormat, 크기, 레벨 수) + 인덱스 (DFD / KVD / SGD 위치)
+	2. 레벨 인덱스 (레벨 0 부터 위치 / 크기)
+	3. Data Format Descriptor (색 모델, 전달 함수) + Key/Value 데이터 (KTXwriter)
+	4. 레벨 데이터 (가장 작은 레벨부터, 블록 크기 정렬)
+*/
+
+class Ktx2File {
+public:
+	// 파일을 매핑하고 헤더 / 레벨 인덱스 검증 (파일이 없으면 false, 형식이 잘못되면 예외 발생)
+	bool open(const std::string& path);
+	// 이미 매핑된 메모리 (에셋 팩 등) 의 KTX2 데이터 사용 (data 는 close 전까지 유효해야 함, 형식이 잘못되면 예외 발생)
+	void open(const uint8_t* data, size_t size);
+	// 매핑 해제
+	void close();
+
+	// 밉 레벨 배열을 KTX2 파일로 저장 (levels 의 offset 은 data 기준, 임시 파일에 쓴 뒤 교체 / 실패시 false)
+	static bool write(const std::string& path, VkFormat format, const MipLevel* levels, uint32_t levelCount, const uint8_t* data);
+
+	bool isOpen() const { return fileData != nullptr; }
+	VkFormat format() const { return vkFormat; }
+	// 레벨 0 부터 크기 / 위치 (offset 은 data() 기준)
+	const std::vector<MipLevel>& levels() const { return mipLevels; }
+	const uint8_t* data() const { return fileData; }
+
+private:
+	// 헤더 / 레벨 인덱스 검증 (형식이 잘못되면 false)
+	bool parse(const uint8_t* data, size_t size);
+
+	MappedFile file;
+	const uint8_t* fileData = nullptr;	// file 또는 외부 메모리
+	VkFormat vkFormat = VK_FORMAT_UNDEFINED;
+	std::vector<MipLevel> mipLevels;
+};
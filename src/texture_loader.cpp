@@ -0,0 +1,111 @@
+#include "texture_loader.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+// 디코딩 중인 스레드의 출력 영역 (stb_image 의 최종 출력 할당을 이 영역으로 돌림)
+struct DecodeTarget {
+	uint8_t* data = nullptr;
+	size_t size = 0;
+	bool assigned = false;		// stb_image 에 이미 넘겼는지
+};
+
+thread_local DecodeTarget decodeTarget;
+
+// 출력 크기와 같은 첫 할당에 출력 영역을 넘김 (RGBA8 최종 이미지 버퍼)
+void* decodeMalloc(size_t size) {
+	if (decodeTarget.data != nullptr && !decodeTarget.assigned && size == decodeTarget.size) {
+		decodeTarget.assigned = true;
+		return decodeTarget.data;
+	}
+	return malloc(size);
+}
+
+// 출력 영역을 중간 버퍼로 쓰다가 크기를 바꾸면 일반 할당으로 옮김
+void* decodeRealloc(void* p, size_t size) {
+	if (p != nullptr && p == decodeTarget.data) {
+		void* moved = malloc(size);
+		if (moved != nullptr) {
+			memcpy(moved, p, std::min(size, decodeTarget.size));
+		}
+		return moved;
+	}
+	return realloc(p, size);
+}
+
+// 출력 영역은 호출자 소유이므로 해제하지 않음
+void decodeFree(void* p) {
+	if (p != nullptr && p == decodeTarget.data) {
+		return;
+	}
+	free(p);
+}
+
+} // namespace
+
+#define STBI_MALLOC(size) decodeMalloc(size)
+#define STBI_REALLOC(p, size) decodeRealloc(p, size)
+#define STBI_FREE(p) decodeFree(p)
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb/stb_image.h>
+
+size_t probeTextureImages(std::vector<TextureImage>& images, ThreadPool* pool) {
+	// 헤더 읽기 (이미지마다 파일을 열어야 하므로 병렬)
+	std::vector<uint8_t> valid(images.size());
+	parallelFor(pool, static_cast<uint32_t>(images.size()), [&](uint32_t i) {
+		int texWidth, texHeight, texChannels;
+		valid[i] = stbi_info(images[i].path.c_str(), &texWidth, &texHeight, &texChannels) != 0;
+		images[i].width = valid[i] ? static_cast<uint32_t>(texWidth) : 0;
+		images[i].height = valid[i] ? static_cast<uint32_t>(texHeight) : 0;
+	});
+
+	// 출력 위치 배치 (이미지 순서대로 정렬해서 이어 붙임)
+	size_t offset = 0;
+	for (size_t i = 0; i < images.size(); i++) {
+		if (!valid[i]) {
+			throw std::runtime_error("failed to load texture image!");
+		}
+		offset = (offset + TEXTURE_IMAGE_ALIGNMENT - 1) / TEXTURE_IMAGE_ALIGNMENT * TEXTURE_IMAGE_ALIGNMENT;
+		images[i].offset = offset;
+		images[i].size = size_t(images[i].width) * images[i].height * 4;
+		offset += images[i].size;
+	}
+	return offset;
+}
+
+uint32_t decodeTextureImages(const std::vector<TextureImage>& images, uint8_t* staging, ThreadPool* pool) {
+	std::atomic<uint32_t> inPlaceCount{0};
+	parallelFor(pool, static_cast<uint32_t>(images.size()), [&](uint32_t i) {
+		const TextureImage& image = images[i];
+		uint8_t* output = staging + image.offset;
+
+		decodeTarget.data = output;
+		decodeTarget.size = image.size;
+		decodeTarget.assigned = false;
+		int texWidth, texHeight, texChannels;
+		stbi_uc* pixels = stbi_load(image.path.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha); // 알파 채널을 포함하여 rgba 픽셀로 이미지 저장
+		decodeTarget = DecodeTarget();
+
+		// 헤더를 읽은 뒤 파일이 바뀐 경우도 실패로 처리
+		if (!pixels || static_cast<uint32_t>(texWidth) != image.width || static_cast<uint32_t>(texHeight) != image.height) {
+			if (pixels != output) {
+				stbi_image_free(pixels);
+			}
+			throw std::runtime_error("failed to load texture image!");
+		}
+
+		if (pixels == output) {
+			inPlaceCount++;
+		} else {
+			memcpy(output, pixels, image.size);
+			stbi_image_free(pixels);
+		}
+	});
+	return inPlaceCount;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ThreadPool;
+
+/*
+	[텍스처 이미지 병렬 디코딩]
+	여러 이미지 (재질 텍스처 등) 를 스레드 풀에서 이미지 1 개씩 동시에 RGBA8 로 디코딩한다.
+	1. probeTextureImages : 헤더만 읽어서 크기를 확정하고 출력 위치를 배치 (호출자는 전체 크기로 스테이징 영역을 미리 할당)
+	2. decodeTextureImages : stb_image 의 최종 출력 할당을 이미지별 스테이징 위치로 돌려서 디코딩 결과를 복사 없이 바로 기록
+	   (16 bit PNG 변환처럼 출력 크기와 다른 할당을 거치는 경우는 결과를 복사)
+	stb_image 구현은 이 모듈에만 포함 (다른 파일은 헤더만 include)
+*/
+
+// 출력 위치 정렬 (SSE 로드 / 블록 압축 입력 정렬)
+const size_t TEXTURE_IMAGE_ALIGNMENT = 16;
+
+// 디코딩할 이미지 1 개
+struct TextureImage {
+	std::string path;
+	uint32_t width = 0;
+	uint32_t height = 0;
+	size_t offset = 0;			// 스테이징 영역 안의 RGBA8 출력 위치
+	size_t size = 0;			// width * height * 4
+};
+
+// 이미지 헤더를 병렬로 읽어서 크기 / 출력 위치를 채우고 전체 byte 크기 반환 (읽을 수 없으면 예외 발생)
+size_t probeTextureImages(std::vector<TextureImage>& images, ThreadPool* pool);
+
+// 이미지들을 staging 의 각 위치에 병렬로 디코딩하고 복사 없이 바로 기록된 이미지 수 반환 (실패시 예외 발생)
+uint32_t decodeTextureImages(const std::vector<TextureImage>& images, uint8_t* staging, ThreadPool* pool);
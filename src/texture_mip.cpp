@@ -0,0 +1,289 @@
+#include "texture_mip.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__SSE2__)
+	#include <xmmintrin.h>
+	#define TEXTURE_MIP_SSE
+#endif
+
+namespace {
+
+// 병렬 작업 1 개가 만드는 출력 행 수
+const uint32_t MIP_BAND_ROWS = 32;
+
+// Kaiser 필터 반경 (출력 픽셀 단위) / 창 모양
+const float MIP_KAISER_WIDTH = 3.0f;
+const float MIP_KAISER_ALPHA = 4.0f;
+
+const float PI = 3.14159265358979f;
+
+// 축 1 개의 출력 픽셀별 필터 가중치 (원본 [first, first + count) 구간, 가장자리는 clamp 해서 안쪽 가중치에 합침)
+struct MipAxisWeights {
+	uint32_t tapCount = 0;				// 출력 픽셀당 최대 tap 수 (weights 는 출력 픽셀마다 tapCount 개씩)
+	std::vector<uint32_t> first;
+	std::vector<uint32_t> count;
+	std::vector<float> weights;
+};
+
+// sRGB 8bit → 선형 값 / 선형 값 → sRGB 8bit 반올림 경계
+struct SrgbTables {
+	float toLinear[256];
+	float thresholds[255];				// thresholds[i] 이상이면 i + 1 로 반올림
+	uint8_t coarse[4096];				// 선형 값 4096 구간별 시작 후보 (구간 안에서 최대 1 단계 보정)
+
+	SrgbTables() {
+		for (uint32_t i = 0; i < 256; i++) {
+			toLinear[i] = decode(i / 255.0);
+		}
+		for (uint32_t i = 0; i < 255; i++) {
+			thresholds[i] = decode((i + 0.5) / 255.0);
+		}
+		uint32_t value = 0;
+		for (uint32_t i = 0; i < 4096; i++) {
+			float linear = i / 4095.0f;
+			while (value < 255 && linear >= thresholds[value]) {
+				value++;
+			}
+			coarse[i] = static_cast<uint8_t>(value);
+		}
+	}
+
+	static float decode(double srgb) {
+		return static_cast<float>(srgb <= 0.04045 ? srgb / 12.92 : std::pow((srgb + 0.055) / 1.055, 2.4));
+	}
+
+	uint8_t encode(float linear) const {
+		linear = std::min(std::max(linear, 0.0f), 1.0f);
+		uint32_t value = coarse[static_cast<uint32_t>(linear * 4095.0f)];
+		while (value < 255 && linear >= thresholds[value]) {
+			value++;
+		}
+		return static_cast<uint8_t>(value);
+	}
+};
+
+const SrgbTables& srgbTables() {
+	static const SrgbTables tables;
+	return tables;
+}
+
+// 0 차 수정 베셀 함수 (Kaiser 창 계산용 급수)
+double besselI0(double x) {
+	double sum = 1.0;
+	double term = 1.0;
+	for (int k = 1; k < 32; k++) {
+		term *= (x / (2.0 * k)) * (x / (2.0 * k));
+		sum += term;
+	}
+	return sum;
+}
+
+// 출력 픽셀 단위 거리 x 의 Kaiser 창 sinc 값
+float kaiserWeight(float x) {
+	if (std::fabs(x) >= MIP_KAISER_WIDTH) {
+		return 0.0f;
+	}
+	float t = x / MIP_KAISER_WIDTH;
+	double window = besselI0(MIP_KAISER_ALPHA * std::sqrt(1.0 - t * t)) / besselI0(MIP_KAISER_ALPHA);
+	double sinc = x == 0.0f ? 1.0 : std::sin(PI * x) / (PI * x);
+	return static_cast<float>(window * sinc);
+}
+
+// source → destination 크기의 축 가중치 계산 (합이 1 이 되도록 정규화)
+MipAxisWeights computeAxisWeights(uint32_t source, uint32_t destination, MipFilter filter) {
+	float scale = static_cast<float>(source) / destination;
+	float radius = filter == MIP_FILTER_BOX ? scale * 0.5f : MIP_KAISER_WIDTH * scale;
+
+	MipAxisWeights axis;
+	axis.tapCount = static_cast<uint32_t>(std::ceil(radius * 2.0f)) + 2;
+	axis.first.resize(destination);
+	axis.count.resize(destination);
+	axis.weights.assign(size_t(destination) * axis.tapCount, 0.0f);
+
+	for (uint32_t x = 0; x < destination; x++) {
+		float center = (x + 0.5f) * scale;
+		int32_t begin = static_cast<int32_t>(std::floor(center - radius));
+		int32_t end = static_cast<int32_t>(std::ceil(center + radius));
+		int32_t first = std::max(begin, 0);
+		int32_t last = std::min(end, static_cast<int32_t>(source)) - 1;
+		float* weights = axis.weights.data() + size_t(x) * axis.tapCount;
+
+		float sum = 0.0f;
+		for (int32_t i = begin; i < end; i++) {
+			float weight;
+			if (filter == MIP_FILTER_BOX) {
+				// 원본 픽셀 [i, i + 1] 과 출력 픽셀 구간이 겹치는 길이
+				weight = std::max(0.0f, std::min(i + 1.0f, center + radius) - std::max(static_cast<float>(i), center - radius));
+			} else {
+				weight = kaiserWeight((i + 0.5f - center) / scale);
+			}
+			int32_t clamped = std::min(std::max(i, first), last);
+			weights[clamped - first] += weight;
+			sum += weight;
+		}
+		for (int32_t i = 0; i <= last - first; i++) {
+			weights[i] /= sum;
+		}
+		axis.first[x] = static_cast<uint32_t>(first);
+		axis.count[x] = static_cast<uint32_t>(last - first + 1);
+	}
+	return axis;
+}
+
+// out = Σ weights[k] * source[k * stride] (RGBA 픽셀 1 개)
+void filterPixel(const float* source, size_t stride, const float* weights, uint32_t count, float* out) {
+#ifdef TEXTURE_MIP_SSE
+	__m128 sum = _mm_setzero_ps();
+	for (uint32_t k = 0; k < count; k++) {
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[k]), _mm_loadu_ps(source + k * stride)));
+	}
+	_mm_storeu_ps(out, sum);
+#else
+	float sum[4] = {};
+	for (uint32_t k = 0; k < count; k++) {
+		for (uint32_t c = 0; c < 4; c++) {
+			sum[c] += weights[k] * source[k * stride + c];
+		}
+	}
+	memcpy(out, sum, sizeof(sum));
+#endif
+}
+
+// out 행 += weight * row 행 (RGBA 픽셀 pixelCount 개)
+void accumulateRow(float* out, const float* row, float weight, uint32_t pixelCount) {
+#ifdef TEXTURE_MIP_SSE
+	__m128 w = _mm_set1_ps(weight);
+	for (uint32_t i = 0; i < pixelCount; i++) {
+		_mm_storeu_ps(out + i * 4, _mm_add_ps(_mm_loadu_ps(out + i * 4), _mm_mul_ps(w, _mm_loadu_ps(row + i * 4))));
+	}
+#else
+	for (uint32_t i = 0; i < pixelCount * 4; i++) {
+		out[i] += weight * row[i];
+	}
+#endif
+}
+
+// sRGB 8bit 행 → 선형 float 행
+void decodeRow(const uint8_t* source, uint32_t pixelCount, float* out) {
+	const SrgbTables& tables = srgbTables();
+	for (uint32_t i = 0; i < pixelCount; i++) {
+		out[i * 4 + 0] = tables.toLinear[source[i * 4 + 0]];
+		out[i * 4 + 1] = tables.toLinear[source[i * 4 + 1]];
+		out[i * 4 + 2] = tables.toLinear[source[i * 4 + 2]];
+		out[i * 4 + 3] = source[i * 4 + 3] * (1.0f / 255.0f);
+	}
+}
+
+// 선형 float 행 → sRGB 8bit 행 (Kaiser 음수 lobe 로 범위를 벗어난 값은 잘라냄)
+void encodeRow(const float* source, uint32_t pixelCount, uint8_t* out) {
+	const SrgbTables& tables = srgbTables();
+	for (uint32_t i = 0; i < pixelCount; i++) {
+		out[i * 4 + 0] = tables.encode(source[i * 4 + 0]);
+		out[i * 4 + 1] = tables.encode(source[i * 4 + 1]);
+		out[i * 4 + 2] = tables.encode(source[i * 4 + 2]);
+		float alpha = std::min(std::max(source[i * 4 + 3], 0.0f), 1.0f);
+		out[i * 4 + 3] = static_cast<uint8_t>(alpha * 255.0f + 0.5f);
+	}
+}
+
+/*
+	[레벨 1 개 다운샘플]
+	출력 행 묶음마다 필요한 원본 행만 가로 필터링한 뒤 세로 가중치로 합침
+	source 는 선형 float 이전 레벨 (sourceSrgb 가 있으면 레벨 0 의 sRGB 8bit 를 행마다 변환해서 사용)
+*/
+void downsampleLevel(const float* source, const uint8_t* sourceSrgb, uint32_t sourceWidth, uint32_t sourceHeight,
+					 uint32_t width, uint32_t height, MipFilter filter, float* output, uint8_t* outputSrgb, ThreadPool* pool) {
+	MipAxisWeights horizontal = computeAxisWeights(sourceWidth, width, filter);
+	MipAxisWeights vertical = computeAxisWeights(sourceHeight, height, filter);
+
+	uint32_t bandCount = (height + MIP_BAND_ROWS - 1) / MIP_BAND_ROWS;
+	parallelFor(pool, bandCount, [&](uint32_t band) {
+		uint32_t firstRow = band * MIP_BAND_ROWS;
+		uint32_t lastRow = std::min(firstRow + MIP_BAND_ROWS, height);
+
+		// 이 묶음이 읽는 원본 행 구간
+		uint32_t sourceFirst = vertical.first[firstRow];
+		uint32_t sourceEnd = 0;
+		for (uint32_t y = firstRow; y < lastRow; y++) {
+			sourceEnd = std::max(sourceEnd, vertical.first[y] + vertical.count[y]);
+		}
+
+		// 1. 원본 행 가로 필터링
+		std::vector<float> decoded(sourceSrgb ? size_t(sourceWidth) * 4 : 0);
+		std::vector<float> filtered(size_t(sourceEnd - sourceFirst) * width * 4);
+		for (uint32_t y = sourceFirst; y < sourceEnd; y++) {
+			const float* row;
+			if (sourceSrgb) {
+				decodeRow(sourceSrgb + size_t(y) * sourceWidth * 4, sourceWidth, decoded.data());
+				row = decoded.data();
+			} else {
+				row = source + size_t(y) * sourceWidth * 4;
+			}
+			float* out = filtered.data() + size_t(y - sourceFirst) * width * 4;
+			for (uint32_t x = 0; x < width; x++) {
+				filterPixel(row + size_t(horizontal.first[x]) * 4, 4, horizontal.weights.data() + size_t(x) * horizontal.tapCount,
+							horizontal.count[x], out + size_t(x) * 4);
+			}
+		}
+
+		// 2. 세로 합치기 + sRGB 출력
+		for (uint32_t y = firstRow; y < lastRow; y++) {
+			float* out = output + size_t(y) * width * 4;
+			std::fill(out, out + size_t(width) * 4, 0.0f);
+			const float* weights = vertical.weights.data() + size_t(y) * vertical.tapCount;
+			for (uint32_t k = 0; k < vertical.count[y]; k++) {
+				accumulateRow(out, filtered.data() + size_t(vertical.first[y] + k - sourceFirst) * width * 4, weights[k], width);
+			}
+			encodeRow(out, width, outputSrgb + size_t(y) * width * 4);
+		}
+	});
+}
+
+} // namespace
+
+uint32_t mipLevelCount(uint32_t width, uint32_t height) {
+	uint32_t levels = 1;
+	for (uint32_t size = std::max(width, height); size > 1; size /= 2) {
+		levels++;
+	}
+	return levels;
+}
+
+void layoutMipChain(uint32_t width, uint32_t height, MipChain& chain) {
+	// 레벨 크기 / 위치 계산 후 전체 버퍼 1 회 할당
+	chain.levels.resize(mipLevelCount(width, height));
+	size_t offset = 0;
+	for (uint32_t i = 0; i < chain.levels.size(); i++) {
+		MipLevel& level = chain.levels[i];
+		level.width = std::max(width >> i, 1u);
+		level.height = std::max(height >> i, 1u);
+		level.offset = offset;
+		level.size = size_t(level.width) * level.height * 4;
+		offset += level.size;
+	}
+	chain.pixels.resize(offset);
+}
+
+void generateMipLevels(MipChain& chain, MipFilter filter, ThreadPool* pool) {
+	// 이전 레벨 선형 값에서 다음 레벨 계산 (레벨 0 은 sRGB 에서 바로 읽음)
+	std::vector<float> previous;
+	std::vector<float> current;
+	for (uint32_t i = 1; i < chain.levels.size(); i++) {
+		const MipLevel& source = chain.levels[i - 1];
+		const MipLevel& level = chain.levels[i];
+		current.resize(size_t(level.width) * level.height * 4);
+		downsampleLevel(previous.data(), i == 1 ? chain.pixels.data() : nullptr, source.width, source.height, level.width, level.height,
+						filter, current.data(), chain.pixels.data() + level.offset, pool);
+		std::swap(previous, current);
+	}
+}
+
+void buildMipChain(const uint8_t* pixels, uint32_t width, uint32_t height, MipFilter filter, MipChain& chain, ThreadPool* pool) {
+	layoutMipChain(width, height, chain);
+	memcpy(chain.pixels.data(), pixels, chain.levels[0].size);
+	generateMipLevels(chain, filter, pool);
+}
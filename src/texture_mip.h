@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class ThreadPool;
+
+/*
+	[CPU 밉맵 생성]
+	RGBA8 sRGB 이미지의 밉 체인을 CPU 에서 만든다. (GPU blit 없이 모든 레벨을 한 번에 업로드)
+	1. 이전 레벨을 선형 공간 float 로 두고 가로 → 세로 분리 필터로 절반 크기 레벨 계산
+	   (레벨 0 은 sRGB → 선형 변환 테이블로 줄 단위 변환, 알파는 그대로 선형)
+	2. 필터는 면적 평균 box 또는 Kaiser 창 sinc 중 선택 (홀수 크기는 출력 픽셀이 덮는 원본 구간 기준으로 가중치 계산)
+	3. 결과를 sRGB 로 다시 변환해서 (반올림 경계 테이블로 정확히 반올림) 한 버퍼에 레벨 순서대로 저장
+	픽셀 1 개(RGBA float)를 SSE 레지스터 1 개로 처리하고, 레벨 안에서는 출력 행 묶음 단위로 병렬 처리
+*/
+
+// 밉 다운샘플 필터
+enum MipFilter : uint32_t {
+	MIP_FILTER_BOX,			// 출력 픽셀이 덮는 원본 면적 평균
+	MIP_FILTER_KAISER		// Kaiser 창 sinc (더 선명하고 aliasing 적음)
+};
+
+// 밉 레벨 1 개 (MipChain::pixels 안의 위치)
+struct MipLevel {
+	uint32_t width;
+	uint32_t height;
+	size_t offset;			// 레벨 시작 byte (4 byte 정렬)
+	size_t size;			// 레벨 byte 크기
+};
+
+// RGBA8 sRGB 밉 체인 (스테이징 버퍼에 그대로 복사해서 레벨별 copy region 으로 업로드)
+struct MipChain {
+	std::vector<MipLevel> levels;
+	std::vector<uint8_t> pixels;
+};
+
+// width x height 이미지의 전체 밉 레벨 수 (1x1 까지)
+uint32_t mipLevelCount(uint32_t width, uint32_t height);
+
+// 레벨 크기 / 위치를 계산하고 전체 버퍼 할당 (레벨 0 을 직접 채운 뒤 generateMipLevels 호출)
+void layoutMipChain(uint32_t width, uint32_t height, MipChain& chain);
+
+// chain 의 레벨 0 으로 나머지 레벨 생성 (pool이 nullptr 이면 호출 스레드에서 처리)
+void generateMipLevels(MipChain& chain, MipFilter filter, ThreadPool* pool);
+
+// RGBA8 sRGB 픽셀로 전체 밉 체인 생성 (layoutMipChain + 레벨 0 복사 + generateMipLevels)
+void buildMipChain(const uint8_t* pixels, uint32_t width, uint32_t height, MipFilter filter, MipChain& chain, ThreadPool* pool);
@@ -0,0 +1,156 @@
+#include "texture_stream.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+// 레벨의 블록 행 수 / 블록 행 1 줄 크기
+uint32_t blockRowCount(uint32_t height, uint32_t blockDimension) {
+	return (height + blockDimension - 1) / blockDimension;
+}
+
+size_t blockRowSize(uint32_t width, uint32_t blockBytes, uint32_t blockDimension) {
+	return size_t((width + blockDimension - 1) / blockDimension) * blockBytes;
+}
+
+} // namespace
+
+TextureStream::~TextureStream() {
+	stop();
+}
+
+void TextureStream::start(uint32_t width, uint32_t height, uint32_t levelCount, uint32_t blockBytes, uint32_t blockDimension,
+						  std::function<void(TextureStream&)> producer) {
+	stop();
+	this->baseWidth = width;
+	this->baseHeight = height;
+	this->levelCount = levelCount;
+	this->blockBytes = blockBytes;
+	this->blockDimension = blockDimension;
+	stopRequested = false;
+	pushedLevels = 0;
+	pending.clear();
+	error = nullptr;
+	current.clear();
+	retired.clear();
+	currentRow = 0;
+	completedLevels = 0;
+
+	worker = std::thread([this, producer]() {
+		try {
+			producer(*this);
+			// 중단 없이 끝났는데 레벨이 모자라면 렌더 스레드가 계속 기다리지 않도록 오류로 처리
+			if (!stopRequested && pushedLevels != this->levelCount) {
+				throw std::runtime_error("failed to stream texture levels!");
+			}
+		} catch (...) {
+			std::lock_guard<std::mutex> lock(queueMutex);
+			error = std::current_exception();
+		}
+	});
+}
+
+void TextureStream::stop() {
+	stopRequested = true;
+	if (worker.joinable()) {
+		worker.join();
+	}
+}
+
+bool TextureStream::pushLevel(uint32_t level, std::vector<uint8_t> data) {
+	if (stopRequested) {
+		return false;
+	}
+	// vector 를 옮겨도 버퍼 주소는 그대로이므로 data 포인터는 storage 를 계속 가리킴
+	const uint8_t* pointer = data.data();
+	size_t size = data.size();
+	pushPendingLevel({level, pointer, size, std::move(data)});
+	return true;
+}
+
+bool TextureStream::pushLevel(uint32_t level, const uint8_t* data, size_t size) {
+	if (stopRequested) {
+		return false;
+	}
+	pushPendingLevel({level, data, size, std::vector<uint8_t>()});
+	return true;
+}
+
+void TextureStream::pushPendingLevel(PendingLevel level) {
+	// 작은 레벨부터 순서대로, 형식에 맞는 크기로만 받음
+	uint32_t width = std::max(baseWidth >> level.level, 1u);
+	uint32_t height = std::max(baseHeight >> level.level, 1u);
+	size_t size = blockRowSize(width, blockBytes, blockDimension) * blockRowCount(height, blockDimension);
+	if (level.level != levelCount - 1 - pushedLevels || level.size != size) {
+		throw std::runtime_error("failed to stream texture levels!");
+	}
+
+	std::lock_guard<std::mutex> lock(queueMutex);
+	pending.push_back(std::move(level));
+	pushedLevels++;
+}
+
+void TextureStream::takeChunks(size_t budget, std::vector<TextureStreamChunk>& chunks) {
+	// 이전 호출에서 넘긴 데이터는 업로드 버퍼로 복사가 끝났으므로 해제
+	chunks.clear();
+	retired.clear();
+
+	// producer 가 넘긴 레벨 가져오기
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		if (error) {
+			std::rethrow_exception(error);
+		}
+		while (!pending.empty()) {
+			current.push_back(std::move(pending.front()));
+			pending.pop_front();
+		}
+	}
+
+	// 예산 안에서 블록 행 단위로 조각 만들기 (레벨이 끝나면 다음 레벨로)
+	size_t used = 0;
+	while (!current.empty()) {
+		PendingLevel& level = current.front();
+		uint32_t width = std::max(baseWidth >> level.level, 1u);
+		uint32_t height = std::max(baseHeight >> level.level, 1u);
+		size_t rowSize = blockRowSize(width, blockBytes, blockDimension);
+		uint32_t rowCount = blockRowCount(height, blockDimension);
+
+		uint32_t rows = 0;
+		while (currentRow + rows < rowCount && (used + rowSize <= budget || used == 0)) {
+			used += rowSize;
+			rows++;
+		}
+		if (rows == 0) {
+			break;
+		}
+
+		TextureStreamChunk chunk;
+		chunk.level = level.level;
+		chunk.width = width;
+		chunk.y = currentRow * blockDimension;
+		chunk.height = std::min(rows * blockDimension, height - chunk.y);
+		chunk.data = level.data + currentRow * rowSize;
+		chunk.size = rows * rowSize;
+		chunk.completesLevel = currentRow + rows == rowCount;
+		chunks.push_back(chunk);
+
+		currentRow += rows;
+		if (!chunk.completesLevel) {
+			break;
+		}
+
+		// 다음 호출까지 조각 데이터가 유효하도록 보관 (소유한 레벨만)
+		if (!level.storage.empty()) {
+			retired.push_back(std::move(level.storage));
+		}
+		current.pop_front();
+		currentRow = 0;
+		completedLevels++;
+	}
+}
+
+size_t TextureStream::maxRowSize() const {
+	return blockRowSize(baseWidth, blockBytes, blockDimension);
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+	[점진적 텍스처 스트리밍]
+	백그라운드 스레드 (producer) 가 밉 레벨을 가장 작은 레벨부터 하나씩 만들어 넘기면
+	렌더 스레드가 매 프레임 byte 예산만큼 블록 행 단위 조각으로 꺼내서 업로드한다.
+	1. 레벨은 작은 것부터 순서대로 들어오므로 업로드가 끝난 레벨은 항상 [상주 레벨, levelCount) 연속 구간
+	   (렌더 스레드는 상주 레벨을 샘플러 minLod 로 써서 아직 없는 큰 레벨을 샘플링하지 않음)
+	2. 레벨 1 개가 예산보다 크면 블록 행 단위로 나눠 여러 프레임에 걸쳐 업로드 (프레임당 업로드 시간 제한)
+	3. producer 에서 발생한 예외는 렌더 스레드의 takeChunks 에서 다시 던짐
+	4. 파일 매핑에 이미 있는 레벨은 복사 없이 (포인터, 크기) 로 전달 가능 (CPU 에서 만든 레벨만 vector 로 소유)
+*/
+
+// 업로드할 조각 1 개 (레벨 안의 연속된 블록 행)
+struct TextureStreamChunk {
+	uint32_t level;
+	uint32_t width;				// 레벨 너비 (픽셀)
+	uint32_t y;					// 조각 시작 행 (픽셀, 블록 크기의 배수)
+	uint32_t height;			// 조각 행 수 (픽셀)
+	const uint8_t* data;		// 다음 takeChunks 호출 전까지 유효
+	size_t size;
+	bool completesLevel;		// 이 조각으로 레벨 업로드가 끝나는지
+};
+
+class TextureStream {
+public:
+	TextureStream() = default;
+	~TextureStream();
+
+	TextureStream(const TextureStream&) = delete;
+	TextureStream& operator=(const TextureStream&) = delete;
+
+	// 백그라운드 스레드에서 producer 실행 (producer 는 pushLevel 로 levelCount - 1 레벨부터 0 레벨까지 순서대로 전달)
+	// blockBytes / blockDimension : 형식의 블록 byte 크기와 한 변의 픽셀 수 (RGBA8 은 4 / 1)
+	void start(uint32_t width, uint32_t height, uint32_t levelCount, uint32_t blockBytes, uint32_t blockDimension,
+			   std::function<void(TextureStream&)> producer);
+	// 중단 요청 후 producer 스레드 종료 대기
+	void stop();
+
+	// [producer] 레벨 1 개 전달 (중단 요청을 받았으면 false 반환 → producer 는 바로 종료)
+	bool pushLevel(uint32_t level, std::vector<uint8_t> data);
+	// [producer] 소유하지 않는 레벨 전달 (data 는 stop 이 끝날 때까지 유효해야 함, 예: 파일 매핑)
+	bool pushLevel(uint32_t level, const uint8_t* data, size_t size);
+
+	// [렌더 스레드] budget byte 안에서 이번 프레임에 업로드할 조각 (진행을 위해 블록 행 1 줄은 예산을 넘어도 반환)
+	void takeChunks(size_t budget, std::vector<TextureStreamChunk>& chunks);
+
+	// 블록 행 1 줄의 최대 byte 크기 (레벨 0 기준, 업로드 버퍼 크기 계산용)
+	size_t maxRowSize() const;
+	// 모든 레벨 조각을 넘겼는지
+	bool isComplete() const { return completedLevels == levelCount; }
+
+private:
+	// producer 가 넘긴 레벨 (storage 가 비어 있으면 외부 메모리를 가리킴)
+	struct PendingLevel {
+		uint32_t level;
+		const uint8_t* data;
+		size_t size;
+		std::vector<uint8_t> storage;
+	};
+
+	void pushPendingLevel(PendingLevel level);
+
+	uint32_t baseWidth = 0;
+	uint32_t baseHeight = 0;
+	uint32_t levelCount = 0;
+	uint32_t blockBytes = 0;
+	uint32_t blockDimension = 1;
+
+	// producer 스레드와 공유
+	std::thread worker;
+	std::mutex queueMutex;
+	std::deque<PendingLevel> pending;
+	std::exception_ptr error;
+	std::atomic<bool> stopRequested{false};
+	uint32_t pushedLevels = 0;
+
+	// 렌더 스레드 전용 (지금 나눠 보내는 레벨, 이전 호출에서 넘긴 데이터)
+	std::deque<PendingLevel> current;
+	std::vector<std::vector<uint8_t>> retired;
+	uint32_t currentRow = 0;
+	uint32_t completedLevels = 0;
+};
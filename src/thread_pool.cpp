@@ -0,0 +1,144 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+ThreadPool::ThreadPool(uint32_t workerCount) {
+	workers.reserve(workerCount);
+	for (uint32_t i = 0; i < workerCount; i++) {
+		workers.emplace_back(&ThreadPool::workerLoop, this);
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		stopping = true;
+	}
+	queueCondition.notify_all();
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+}
+
+uint32_t ThreadPool::defaultWorkerCount() {
+	uint32_t coreCount = std::thread::hardware_concurrency();
+	return coreCount > 1 ? coreCount - 1 : 0;
+}
+
+std::future<void> ThreadPool::submit(std::function<void()> task) {
+	auto packagedTask = std::make_shared<std::packaged_task<void()>>(std::move(task));
+	std::future<void> future = packagedTask->get_future();
+
+	// 워커가 없으면 호출 스레드에서 바로 실행
+	if (workers.empty()) {
+		(*packagedTask)();
+		return future;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		tasks.emplace_back([packagedTask]() { (*packagedTask)(); });
+	}
+	queueCondition.notify_one();
+	return future;
+}
+
+void ThreadPool::parallelFor(uint32_t count, const std::function<void(uint32_t)>& job) {
+	if (count == 0) {
+		return;
+	}
+
+	// 모든 참여 스레드가 공유하는 상태 (다음 작업 번호, 실행 중인 워커 수, 첫 예외)
+	struct ParallelForState {
+		std::atomic<uint32_t> nextIndex{0};
+		std::atomic<bool> failed{false};
+		std::exception_ptr exception;
+		std::mutex doneMutex;
+		std::condition_variable doneCondition;
+		uint32_t activeHelpers = 0;
+		bool closed = false;				// 호출 스레드가 반환 준비 중 (이후 시작한 워커는 job 을 건드리지 않고 바로 끝냄)
+	};
+	auto state = std::make_shared<ParallelForState>();
+
+	// 작업 번호를 하나씩 가져가며 실행 (예외가 나면 남은 작업은 건너뜀)
+	auto runJobs = [state, count, &job]() {
+		for (uint32_t i = state->nextIndex.fetch_add(1); i < count; i = state->nextIndex.fetch_add(1)) {
+			if (state->failed.load()) {
+				break;
+			}
+			try {
+				job(i);
+			} catch (...) {
+				if (!state->failed.exchange(true)) {
+					state->exception = std::current_exception();
+				}
+			}
+		}
+	};
+
+	// 작업 수보다 많은 워커는 깨우지 않음 (호출 스레드도 1개 몫을 처리)
+	uint32_t helperCount = std::min(static_cast<uint32_t>(workers.size()), count - 1);
+	if (helperCount > 0) {
+		std::lock_guard<std::mutex> lock(queueMutex);
+		for (uint32_t i = 0; i < helperCount; i++) {
+			tasks.emplace_back([state, runJobs]() {
+				{
+					std::lock_guard<std::mutex> doneLock(state->doneMutex);
+					if (state->closed) {
+						return;
+					}
+					state->activeHelpers++;
+				}
+				runJobs();
+				std::lock_guard<std::mutex> doneLock(state->doneMutex);
+				if (--state->activeHelpers == 0) {
+					state->doneCondition.notify_one();
+				}
+			});
+		}
+	}
+	queueCondition.notify_all();
+
+	runJobs();
+
+	// 호출 스레드가 돌아오면 작업 번호는 모두 가져간 상태 → 이미 시작한 워커만 기다림
+	// (큐 앞의 다른 작업 때문에 아직 시작하지 못한 워커는 기다리지 않음, 나중에 꺼내면 빈 작업으로 끝남)
+	{
+		std::unique_lock<std::mutex> lock(state->doneMutex);
+		state->closed = true;
+		state->doneCondition.wait(lock, [&state]() { return state->activeHelpers == 0; });
+	}
+
+	if (state->exception) {
+		std::rethrow_exception(state->exception);
+	}
+}
+
+void parallelFor(ThreadPool* pool, uint32_t count, const std::function<void(uint32_t)>& job) {
+	if (pool != nullptr) {
+		pool->parallelFor(count, job);
+	} else {
+		for (uint32_t i = 0; i < count; i++) {
+			job(i);
+		}
+	}
+}
+
+void ThreadPool::workerLoop() {
+	while (true) {
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(queueMutex);
+			queueCondition.wait(lock, [this]() { return stopping || !tasks.empty(); });
+			if (stopping && tasks.empty()) {
+				return;
+			}
+			task = std::move(tasks.front());
+			tasks.pop_front();
+		}
+		task();
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+	[스레드 풀]
+	워커 스레드를 미리 만들어 두고 작업 큐에서 꺼내 실행한다.
+	1. submit: 작업 1개를 비동기로 실행하고 future 반환
+	2. parallelFor: [0, count) 범위를 워커 + 호출 스레드가 나눠 실행하고 모두 끝날 때까지 대기
+	   (작업끼리 출력 구간이 겹치지 않게 미리 나눠두면 lock 없이 병렬 처리 가능)
+	   큐에 먼저 들어온 작업 때문에 아직 시작하지 못한 워커는 기다리지 않고 호출 스레드가 남은 작업을 처리
+*/
+class ThreadPool {
+public:
+	// workerCount 개의 워커 생성 (0이면 호출 스레드만 사용)
+	explicit ThreadPool(uint32_t workerCount = defaultWorkerCount());
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	// 코어 수 - 1 (호출 스레드 몫을 제외한 워커 수)
+	static uint32_t defaultWorkerCount();
+
+	// parallelFor 에 참여하는 스레드 수 (워커 + 호출 스레드)
+	uint32_t threadCount() const { return static_cast<uint32_t>(workers.size()) + 1; }
+
+	// 작업 1개 비동기 실행
+	std::future<void> submit(std::function<void()> task);
+
+	// job(0) ~ job(count - 1) 병렬 실행 (작업에서 발생한 첫 번째 예외는 호출 스레드로 다시 던짐)
+	void parallelFor(uint32_t count, const std::function<void(uint32_t)>& job);
+
+private:
+	std::vector<std::thread> workers;
+	std::deque<std::function<void()>> tasks;
+	std::mutex queueMutex;
+	std::condition_variable queueCondition;
+	bool stopping = false;
+
+	void workerLoop();
+};
+
+// pool이 있으면 pool->parallelFor, nullptr 이면 호출 스레드에서 순서대로 실행
+void parallelFor(ThreadPool* pool, uint32_t count, const std::function<void(uint32_t)>& job);
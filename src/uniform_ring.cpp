@@ -0,0 +1,43 @@
+#include "uniform_ring.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+size_t alignUp(size_t value, size_t alignment) {
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+void UniformRing::init(void* mapped, size_t frameSize, uint32_t frameCount, size_t alignment) {
+	if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+		throw std::runtime_error("failed to create uniform ring!");
+	}
+	this->mapped = static_cast<uint8_t*>(mapped);
+	this->alignment = alignment;
+	this->frameCount = frameCount;
+	regionSize = alignUp(frameSize, alignment);
+	peak = 0;
+	beginFrame(0);
+}
+
+size_t UniformRing::bufferSize(size_t frameSize, uint32_t frameCount, size_t alignment) {
+	return alignUp(frameSize, alignment) * frameCount;
+}
+
+void UniformRing::beginFrame(uint32_t frame) {
+	if (frame >= frameCount) {
+		throw std::runtime_error("failed to begin uniform ring frame!");
+	}
+	peak = peakBytes();
+	frameStart = regionSize * frame;
+	frameEnd = frameStart + regionSize;
+	head = frameStart;
+}
+
+void UniformRing::overflow(size_t size) const {
+	throw std::runtime_error("failed to allocate uniform ring memory: " + std::to_string(size) + " bytes requested, "
+							 + std::to_string(frameEnd - head) + " of " + std::to_string(regionSize) + " bytes left in frame!");
+}
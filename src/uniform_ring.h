@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/*
+	[프레임별 유니폼 링 버퍼]
+	영구 매핑된 버퍼 1 개를 프레임 (MAX_FRAMES_IN_FLIGHT) 마다 같은 크기의 영역으로 나눠서
+	각 프레임의 유니폼 데이터를 영역 안에서 포인터를 밀며 할당한다.
+	1. beginFrame 은 그 프레임의 inFlightFences 대기 후 호출 (GPU 가 영역을 다 읽었으므로 처음부터 재사용)
+	2. allocate / push 는 minUniformBufferOffsetAlignment 정렬 + 포인터 증가뿐
+	   (반환한 offset 을 VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC 의 dynamic offset 으로 넘기면 디스크립터 셋을 새로 만들 필요 없음)
+	3. 영역을 넘으면 다음 프레임 영역을 덮어쓰지 않고 예외 발생 (frameSize 를 늘려야 함)
+*/
+class UniformRing {
+public:
+	// mapped 에 frameCount 개 영역 배치 (frameSize 는 alignment 배수로 올림, alignment 는 2 의 거듭제곱)
+	void init(void* mapped, size_t frameSize, uint32_t frameCount, size_t alignment);
+
+	// 배치에 필요한 버퍼 전체 크기
+	static size_t bufferSize(size_t frameSize, uint32_t frameCount, size_t alignment);
+
+	// 프레임 영역을 처음부터 다시 사용
+	void beginFrame(uint32_t frame);
+
+	// size byte 구간 할당 → 매핑 주소 반환, offset 은 버퍼 시작 기준 (dynamic offset)
+	void* allocate(size_t size, uint32_t& offset) {
+		size_t start = (head + alignment - 1) & ~(alignment - 1);
+		if (start + size > frameEnd) {
+			overflow(size);
+		}
+		head = start + size;
+		offset = static_cast<uint32_t>(start);
+		return mapped + start;
+	}
+
+	// 값 1 개를 복사하고 dynamic offset 반환
+	template <typename T>
+	uint32_t push(const T& value) {
+		uint32_t offset;
+		memcpy(allocate(sizeof(T), offset), &value, sizeof(T));
+		return offset;
+	}
+
+	size_t frameSize() const { return regionSize; }
+	// 이번 프레임에 사용한 byte 수 / 지금까지 한 프레임 최대 사용량
+	size_t usedBytes() const { return head - frameStart; }
+	size_t peakBytes() const { return peak > usedBytes() ? peak : usedBytes(); }
+
+private:
+	uint8_t* mapped = nullptr;
+	size_t regionSize = 0;
+	uint32_t frameCount = 0;
+	size_t alignment = 1;
+
+	size_t frameStart = 0;
+	size_t frameEnd = 0;
+	size_t head = 0;
+	size_t peak = 0;
+
+	// 영역 초과 (예외 발생)
+	[[noreturn]] void overflow(size_t size) const;
+};
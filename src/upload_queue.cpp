@@ -0,0 +1,406 @@
+#include "upload_queue.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+// 업로드한 버퍼 / 이미지를 그래픽스 큐에서 읽는 단계와 접근 (컬링 컴퓨트 셰이더가 읽는 서브 메시 표 포함)
+const VkPipelineStageFlags UPLOAD_READ_STAGES = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+const VkAccessFlags UPLOAD_BUFFER_READ_ACCESS = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+
+} // namespace
+
+UploadQueue::~UploadQueue() {
+	destroy();
+}
+
+void UploadQueue::init(VkDevice device, VkQueue queue, uint32_t queueFamilyIndex, uint32_t dstQueueFamilyIndex, GpuAllocator& allocator, VkDeviceSize stagingSize, VkDeviceSize copyAlignment) {
+	destroy();
+	this->device = device;
+	this->queue = queue;
+	this->allocator = &allocator;
+	srcFamily = queueFamilyIndex;
+	dstFamily = dstQueueFamilyIndex;
+	ring.init(static_cast<size_t>(stagingSize), static_cast<size_t>(copyAlignment));
+
+	// 배치 커맨드 버퍼는 짧게 쓰고 다시 기록하므로 TRANSIENT + 개별 재설정
+	VkCommandPoolCreateInfo poolInfo{};
+	poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+	poolInfo.queueFamilyIndex = queueFamilyIndex;
+	if (vkCreateCommandPool(device, &poolInfo, nullptr, &commandPool) != VK_SUCCESS) {
+		throw std::runtime_error("failed to create upload command pool!");
+	}
+
+	VkCommandBuffer commandBuffers[UPLOAD_BATCH_COUNT];
+	VkCommandBufferAllocateInfo allocInfo{};
+	allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	allocInfo.commandPool = commandPool;
+	allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	allocInfo.commandBufferCount = UPLOAD_BATCH_COUNT;
+	if (vkAllocateCommandBuffers(device, &allocInfo, commandBuffers) != VK_SUCCESS) {
+		throw std::runtime_error("failed to allocate upload command buffers!");
+	}
+	for (uint32_t i = 0; i < UPLOAD_BATCH_COUNT; i++) {
+		batches[i].commandBuffer = commandBuffers[i];
+	}
+
+	// 배치 완료 추적용 타임라인 세마포어 (배치 n 이 끝나면 값 n)
+	VkSemaphoreTypeCreateInfo typeInfo{};
+	typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+	typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+	typeInfo.initialValue = 0;
+	VkSemaphoreCreateInfo semaphoreInfo{};
+	semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+	semaphoreInfo.pNext = &typeInfo;
+	if (vkCreateSemaphore(device, &semaphoreInfo, nullptr, &timeline) != VK_SUCCESS) {
+		throw std::runtime_error("failed to create upload timeline semaphore!");
+	}
+
+	// 영구 매핑된 스테이징 링 버퍼 (프로그램 끝까지 사용하므로 TLSF 풀)
+	VkBufferCreateInfo bufferInfo{};
+	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	bufferInfo.size = stagingSize;
+	bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+	bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	if (vkCreateBuffer(device, &bufferInfo, nullptr, &stagingBuffer) != VK_SUCCESS) {
+		throw std::runtime_error("failed to create buffer!");
+	}
+	VkMemoryRequirements memRequirements;
+	vkGetBufferMemoryRequirements(device, stagingBuffer, &memRequirements);
+	stagingAllocation = allocator.allocate(memRequirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, GPU_RESOURCE_LINEAR, GPU_MEMORY_PERSISTENT);
+	vkBindBufferMemory(device, stagingBuffer, stagingAllocation.memory, stagingAllocation.offset);
+}
+
+void UploadQueue::destroy() {
+	if (device == VK_NULL_HANDLE) {
+		return;
+	}
+
+	// 예약만 해둔 업로드까지 제출하고 전부 끝날 때까지 대기
+	flush();
+	wait(submittedBatchId);
+
+	for (Batch& batch : batches) {
+		batch = Batch();
+	}
+	vkDestroyCommandPool(device, commandPool, nullptr);		// 커맨드 버퍼도 같이 해제
+	vkDestroySemaphore(device, timeline, nullptr);
+	vkDestroyBuffer(device, stagingBuffer, nullptr);
+	allocator->free(stagingAllocation);
+
+	device = VK_NULL_HANDLE;
+	queue = VK_NULL_HANDLE;
+	allocator = nullptr;
+	commandPool = VK_NULL_HANDLE;
+	timeline = VK_NULL_HANDLE;
+	stagingBuffer = VK_NULL_HANDLE;
+	nextBatchId = 1;
+	submittedBatchId = 0;
+	completedBatchId = 0;
+	acquiredBatchId = 0;
+	recording = nullptr;
+	recordingBufferBarriers.clear();
+	recordingImageBarriers.clear();
+	acquireBufferBarriers.clear();
+	acquireImageBarriers.clear();
+}
+
+void UploadQueue::enqueueBuffer(VkBuffer dst, VkDeviceSize dstOffset, const void* data, VkDeviceSize size) {
+	VkBuffer srcBuffer;
+	VkDeviceSize srcOffset;
+	stage(data, size, srcBuffer, srcOffset);
+
+	VkBufferCopy copyRegion{};
+	copyRegion.srcOffset = srcOffset;
+	copyRegion.dstOffset = dstOffset;
+	copyRegion.size = size;
+	vkCmdCopyBuffer(recording->commandBuffer, srcBuffer, dst, 1, &copyRegion);
+
+	// 전송 큐 → 그래픽스 큐 소유권 이전 (배치 끝에 release)
+	if (transfersOwnership()) {
+		VkBufferMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask = 0;
+		barrier.srcQueueFamilyIndex = srcFamily;
+		barrier.dstQueueFamilyIndex = dstFamily;
+		barrier.buffer = dst;
+		barrier.offset = dstOffset;
+		barrier.size = size;
+		recordingBufferBarriers.push_back(barrier);
+	}
+
+	uploadStats.copies++;
+	uploadStats.bytes += size;
+}
+
+void UploadQueue::enqueueImage(VkImage image, uint32_t mipLevels, const VkBufferImageCopy* regions, uint32_t regionCount, const void* data, VkDeviceSize size) {
+	VkBuffer srcBuffer;
+	VkDeviceSize srcOffset;
+	stage(data, size, srcBuffer, srcOffset);
+	VkCommandBuffer commandBuffer = recording->commandBuffer;
+
+	// 전체 레벨을 복사 대상 레이아웃으로 전환 (이전 내용은 버리므로 소유권 획득 불필요)
+	VkImageMemoryBarrier barrier{};
+	barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+	barrier.srcAccessMask = 0;
+	barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	barrier.image = image;
+	barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	barrier.subresourceRange.baseMipLevel = 0;
+	barrier.subresourceRange.levelCount = mipLevels;
+	barrier.subresourceRange.baseArrayLayer = 0;
+	barrier.subresourceRange.layerCount = 1;
+	vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+	// region offset 을 스테이징 위치 기준으로 옮겨서 한 번에 복사
+	std::vector<VkBufferImageCopy> stagedRegions(regions, regions + regionCount);
+	for (VkBufferImageCopy& region : stagedRegions) {
+		region.bufferOffset += srcOffset;
+	}
+	vkCmdCopyBufferToImage(commandBuffer, srcBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, regionCount, stagedRegions.data());
+
+	// 복사가 끝나면 셰이더 읽기 레이아웃으로 전환
+	// (소유권 이전시 전환은 release / acquire 베리어에 같은 레이아웃으로 기록)
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	if (transfersOwnership()) {
+		barrier.dstAccessMask = 0;
+		barrier.srcQueueFamilyIndex = srcFamily;
+		barrier.dstQueueFamilyIndex = dstFamily;
+		recordingImageBarriers.push_back(barrier);
+	} else {
+		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+	}
+
+	uploadStats.copies++;
+	uploadStats.bytes += size;
+}
+
+uint64_t UploadQueue::flush() {
+	if (recording == nullptr) {
+		return 0;
+	}
+	Batch& batch = *recording;
+
+	if (transfersOwnership()) {
+		// 소유권 해제 (dst 단계 / 접근은 그래픽스 큐의 획득 베리어가 담당)
+		vkCmdPipelineBarrier(batch.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr,
+			static_cast<uint32_t>(recordingBufferBarriers.size()), recordingBufferBarriers.data(),
+			static_cast<uint32_t>(recordingImageBarriers.size()), recordingImageBarriers.data());
+
+		// 획득 베리어는 큐 패밀리만 같고 접근 범위는 그래픽스 큐 기준
+		for (VkBufferMemoryBarrier barrier : recordingBufferBarriers) {
+			barrier.srcAccessMask = 0;
+			barrier.dstAccessMask = UPLOAD_BUFFER_READ_ACCESS;
+			acquireBufferBarriers.push_back(barrier);
+		}
+		for (VkImageMemoryBarrier barrier : recordingImageBarriers) {
+			barrier.srcAccessMask = 0;
+			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+			acquireImageBarriers.push_back(barrier);
+		}
+		recordingBufferBarriers.clear();
+		recordingImageBarriers.clear();
+	} else {
+		// 배치의 버퍼 복사 결과를 이후 제출한 그리기에서 읽을 수 있도록 (이미지는 enqueueImage 에서 전환)
+		VkMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask = UPLOAD_BUFFER_READ_ACCESS;
+		vkCmdPipelineBarrier(batch.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, UPLOAD_READ_STAGES, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+	}
+
+	if (vkEndCommandBuffer(batch.commandBuffer) != VK_SUCCESS) {
+		throw std::runtime_error("failed to record upload command buffer!");
+	}
+
+	// 배치가 끝나면 타임라인 값을 배치 번호로 signal
+	VkTimelineSemaphoreSubmitInfo timelineInfo{};
+	timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+	timelineInfo.signalSemaphoreValueCount = 1;
+	timelineInfo.pSignalSemaphoreValues = &batch.id;
+
+	VkSubmitInfo submitInfo{};
+	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submitInfo.pNext = &timelineInfo;
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers = &batch.commandBuffer;
+	submitInfo.signalSemaphoreCount = 1;
+	submitInfo.pSignalSemaphores = &timeline;
+	if (vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS) {
+		throw std::runtime_error("failed to submit upload command buffer!");
+	}
+
+	batch.submitted = true;
+	submittedBatchId = batch.id;
+	recording = nullptr;
+	uploadStats.batches++;
+	return batch.id;
+}
+
+void UploadQueue::wait(uint64_t batch) {
+	if (recording != nullptr && recording->id <= batch) {
+		flush();
+	}
+	while (completedBatchId < batch) {
+		uint64_t completed = completedBatchId;
+		reclaim(true);
+		if (completedBatchId == completed) {
+			break;		// 제출한 배치가 없음
+		}
+	}
+}
+
+bool UploadQueue::isComplete(uint64_t batch) {
+	if (completedBatchId < batch) {
+		reclaim(false);
+	}
+	return completedBatchId >= batch;
+}
+
+uint64_t UploadQueue::recordAcquire(VkCommandBuffer commandBuffer) {
+	if (acquiredBatchId == submittedBatchId) {
+		return 0;
+	}
+	if (!acquireBufferBarriers.empty() || !acquireImageBarriers.empty()) {
+		vkCmdPipelineBarrier(commandBuffer, ACQUIRE_WAIT_STAGE, UPLOAD_READ_STAGES, 0, 0, nullptr,
+			static_cast<uint32_t>(acquireBufferBarriers.size()), acquireBufferBarriers.data(),
+			static_cast<uint32_t>(acquireImageBarriers.size()), acquireImageBarriers.data());
+		acquireBufferBarriers.clear();
+		acquireImageBarriers.clear();
+	}
+	acquiredBatchId = submittedBatchId;
+	return acquiredBatchId;
+}
+
+void UploadQueue::stage(const void* data, VkDeviceSize size, VkBuffer& buffer, VkDeviceSize& offset) {
+	// 링보다 크면 배치 전용 임시 스테이징 버퍼 (선형 풀)
+	if (size > ring.capacity()) {
+		Batch& batch = beginBatch();
+		VkBufferCreateInfo bufferInfo{};
+		bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+		bufferInfo.size = size;
+		bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+		bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		if (vkCreateBuffer(device, &bufferInfo, nullptr, &buffer) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create buffer!");
+		}
+		VkMemoryRequirements memRequirements;
+		vkGetBufferMemoryRequirements(device, buffer, &memRequirements);
+		GpuAllocation allocation = allocator->allocate(memRequirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, GPU_RESOURCE_LINEAR, GPU_MEMORY_TRANSIENT);
+		vkBindBufferMemory(device, buffer, allocation.memory, allocation.offset);
+		memcpy(allocation.mapped, data, static_cast<size_t>(size));
+		batch.tempBuffers.push_back(buffer);
+		batch.tempAllocations.push_back(allocation);
+		offset = 0;
+		return;
+	}
+
+	// 링 구간은 이 데이터를 기록할 배치 번호로 할당
+	// (자리가 없으면 기록 중인 배치 제출 → 끝난 배치 회수 → 그래도 없으면 가장 오래된 배치 대기)
+	size_t ringOffset;
+	while (!ring.allocate(static_cast<size_t>(size), recording != nullptr ? recording->id : nextBatchId, ringOffset)) {
+		flush();
+		uint64_t completed = completedBatchId;
+		reclaim(false);
+		if (completedBatchId == completed) {
+			reclaim(true);
+		}
+	}
+	beginBatch();
+
+	memcpy(static_cast<uint8_t*>(stagingAllocation.mapped) + ringOffset, data, static_cast<size_t>(size));
+	buffer = stagingBuffer;
+	offset = ringOffset;
+}
+
+UploadQueue::Batch& UploadQueue::beginBatch() {
+	if (recording != nullptr) {
+		return *recording;
+	}
+
+	// 쉬는 배치가 없으면 가장 오래된 배치 대기
+	Batch* batch = nullptr;
+	while (batch == nullptr) {
+		for (Batch& candidate : batches) {
+			if (candidate.id == 0) {
+				batch = &candidate;
+				break;
+			}
+		}
+		if (batch == nullptr) {
+			reclaim(true);
+		}
+	}
+
+	VkCommandBufferBeginInfo beginInfo{};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	if (vkBeginCommandBuffer(batch->commandBuffer, &beginInfo) != VK_SUCCESS) {
+		throw std::runtime_error("failed to begin recording upload command buffer!");
+	}
+
+	batch->id = nextBatchId++;
+	recording = batch;
+	return *batch;
+}
+
+void UploadQueue::reclaim(bool wait) {
+	uint64_t value = 0;
+	if (vkGetSemaphoreCounterValue(device, timeline, &value) != VK_SUCCESS) {
+		throw std::runtime_error("failed to read upload timeline semaphore!");
+	}
+
+	// 배치는 제출 순서대로 끝나므로 가장 오래된 것부터 확인
+	while (true) {
+		Batch* oldest = nullptr;
+		for (Batch& batch : batches) {
+			if (batch.submitted && (oldest == nullptr || batch.id < oldest->id)) {
+				oldest = &batch;
+			}
+		}
+		if (oldest == nullptr) {
+			break;
+		}
+
+		if (value < oldest->id) {
+			if (!wait) {
+				break;
+			}
+			VkSemaphoreWaitInfo waitInfo{};
+			waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+			waitInfo.semaphoreCount = 1;
+			waitInfo.pSemaphores = &timeline;
+			waitInfo.pValues = &oldest->id;
+			uploadStats.waits++;
+			if (vkWaitSemaphores(device, &waitInfo, UINT64_MAX) != VK_SUCCESS
+				|| vkGetSemaphoreCounterValue(device, timeline, &value) != VK_SUCCESS) {
+				throw std::runtime_error("failed to wait for upload timeline semaphore!");
+			}
+			wait = false;		// 하나 기다린 뒤에는 이미 끝난 것만 회수
+		}
+		retireBatch(*oldest);
+	}
+	ring.retire(completedBatchId);
+}
+
+void UploadQueue::retireBatch(Batch& batch) {
+	for (size_t i = 0; i < batch.tempBuffers.size(); i++) {
+		vkDestroyBuffer(device, batch.tempBuffers[i], nullptr);
+		allocator->free(batch.tempAllocations[i]);
+	}
+	batch.tempBuffers.clear();
+	batch.tempAllocations.clear();
+	completedBatchId = batch.id;
+	batch.id = 0;
+	batch.submitted = false;
+}
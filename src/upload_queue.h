@@ -0,0 +1,118 @@
+#pragma once
+
+#include "gpu_allocator.h"
+#include "staging_ring.h"
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <vector>
+
+/*
+	[업로드 큐]
+	버퍼 / 이미지 업로드를 예약해두고 커맨드 버퍼 1 개 단위 (배치) 로 모아서 전송 큐에 제출한다.
+	(리소스마다 스테이징 버퍼 생성 → 제출 → vkQueueWaitIdle 하던 것을 대체)
+	1. 데이터는 영구 매핑된 스테이징 링에 복사하고 복사 명령은 현재 배치 커맨드 버퍼에 바로 기록
+	2. 배치 완료는 타임라인 세마포어 1 개로 추적 (배치 번호 = signal 값)
+	   링이 가득 차면 현재 배치를 제출하고 끝난 배치의 링 구간을 회수 (그래도 없으면 가장 오래된 배치 대기)
+	3. 링보다 큰 데이터는 배치 전용 임시 스테이징 버퍼 사용 (배치가 끝나면 해제)
+	4. 전송 전용 큐 패밀리에서 제출하면 배치 끝에 리소스 소유권 해제 (release) 베리어를 기록하고,
+	   그래픽스 큐는 recordAcquire 로 획득 (acquire) 베리어를 기록한 뒤 타임라인 값을 GPU 에서 기다림 (CPU 대기 없음)
+	   같은 큐 패밀리면 배치 끝에 전송 쓰기 → 정점 / 인덱스 / 유니폼 / 셰이더 읽기 메모리 베리어만 기록
+*/
+
+// 동시에 제출 상태로 둘 수 있는 배치 수
+const uint32_t UPLOAD_BATCH_COUNT = 4;
+
+struct UploadQueueStats {
+	uint64_t batches = 0;			// 제출한 배치 (커맨드 버퍼) 수
+	uint64_t copies = 0;			// 예약한 업로드 수
+	uint64_t bytes = 0;				// 업로드한 byte 수
+	uint64_t waits = 0;				// 링 / 배치가 부족해서 CPU 가 배치 완료를 기다린 횟수
+};
+
+class UploadQueue {
+public:
+	UploadQueue() = default;
+	~UploadQueue();
+
+	UploadQueue(const UploadQueue&) = delete;
+	UploadQueue& operator=(const UploadQueue&) = delete;
+
+	// queueFamilyIndex 큐에 제출하고 결과는 dstQueueFamilyIndex 큐 (그래픽스) 에서 사용하는 업로드 큐 생성
+	// (copyAlignment: 스테이징 offset 정렬, 텍스처 블록 크기 이상 / 장치는 timelineSemaphore 기능 활성화 필요)
+	void init(VkDevice device, VkQueue queue, uint32_t queueFamilyIndex, uint32_t dstQueueFamilyIndex, GpuAllocator& allocator, VkDeviceSize stagingSize, VkDeviceSize copyAlignment);
+	// 제출한 배치를 모두 기다린 뒤 해제
+	void destroy();
+
+	// data 를 dst 의 dstOffset 위치로 업로드
+	void enqueueBuffer(VkBuffer dst, VkDeviceSize dstOffset, const void* data, VkDeviceSize size);
+	// data 를 이미지로 업로드 (regions 의 bufferOffset 은 data 기준)
+	// 이미지 전체 mipLevels 를 UNDEFINED → TRANSFER_DST 로 전환해서 복사한 뒤 SHADER_READ_ONLY 로 전환
+	void enqueueImage(VkImage image, uint32_t mipLevels, const VkBufferImageCopy* regions, uint32_t regionCount, const void* data, VkDeviceSize size);
+
+	// 예약한 업로드를 제출 (없으면 아무것도 하지 않음), 배치 번호 (타임라인 값) 반환 (없으면 0)
+	uint64_t flush();
+	// batch 까지 끝날 때까지 CPU 대기
+	void wait(uint64_t batch);
+	// batch 까지 끝났는지 확인 (대기 없음)
+	bool isComplete(uint64_t batch);
+
+	/*
+		[그래픽스 큐 쪽 획득]
+		지금까지 제출한 배치의 소유권 획득 베리어를 commandBuffer 에 기록하고, 이 커맨드 버퍼를 제출할 때
+		semaphore() 를 기다릴 타임라인 값을 반환 (새로 제출한 배치가 없으면 0 → 대기 불필요)
+		대기 단계는 ACQUIRE_WAIT_STAGE (획득 베리어의 src 단계와 같아야 베리어까지 의존성이 이어짐)
+	*/
+	uint64_t recordAcquire(VkCommandBuffer commandBuffer);
+	VkSemaphore semaphore() const { return timeline; }
+	static constexpr VkPipelineStageFlags ACQUIRE_WAIT_STAGE = VK_PIPELINE_STAGE_TRANSFER_BIT;
+
+	// 전송 전용 큐 패밀리를 쓰는지 (소유권 이전 필요)
+	bool transfersOwnership() const { return srcFamily != dstFamily; }
+	const UploadQueueStats& stats() const { return uploadStats; }
+
+private:
+	struct Batch {
+		VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+		uint64_t id = 0;					// 0 이면 사용 안 함
+		bool submitted = false;
+		std::vector<VkBuffer> tempBuffers;	// 링보다 큰 업로드용 임시 스테이징 버퍼
+		std::vector<GpuAllocation> tempAllocations;
+	};
+
+	VkDevice device = VK_NULL_HANDLE;
+	VkQueue queue = VK_NULL_HANDLE;
+	uint32_t srcFamily = 0;
+	uint32_t dstFamily = 0;
+	GpuAllocator* allocator = nullptr;
+	VkCommandPool commandPool = VK_NULL_HANDLE;
+	VkSemaphore timeline = VK_NULL_HANDLE;
+
+	VkBuffer stagingBuffer = VK_NULL_HANDLE;
+	GpuAllocation stagingAllocation;
+	StagingRing ring;
+
+	Batch batches[UPLOAD_BATCH_COUNT];
+	uint64_t nextBatchId = 1;
+	uint64_t submittedBatchId = 0;		// 마지막으로 제출한 배치
+	uint64_t completedBatchId = 0;		// 이 번호까지 끝남
+	uint64_t acquiredBatchId = 0;		// 이 번호까지 그래픽스 큐에서 획득 베리어 기록
+	Batch* recording = nullptr;			// 기록 중인 배치
+
+	// 소유권 이전 베리어 (기록 중인 배치 / 제출했지만 아직 획득하지 않은 배치)
+	std::vector<VkBufferMemoryBarrier> recordingBufferBarriers;
+	std::vector<VkImageMemoryBarrier> recordingImageBarriers;
+	std::vector<VkBufferMemoryBarrier> acquireBufferBarriers;
+	std::vector<VkImageMemoryBarrier> acquireImageBarriers;
+
+	UploadQueueStats uploadStats;
+
+	// 스테이징 공간 확보 (링 또는 임시 버퍼) 후 데이터 복사, 복사 원본 버퍼와 offset 반환
+	void stage(const void* data, VkDeviceSize size, VkBuffer& buffer, VkDeviceSize& offset);
+	// 기록 중인 배치가 없으면 새 배치 시작
+	Batch& beginBatch();
+	// 끝난 배치 회수 (wait 이면 가장 오래된 제출 배치 하나는 끝날 때까지 대기)
+	void reclaim(bool wait);
+	void retireBatch(Batch& batch);
+};
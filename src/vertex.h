@@ -0,0 +1,10 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+// CPU 처리용 정점 (임포트 / 병합 / 최적화는 모두 float 정점으로 하고 업로드 직전에 GpuVertex 로 인코딩)
+struct Vertex {
+	glm::vec3 pos;
+	glm::vec3 color;
+	glm::vec2 texCoord;
+};
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "vertex.h"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+	[GPU 정점 레이아웃]
+	CPU 처리용 Vertex(float)를 GPU 업로드용 레이아웃으로 인코딩한다.
+	레이아웃마다 constexpr attributes() 하나만 정의하면 아래 템플릿이 다음을 자동 생성한다.
+	1. VkVertexInputBindingDescription / VkVertexInputAttributeDescription
+	2. 정점 셰이더 입력 선언 (빌드 시 vertex_layout_gen 이 shaders/vertex_input.glsl 로 출력)
+	정점 셰이더는 양자화 여부와 상관없이 push constant 의 VertexQuantization 으로 pos / texCoord 를 복원한다.
+*/
+
+// 정점 속성 1개 (셰이더 입력 이름은 "in" + name, 전처리 매크로는 VERTEX_INPUT_ + define)
+struct VertexAttribute {
+	uint32_t location;		// 셰이더 location
+	VkFormat format;		// 버텍스 버퍼에 저장된 형식
+	uint32_t offset;		// 레이아웃 구조체 안의 위치
+	const char* glslType;	// 셰이더에서 읽을 타입
+	const char* name;		// 셰이더 입력 이름
+	const char* define;		// 셰이더에서 속성 유무를 확인하는 매크로 이름
+};
+
+/*
+	[정점 복원 변환] (push constant 로 서브 메시마다 전달, 48 byte)
+	pos      = inPosition * positionScale.xyz + positionOffset.xyz
+	texCoord = inTexCoord * texCoordTransform.zw + texCoordTransform.xy
+	float 레이아웃은 항등 변환 (scale 1, offset 0)
+*/
+struct VertexQuantization {
+	glm::vec4 positionOffset;
+	glm::vec4 positionScale;
+	glm::vec4 texCoordTransform;	// xy: offset, zw: scale
+};
+
+// 항등 변환
+inline VertexQuantization identityQuantization() {
+	VertexQuantization quantization;
+	quantization.positionOffset = glm::vec4(0.0f);
+	quantization.positionScale = glm::vec4(1.0f);
+	quantization.texCoordTransform = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+	return quantization;
+}
+
+// [float 레이아웃] 32 byte (pos vec3, color vec3, texCoord vec2)
+struct VertexFloat {
+	glm::vec3 pos;
+	glm::vec3 color;
+	glm::vec2 texCoord;
+
+	static constexpr bool quantized = false;
+	static constexpr std::array<VertexAttribute, 3> attributes();
+
+	static VertexFloat encode(const Vertex& vertex, const VertexQuantization&) {
+		return {vertex.pos, vertex.color, vertex.texCoord};
+	}
+
+	static Vertex decode(const VertexFloat& vertex, const VertexQuantization&) {
+		return {vertex.pos, vertex.color, vertex.texCoord};
+	}
+};
+
+constexpr std::array<VertexAttribute, 3> VertexFloat::attributes() {
+	return {{
+		{0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(VertexFloat, pos), "vec3", "Position", "POSITION"},
+		{1, VK_FORMAT_R32G32B32_SFLOAT, offsetof(VertexFloat, color), "vec3", "Color", "COLOR"},
+		{2, VK_FORMAT_R32G32_SFLOAT, offsetof(VertexFloat, texCoord), "vec2", "TexCoord", "TEXCOORD"}
+	}};
+}
+
+/*
+	[양자화 레이아웃] 12 byte
+	pos      : 서브 메시 bounding box 기준 16bit UNORM (w 는 4 byte 정렬용 패딩, R16G16B16 형식은 지원하지 않는 GPU가 많음)
+	texCoord : 서브 메시 UV 범위 기준 16bit UNORM (0 ~ 1 을 벗어나는 반복 UV도 표현 가능)
+	color    : 항상 {1, 1, 1} 이므로 저장하지 않음 (셰이더에서 상수로 대체)
+*/
+struct VertexQuantized {
+	uint16_t pos[4];
+	uint16_t texCoord[2];
+
+	static constexpr bool quantized = true;
+	static constexpr std::array<VertexAttribute, 2> attributes();
+
+	static VertexQuantized encode(const Vertex& vertex, const VertexQuantization& quantization) {
+		VertexQuantized result{};
+		for (int i = 0; i < 3; i++) {
+			result.pos[i] = quantizeUnorm16((vertex.pos[i] - quantization.positionOffset[i]) / quantization.positionScale[i]);
+		}
+		for (int i = 0; i < 2; i++) {
+			result.texCoord[i] = quantizeUnorm16((vertex.texCoord[i] - quantization.texCoordTransform[i]) / quantization.texCoordTransform[i + 2]);
+		}
+		return result;
+	}
+
+	static Vertex decode(const VertexQuantized& vertex, const VertexQuantization& quantization) {
+		Vertex result;
+		for (int i = 0; i < 3; i++) {
+			result.pos[i] = vertex.pos[i] / 65535.0f * quantization.positionScale[i] + quantization.positionOffset[i];
+		}
+		for (int i = 0; i < 2; i++) {
+			result.texCoord[i] = vertex.texCoord[i] / 65535.0f * quantization.texCoordTransform[i + 2] + quantization.texCoordTransform[i];
+		}
+		result.color = glm::vec3(1.0f);
+		return result;
+	}
+
+	static uint16_t quantizeUnorm16(float value) {
+		float clamped = std::min(std::max(value, 0.0f), 1.0f);
+		return static_cast<uint16_t>(std::lround(clamped * 65535.0f));
+	}
+};
+
+constexpr std::array<VertexAttribute, 2> VertexQuantized::attributes() {
+	return {{
+		{0, VK_FORMAT_R16G16B16A16_UNORM, offsetof(VertexQuantized, pos), "vec3", "Position", "POSITION"},
+		{2, VK_FORMAT_R16G16_UNORM, offsetof(VertexQuantized, texCoord), "vec2", "TexCoord", "TEXCOORD"}
+	}};
+}
+
+// 빌드 옵션으로 선택한 GPU 정점 레이아웃 (CMake VERTEX_LAYOUT)
+#if defined(VERTEX_LAYOUT_FLOAT)
+using GpuVertex = VertexFloat;
+#else
+using GpuVertex = VertexQuantized;
+#endif
+
+// 정점 데이터가 전달되는 방법을 알려주는 구조체 반환하는 함수
+template <typename Layout>
+VkVertexInputBindingDescription getBindingDescription() {
+	// 파이프라인에 정점 데이터가 전달되는 방법을 알려주는 구조체
+	VkVertexInputBindingDescription bindingDescription{};
+	bindingDescription.binding = 0;								// 버텍스 바인딩 포인트 (현재 0번에 vertex 정보 바인딩)
+	bindingDescription.stride = sizeof(Layout);					// 버텍스 1개 단위의 정보 크기
+	bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX; // 정점 데이터 처리 방법
+																// 1. VK_VERTEX_INPUT_RATE_VERTEX : 정점별로 데이터 처리
+																// 2. VK_VERTEX_INPUT_RATE_INSTANCE : 인스턴스별로 데이터 처리
+	return bindingDescription;
+}
+
+// 정점 속성별 데이터 형식과 위치를 지정하는 구조체 반환하는 함수
+template <typename Layout>
+auto getAttributeDescriptions() {
+	constexpr auto attributes = Layout::attributes();
+	std::array<VkVertexInputAttributeDescription, attributes.size()> attributeDescriptions{};
+	for (size_t i = 0; i < attributes.size(); i++) {
+		attributeDescriptions[i].binding = 0;							// 버텍스 버퍼의 바인딩 포인트
+		attributeDescriptions[i].location = attributes[i].location;		// 버텍스 셰이더의 어떤 location에 대응되는지 지정
+		attributeDescriptions[i].format = attributes[i].format;			// 저장되는 데이터 형식
+		attributeDescriptions[i].offset = attributes[i].offset;			// 레이아웃 구조체에서 해당 속성이 시작되는 위치
+	}
+	return attributeDescriptions;
+}
+
+// 정점 셰이더 입력 선언 생성 (속성마다 #define VERTEX_INPUT_<define> + layout(location) in 선언)
+template <typename Layout>
+std::string getShaderInputs() {
+	std::string source = "// vertex_layout_gen 이 생성한 파일 (직접 수정하지 말 것)\n";
+	for (const VertexAttribute& attribute : Layout::attributes()) {
+		source += "#define VERTEX_INPUT_" + std::string(attribute.define) + "\n";
+		source += "layout(location = " + std::to_string(attribute.location) + ") in " + attribute.glslType + " in" + attribute.name + ";\n";
+	}
+	return source;
+}
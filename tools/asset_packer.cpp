@@ -0,0 +1,99 @@
+#include "asset_pack.h"
+#include "asset_settings.h"
+#include "mesh_cache.h"
+#include "model_loader.h"
+#include "texture_ktx2.h"
+#include "thread_pool.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+	[에셋 패커]
+	메시 / 텍스처 / 셰이더를 런타임 로드 형식으로 변환해서 단일 에셋 팩으로 묶는다.
+	1. 모델 (.obj 등) : 렌더러와 같은 임포트 설정으로 임포트 후 메시 캐시 형식으로 직렬화
+	2. .ktx2 : 검증 후 그대로 (texture_bake 출력)
+	3. .spv : 그대로 (4 byte 정렬 확인)
+	에셋 이름은 명령줄에 적은 경로 그대로이므로 렌더러와 같은 실행 위치 기준 경로로 실행
+	사용법: asset_packer <출력 .pack> <입력 파일>...
+*/
+namespace {
+
+float elapsedMilliseconds(std::chrono::high_resolution_clock::time_point startTime) {
+	auto endTime = std::chrono::high_resolution_clock::now();
+	return std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+}
+
+bool readFile(const std::string& path, std::vector<uint8_t>& data) {
+	std::ifstream file(path, std::ios::ate | std::ios::binary);
+	if (!file.is_open()) {
+		return false;
+	}
+	data.resize(static_cast<size_t>(file.tellg()));
+	file.seekg(0);
+	file.read(reinterpret_cast<char*>(data.data()), data.size());
+	return file.good();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	if (argc < 3) {
+		std::cerr << "usage: asset_packer <output.pack> <input>..." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	ThreadPool pool;
+	std::vector<AssetPackInput> inputs;
+	size_t totalSize = 0;
+	try {
+		for (int i = 2; i < argc; i++) {
+			AssetPackInput input;
+			input.name = argv[i];
+			std::string extension = std::filesystem::path(input.name).extension().string();
+
+			auto startTime = std::chrono::high_resolution_clock::now();
+			if (extension == ".spv") {
+				input.type = ASSET_TYPE_SHADER;
+				if (!readFile(input.name, input.data) || input.data.size() % 4 != 0) {
+					std::cerr << "failed to read shader " << input.name << std::endl;
+					return EXIT_FAILURE;
+				}
+			} else if (extension == ".ktx2") {
+				input.type = ASSET_TYPE_TEXTURE;
+				if (!readFile(input.name, input.data)) {
+					std::cerr << "failed to read texture " << input.name << std::endl;
+					return EXIT_FAILURE;
+				}
+				Ktx2File ktx2;
+				ktx2.open(input.data.data(), input.data.size());
+			} else {
+				// 모델은 원본 파일 정보 없이 임포트 설정만 키로 사용 (팩은 빌드에서 원본이 바뀔 때 다시 생성)
+				input.type = ASSET_TYPE_MESH;
+				MeshData meshData;
+				importModel(input.name, MODEL_IMPORT_FLAGS, MODEL_PROCESS_OPTIONS, meshData, &pool);
+				MeshCache::serialize(makePackedMeshCacheKey(input.name, MODEL_IMPORT_FLAGS, MODEL_PROCESS_OPTIONS), meshData, input.data);
+			}
+
+			const char* typeNames[] = {"mesh", "texture", "shader"};
+			std::cout << "  " << typeNames[input.type] << "  " << input.name << " (" << input.data.size() / 1024 << " KB, " << elapsedMilliseconds(startTime) << " ms)" << std::endl;
+			totalSize += input.data.size();
+			inputs.push_back(std::move(input));
+		}
+	} catch (const std::exception& e) {
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	if (!AssetPack::write(argv[1], inputs)) {
+		std::cerr << "failed to write " << argv[1] << std::endl;
+		return EXIT_FAILURE;
+	}
+	std::cout << argv[1] << " (" << inputs.size() << " assets, " << totalSize / 1024 << " KB)" << std::endl;
+	return EXIT_SUCCESS;
+}
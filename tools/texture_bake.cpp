@@ -0,0 +1,118 @@
+#include "texture_bc.h"
+#include "texture_ktx2.h"
+#include "texture_loader.h"
+#include "texture_mip.h"
+#include "thread_pool.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+	[텍스처 베이크]
+	PNG 등 이미지를 sRGB 밉 체인 (Kaiser 필터) 으로 만든 뒤 모든 레벨을 BC7 (기본) 또는 BC1 으로 압축해서 KTX2 로 저장한다.
+	RGBA8 대비 VRAM 크기, 압축 처리량 (입력 RGBA8 MB/s), 레벨 0 PSNR 을 출력
+	사용법: texture_bake <입력 이미지> <출력 .ktx2> [bc7 | bc1]
+*/
+namespace {
+
+const MipFilter BAKE_MIP_FILTER = MIP_FILTER_KAISER;
+
+float elapsedMilliseconds(std::chrono::high_resolution_clock::time_point startTime) {
+	auto endTime = std::chrono::high_resolution_clock::now();
+	return std::chrono::duration<float, std::chrono::milliseconds::period>(endTime - startTime).count();
+}
+
+// RGB 채널 PSNR (dB, 같으면 99)
+double psnrRgb(const uint8_t* a, const uint8_t* b, size_t pixelCount) {
+	double error = 0.0;
+	for (size_t i = 0; i < pixelCount; i++) {
+		for (uint32_t c = 0; c < 3; c++) {
+			double d = static_cast<double>(a[i * 4 + c]) - b[i * 4 + c];
+			error += d * d;
+		}
+	}
+	if (error == 0.0) {
+		return 99.0;
+	}
+	return 10.0 * std::log10(255.0 * 255.0 * pixelCount * 3 / error);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	if (argc < 3) {
+		std::cerr << "usage: texture_bake <input> <output.ktx2> [bc7 | bc1]" << std::endl;
+		return EXIT_FAILURE;
+	}
+	BcFormat format = BC_FORMAT_BC7;
+	if (argc > 3) {
+		if (strcmp(argv[3], "bc1") == 0) {
+			format = BC_FORMAT_BC1;
+		} else if (strcmp(argv[3], "bc7") != 0) {
+			std::cerr << "unknown format " << argv[3] << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	// 밉 체인 레벨 0 자리에 바로 디코딩
+	ThreadPool pool;
+	MipChain mipChain;
+	try {
+		std::vector<TextureImage> images(1);
+		images[0].path = argv[1];
+		probeTextureImages(images, nullptr);
+		layoutMipChain(images[0].width, images[0].height, mipChain);
+		decodeTextureImages(images, mipChain.pixels.data(), nullptr);
+	} catch (const std::exception&) {
+		std::cerr << "failed to load " << argv[1] << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	auto startTime = std::chrono::high_resolution_clock::now();
+	generateMipLevels(mipChain, BAKE_MIP_FILTER, &pool);
+	float mipTime = elapsedMilliseconds(startTime);
+
+	// 레벨별 압축 블록 배치 (레벨 0 부터 연속)
+	std::vector<MipLevel> levels(mipChain.levels.size());
+	size_t offset = 0;
+	for (size_t i = 0; i < levels.size(); i++) {
+		levels[i].width = mipChain.levels[i].width;
+		levels[i].height = mipChain.levels[i].height;
+		levels[i].offset = offset;
+		levels[i].size = bcImageSize(format, levels[i].width, levels[i].height);
+		offset += levels[i].size;
+	}
+	std::vector<uint8_t> blocks(offset);
+
+	startTime = std::chrono::high_resolution_clock::now();
+	for (size_t i = 0; i < levels.size(); i++) {
+		encodeBcImage(mipChain.pixels.data() + mipChain.levels[i].offset, levels[i].width, levels[i].height, format, blocks.data() + levels[i].offset, &pool);
+	}
+	float encodeTime = elapsedMilliseconds(startTime);
+
+	// 레벨 0 복원 품질
+	const MipLevel& base = mipChain.levels[0];
+	std::vector<uint8_t> decoded(base.size);
+	decodeBcImage(blocks.data(), base.width, base.height, format, decoded.data(), &pool);
+	double psnr = psnrRgb(mipChain.pixels.data(), decoded.data(), size_t(base.width) * base.height);
+
+	if (!Ktx2File::write(argv[2], bcVkFormat(format, true), levels.data(), static_cast<uint32_t>(levels.size()), blocks.data())) {
+		std::cerr << "failed to write " << argv[2] << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	float sourceMegabytes = mipChain.pixels.size() / (1024.0f * 1024.0f);
+	float blockMegabytes = blocks.size() / (1024.0f * 1024.0f);
+	std::cout << argv[2] << " (" << (format == BC_FORMAT_BC1 ? "BC1" : "BC7") << ", " << base.width << "x" << base.height << ", " << levels.size() << " levels)" << std::endl;
+	std::cout << "  vram     " << blockMegabytes << " MB (RGBA8 " << sourceMegabytes << " MB, " << sourceMegabytes / blockMegabytes << "x smaller)" << std::endl;
+	std::cout << "  mips     " << mipTime << " ms" << std::endl;
+	std::cout << "  encode   " << encodeTime << " ms (" << sourceMegabytes / (encodeTime / 1000.0f) << " MB/s, " << pool.threadCount() << " threads)" << std::endl;
+	std::cout << "  psnr     " << psnr << " dB (level 0 RGB)" << std::endl;
+	return EXIT_SUCCESS;
+}
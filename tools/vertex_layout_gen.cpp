@@ -0,0 +1,25 @@
+#include "vertex_layout.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+/*
+	[정점 셰이더 입력 생성기]
+	빌드 옵션으로 선택한 GpuVertex 레이아웃의 셰이더 입력 선언을 파일로 출력한다.
+	사용법: vertex_layout_gen <출력 경로>
+*/
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		std::cerr << "usage: vertex_layout_gen <output>" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::ofstream out(argv[1], std::ios::trunc);
+	if (!out.is_open()) {
+		std::cerr << "failed to open " << argv[1] << std::endl;
+		return EXIT_FAILURE;
+	}
+	out << getShaderInputs<GpuVertex>();
+	return out.good() ? EXIT_SUCCESS : EXIT_FAILURE;
+}